@@ -88,8 +88,13 @@ extern long long pspamm_num_total_flops;
 #include "proxy_seissol_integrators.hpp"
 
 
+#ifdef LOCAL_BATCH_SIZE
+enum Kernel { all = 0, local, neigh, ader, localwoader, neigh_dr, godunov_dr, localbatched };
+char const* Kernels[] = {"all", "local", "neigh", "ader", "localwoader", "neigh_dr", "godunov_dr", "localbatched"};
+#else
 enum Kernel { all = 0, local, neigh, ader, localwoader, neigh_dr, godunov_dr };
 char const* Kernels[] = {"all", "local", "neigh", "ader", "localwoader", "neigh_dr", "godunov_dr"};
+#endif
 
 void testKernel(unsigned kernel, unsigned timesteps) {
   unsigned t = 0;
@@ -126,6 +131,13 @@ void testKernel(unsigned kernel, unsigned timesteps) {
         computeDynRupGodunovState();
       }
       break;
+#ifdef LOCAL_BATCH_SIZE
+    case localbatched:
+      for (; t < timesteps; ++t) {
+        computeLocalBatchedIntegration();
+      }
+      break;
+#endif
     default:
       break;
   }
@@ -230,6 +242,13 @@ int main(int argc, char* argv[]) {
       flop_fun = &flops_drgod_actual;
       bytes_fun = &noestimate;
       break;
+#ifdef LOCAL_BATCH_SIZE
+    case localbatched:
+      // idle lanes are not counted
+      flop_fun = &flops_local_actual;
+      bytes_fun = &bytes_local;
+      break;
+#endif
   }
   
   seissol_flops actual_flops = (*flop_fun)(timesteps);
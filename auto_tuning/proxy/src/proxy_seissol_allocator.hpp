@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Initializer/tree/LTSTree.hpp>
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/GlobalData.h>
+#include <Initializer/LocalIntegrationBatches.h>
 #include <Solver/time_stepping/MiniSeisSol.cpp>
 #include <yateto.h>
 
@@ -92,6 +93,7 @@ unsigned int init_data_structures(unsigned int i_cells, bool enableDynamicRuptur
   m_localKernel.setGlobalData(&m_globalData);
   m_neighborKernel.setGlobalData(&m_globalData);
   m_dynRupKernel.setGlobalData(&m_globalData);
+  m_dynRupKernel.setTimeStepWidth(m_timeStepWidthSimulation);
   
   m_lts.addTo(m_ltsTree);
   m_ltsTree.setNumberOfTimeClusters(1);
@@ -104,6 +106,10 @@ unsigned int init_data_structures(unsigned int i_cells, bool enableDynamicRuptur
   
   seissol::initializers::Layer& layer = cluster.child<Interior>();
   layer.setBucketSize(m_lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer.getNumberOfCells());
+#ifdef LOCAL_BATCH_SIZE
+  // all fake cells are computed in batches
+  layer.setBucketSize(m_lts.localIntegrationBatches, sizeof(LocalIntegrationBatch) * ((layer.getNumberOfCells() + LOCAL_BATCH_SIZE - 1) / LOCAL_BATCH_SIZE));
+#endif
   
   m_ltsTree.allocateVariables();
   m_ltsTree.touchVariables();
@@ -135,6 +141,9 @@ unsigned int init_data_structures(unsigned int i_cells, bool enableDynamicRuptur
 
   /* cell information and integration data*/
   seissol::fakeData(m_lts, layer, (enableDynamicRupture) ? FaceType::dynamicRupture : FaceType::regular);
+#ifdef LOCAL_BATCH_SIZE
+  seissol::initializers::initializeLocalIntegrationBatches(layer, m_lts);
+#endif
 
   if (enableDynamicRupture) {
     // From lts tree
@@ -26,6 +26,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <generated_code/tensor.h>
+#include <Kernels/LocalBatch.h>
+
+#include <algorithm>
 
 namespace tensor = seissol::tensor;
 namespace kernels = seissol::kernels;
@@ -122,6 +125,47 @@ void computeLocalIntegration() {
 #endif
 }
 
+#ifdef LOCAL_BATCH_SIZE
+void computeLocalBatchedIntegration() {
+  auto&                 layer           = m_ltsTree.child(0).child<Interior>();
+  unsigned              nrOfBatches     = layer.getBucketSize(m_lts.localIntegrationBatches) / sizeof(LocalIntegrationBatch);
+  LocalIntegrationBatch* batches        = static_cast<LocalIntegrationBatch*>(layer.bucket(m_lts.localIntegrationBatches));
+  real                (*dofs)[tensor::Q::size()]      = layer.var(m_lts.dofs);
+  real**                buffers                       = layer.var(m_lts.buffers);
+
+#ifdef _OPENMP
+  #pragma omp parallel
+  {
+#endif
+  alignas(ALIGNMENT) real batchedDofs[tensor::batchedQ::size()];
+  alignas(ALIGNMENT) real batchedTimeIntegrated[tensor::batchedI::size()];
+  std::fill_n(batchedDofs, tensor::batchedQ::size(), static_cast<real>(0.0));
+#ifdef _OPENMP
+  #pragma omp for schedule(static)
+#endif
+  for( unsigned int l_batch = 0; l_batch < nrOfBatches; l_batch++ ) {
+    LocalIntegrationBatch const& batch = batches[l_batch];
+    for (unsigned lane = 0; lane < batch.numberOfCells; ++lane) {
+      kernels::gatherToBatch(dofs[batch.cells[lane]], lane, batchedDofs);
+    }
+    m_timeKernel.computeBatchedAder((double)m_timeStepWidthSimulation,
+                                    batch,
+                                    batchedDofs,
+                                    batchedTimeIntegrated);
+    m_localKernel.computeBatchedIntegral(batchedTimeIntegrated,
+                                         batch,
+                                         batchedDofs);
+    for (unsigned lane = 0; lane < batch.numberOfCells; ++lane) {
+      kernels::scatterFromBatch(batchedDofs, lane, dofs[batch.cells[lane]]);
+      kernels::scatterFromBatch(batchedTimeIntegrated, lane, buffers[batch.cells[lane]]);
+    }
+  }
+#ifdef _OPENMP
+  }
+#endif
+}
+#endif
+
 void computeNeighboringIntegration() {
   auto&                     layer                           = m_ltsTree.child(0).child<Interior>();
   unsigned                  nrOfCells                       = layer.getNumberOfCells();
@@ -208,16 +252,13 @@ void computeDynRupGodunovState()
   #pragma omp parallel for schedule(static) private(QInterpolatedPlus,QInterpolatedMinus)
 #endif
   for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
-    unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
     m_dynRupKernel.spaceTimeInterpolation(  faceInformation[face],
                                            &m_globalData,
                                            &godunovData[face],
                                             timeDerivativePlus[face],
                                             timeDerivativeMinus[face],
                                             QInterpolatedPlus,
-                                            QInterpolatedMinus,
-                                            timeDerivativePlus[prefetchFace],
-                                            timeDerivativeMinus[prefetchFace] );
+                                            QInterpolatedMinus );
   }
 }
 
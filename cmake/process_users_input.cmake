@@ -51,6 +51,8 @@ set_property(CACHE PLASTICITY_METHOD PROPERTY STRINGS ${PLASTICITY_OPTIONS})
 
 set(NUMBER_OF_FUSED_SIMULATIONS 1 CACHE STRING "A number of fused simulations")
 
+set(LOCAL_BATCH_SIZE 1 CACHE STRING "Number of cells per batch of the local integration (1 = disabled, elastic only)")
+
 
 set(MEMORY_LAYOUT "auto" CACHE FILEPATH "A file with a specific memory layout or auto")
 
@@ -135,6 +137,20 @@ if (NOT ${NUMBER_OF_FUSED_SIMULATIONS} EQUAL 1 AND NOT ${IS_ALIGNED_MULT_SIMULAT
     message(FATAL_ERROR "a number of fused must be multiple of ${FACTOR}")
 endif()
 
+# check LOCAL_BATCH_SIZE
+math(EXPR IS_ALIGNED_LOCAL_BATCH_SIZE
+        "${LOCAL_BATCH_SIZE} % (${ALIGNMENT} / ${REAL_SIZE_IN_BYTES})")
+
+if (NOT ${LOCAL_BATCH_SIZE} EQUAL 1)
+    if (NOT ${IS_ALIGNED_LOCAL_BATCH_SIZE} EQUAL 0)
+        math(EXPR FACTOR "${ALIGNMENT} / ${REAL_SIZE_IN_BYTES}")
+        message(FATAL_ERROR "the local batch size must be multiple of ${FACTOR}")
+    endif()
+    if (NOT "${EQUATIONS}" STREQUAL "elastic" OR NOT ${NUMBER_OF_FUSED_SIMULATIONS} EQUAL 1)
+        message(FATAL_ERROR "the local batch size requires elastic equations without fused simulations")
+    endif()
+endif()
+
 #-------------------------------------------------------------------------------
 # -------------------- COMPUTE/ADJUST ADDITIONAL PARAMETERS --------------------
 #-------------------------------------------------------------------------------
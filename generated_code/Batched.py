@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+##
+# @file
+# This file is part of SeisSol.
+#
+# @section LICENSE
+# Copyright (c) 2020, SeisSol Group
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Kernels for the batched local integration (cells interleaved in the fastest dimension).
+#
+
+import numpy as np
+from yateto import Tensor, Scalar, simpleParameterSpace
+from yateto.ast.node import Add
+from yateto.ast.transformer import DeduceIndices, EquivalentSparsityPattern
+
+def addKernels(generator, aderdg, batchSize):
+  """Kernels for the local integration of batches of cells.
+     The cell is the fastest dimension of all batched tensors, such that
+     the vector lanes compute different cells of the batch.
+  """
+  if aderdg.Q.hasOptDim():
+    raise ValueError('Batched local integration does not support multiple simulations.')
+  if aderdg.sourceMatrix() is not None:
+    raise ValueError('Batched local integration does not support source matrices.')
+
+  def batchedSpp(tensor):
+    spp = tensor.spp().as_ndarray()
+    return np.broadcast_to(spp, (batchSize,) + spp.shape).copy()
+
+  qShape = (batchSize, aderdg.numberOf3DBasisFunctions(), aderdg.numberOfQuantities())
+  Q = Tensor('batchedQ', qShape, alignStride=True)
+  I = Tensor('batchedI', qShape, alignStride=True)
+  star = [Tensor('batchedStar({})'.format(dim), (batchSize,) + aderdg.starMatrix(dim).shape(), spp=batchedSpp(aderdg.starMatrix(dim))) for dim in range(3)]
+  AplusT = Tensor('batchedAplusT', (batchSize,) + aderdg.AplusT.shape(), spp=batchedSpp(aderdg.AplusT))
+
+  # lane selector for packing the cell local matrices
+  lane = Tensor('batchLane', (batchSize,))
+  generator.addFamily('packStar', simpleParameterSpace(3), lambda dim: star[dim]['bqp'] <= star[dim]['bqp'] + aderdg.starMatrix(dim)['qp'] * lane['b'])
+  generator.add('packAplusT', AplusT['bqp'] <= AplusT['bqp'] + aderdg.AplusT['qp'] * lane['b'])
+
+  ## ADER time prediction
+  power = Scalar('power')
+  derivatives = [Tensor('batchedDQ(0)', qShape, alignStride=True)]
+  generator.add('derivativeTaylorExpansion(0)', I['bkp'] <= power * derivatives[0]['bkp'])
+  for order in range(1, aderdg.order):
+    derivativeSum = Add()
+    for dim in range(3):
+      derivativeSum += aderdg.db.kDivMT[dim][aderdg.t('kl')] * derivatives[-1]['blq'] * star[dim]['bqp']
+    derivativeSum = DeduceIndices( Q['bkp'].indices ).visit(derivativeSum)
+    derivativeSum = EquivalentSparsityPattern().visit(derivativeSum)
+    dQ = Tensor('batchedDQ({})'.format(order), qShape, spp=derivativeSum.eqspp(), alignStride=True)
+    generator.add('derivative({})'.format(order), dQ['bkp'] <= derivativeSum)
+    generator.add('derivativeTaylorExpansion({})'.format(order), I['bkp'] <= I['bkp'] + power * dQ['bkp'])
+    derivatives.append(dQ)
+
+  ## Volume and local flux
+  volumeSum = Q['bkp']
+  for dim in range(3):
+    volumeSum += aderdg.db.kDivM[dim][aderdg.t('kl')] * I['blq'] * star[dim]['bqp']
+  generator.add('volume', Q['bkp'] <= volumeSum)
+
+  localFlux = lambda face: Q['bkp'] <= Q['bkp'] + aderdg.db.rDivM[face][aderdg.t('km')] * aderdg.db.fMrT[face][aderdg.t('ml')] * I['blq'] * AplusT['bqp']
+  generator.addFamily('localFlux', simpleParameterSpace(4), localFlux)
@@ -39,6 +39,7 @@
 #
 
 from yateto import Tensor, Scalar, simpleParameterSpace
+from yateto.ast.node import Add
 from yateto.input import parseJSONMatrixFile
 from multSim import OptionalDimTensor
 
@@ -71,11 +72,17 @@ def addKernels(generator, aderdg, matricesDir, dynamicRuptureMethod):
   fluxScale = Scalar('fluxScale')
   generator.add('rotateFluxMatrix', fluxSolver['qp'] <= fluxScale * aderdg.starMatrix(0)['qk'] * aderdg.T['pk'])
 
-  def interpolateQGenerator(i,h):
-    return QInterpolated['kp'] <= db.V3mTo2n[i,h][aderdg.t('kl')] * aderdg.Q['lq'] * TinvT['qp']
+  # The Taylor expansion at all time points is a linear combination of the projected derivatives,
+  # where timeBasis(d) holds the Taylor coefficients of derivative d at the time points
+  timeBasis = [Tensor('timeBasis({})'.format(d), (aderdg.order,)) for d in range(aderdg.order)]
+  QInterpolatedTime = OptionalDimTensor('QInterpolatedTime', aderdg.Q.optName(), aderdg.Q.optSize(), aderdg.Q.optPos(), gShape + (aderdg.order,), alignStride=True)
+  def interpolateQTimeGenerator(i,h):
+    interpolated = Add()
+    for d, dQ in enumerate(aderdg.timeDerivatives):
+      interpolated += db.V3mTo2n[i,h][aderdg.t('kl')] * dQ['lq'] * TinvT['qp'] * timeBasis[d]['w']
+    return QInterpolatedTime['kpw'] <= interpolated
 
-  interpolateQPrefetch = lambda i,h: QInterpolated
-  generator.addFamily('evaluateAndRotateQAtInterpolationPoints', simpleParameterSpace(4,4), interpolateQGenerator, interpolateQPrefetch)
+  generator.addFamily('evaluateAndRotateQAtTimeInterpolationPoints', simpleParameterSpace(4,4), interpolateQTimeGenerator)
 
   nodalFluxGenerator = lambda i,h: aderdg.extendedQTensor()['kp'] <= aderdg.extendedQTensor()['kp'] + db.V3mTo2nTWDivM[i,h][aderdg.t('kl')] * QInterpolated['lq'] * fluxSolver['qp']
   nodalFluxPrefetch = lambda i,h: aderdg.I
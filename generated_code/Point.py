@@ -40,7 +40,7 @@
 #
   
 import numpy as np
-from yateto import Tensor, Scalar
+from yateto import Tensor, Scalar, simpleParameterSpace
 from multSim import OptionalDimTensor
 
 def addKernels(generator, aderdg):
@@ -85,3 +85,8 @@ def addKernels(generator, aderdg):
   QAtPoint = OptionalDimTensor('QAtPoint', aderdg.Q.optName(), aderdg.Q.optSize(), aderdg.Q.optPos(), (numberOfQuantities,))
   evaluateDOFSAtPoint = QAtPoint['p'] <= aderdg.Q['kp'] * basisFunctionsAtPoint['k']
   generator.add('evaluateDOFSAtPoint', evaluateDOFSAtPoint)
+
+  # time derivatives at the point; the samples of a time step follow from a Vandermonde matrix in time
+  dQAtPoint = [OptionalDimTensor('dQAtPoint({})'.format(d), aderdg.Q.optName(), aderdg.Q.optSize(), aderdg.Q.optPos(), (numberOfQuantities,)) for d in range(aderdg.order)]
+  evaluateDerivativesAtPoint = lambda d: dQAtPoint[d]['p'] <= aderdg.timeDerivatives[d]['kp'] * basisFunctionsAtPoint['k']
+  generator.addFamily('evaluateDerivativesAtPoint', simpleParameterSpace(aderdg.order), evaluateDerivativesAtPoint)
@@ -250,6 +250,7 @@ class LinearADERDG(ADERDGBase):
       generator.add('derivative({})'.format(i), dQ['kp'] <= derivativeSum)
       generator.add('derivativeTaylorExpansion({})'.format(i), self.I['kp'] <= self.I['kp'] + power * dQ['kp'])
       derivatives.append(dQ)
+    self.timeDerivatives = derivatives
 
   def add_include_tensors(self, include_tensors):
     super().add_include_tensors(include_tensors)
@@ -52,6 +52,7 @@ import Plasticity
 import SurfaceDisplacement
 import Point
 import NodalBoundaryConditions
+import Batched
 import memlayout
 
 cmdLineParser = argparse.ArgumentParser()
@@ -63,6 +64,7 @@ cmdLineParser.add_argument('--order', type=int)
 cmdLineParser.add_argument('--numberOfMechanisms', type=int)
 cmdLineParser.add_argument('--memLayout')
 cmdLineParser.add_argument('--multipleSimulations', type=int)
+cmdLineParser.add_argument('--localBatchSize', type=int, default=1)
 cmdLineParser.add_argument('--dynamicRuptureMethod')
 cmdLineParser.add_argument('--PlasticityMethod')
 cmdLineParser.add_argument('--gemm_tools')
@@ -117,6 +119,8 @@ Plasticity.addKernels(g, adg, cmdLineArgs.matricesDir, cmdLineArgs.PlasticityMet
 NodalBoundaryConditions.addKernels(g, adg, include_tensors, cmdLineArgs.matricesDir, cmdLineArgs)
 SurfaceDisplacement.addKernels(g, adg)
 Point.addKernels(g, adg)
+if cmdLineArgs.localBatchSize > 1:
+  Batched.addKernels(NamespacedGenerator(g, namespace="batched"), adg, cmdLineArgs.localBatchSize)
 
 # pick up the user's defined gemm tools
 gemm_tool_list = cmdLineArgs.gemm_tools.replace(" ", "").split(",")
@@ -184,6 +184,7 @@ class Viscoelastic2ADERDG(ADERDGBase):
       derivativeTaylorExpansionAne(d)
     ])
     generator.addFamily('derivativeTaylorExpansionEla', simpleParameterSpace(self.order), derivativeTaylorExpansionEla)
+    self.timeDerivatives = dQ
 
   def add_include_tensors(self, include_tensors):
     super().add_include_tensors(include_tensors)
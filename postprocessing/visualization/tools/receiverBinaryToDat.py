@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+##
+# @file
+# This file is part of SeisSol.
+#
+# @section LICENSE
+# Copyright (c) 2020, SeisSol Group
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Converts the binary receiver output to the ASCII receiver files.
+#
+
+# usage:
+# receiverBinaryToDat.py [--output-prefix <prefix>] <prefix>-receivers-<rank>.bin [...]
+#
+# Recreates the ASCII receiver files (<prefix>-receiver-<id>[-<rank>].dat)
+# from the binary receiver output (SEISSOL_RECEIVER_OUTPUT=binary).
+
+import argparse
+import os
+import re
+import struct
+
+MAGIC = b'SSRECV01'
+
+def readExactly(f, size):
+  data = f.read(size)
+  if len(data) != size:
+    raise EOFError()
+  return data
+
+def convert(fileName, outputPrefix):
+  with open(fileName, 'rb') as f:
+    if f.read(8) != MAGIC:
+      raise ValueError('{} is not a binary receiver file'.format(fileName))
+    numberOfReceivers, ncols, variablesLength = struct.unpack('<3Q', readExactly(f, 24))
+    variables = readExactly(f, variablesLength).decode()
+
+    receivers = []
+    for r in range(numberOfReceivers):
+      pointId, rank, x1, x2, x3 = struct.unpack('<Qq3d', readExactly(f, 40))
+      receivers.append((pointId, rank, (x1, x2, x3)))
+
+    outputs = []
+    for pointId, rank, coordinates in receivers:
+      name = '{}-receiver-{:05d}'.format(outputPrefix, pointId+1)
+      if rank >= 0:
+        name += '-{:05d}'.format(rank)
+      name += '.dat'
+      exists = os.path.exists(name)
+      out = open(name, 'a')
+      if not exists:
+        out.write('TITLE = "Temporal Signal for receiver number {:05d}"\n'.format(pointId+1))
+        out.write(variables + '\n')
+        for d in range(3):
+          out.write('# x{}       {:.12e}\n'.format(d+1, coordinates[d]))
+      outputs.append(out)
+
+    while True:
+      try:
+        readExactly(f, 8) # time of the synchronization point
+      except EOFError:
+        break
+      samples = struct.unpack('<{}Q'.format(numberOfReceivers), readExactly(f, 8*numberOfReceivers))
+      for out, nSamples in zip(outputs, samples):
+        values = struct.unpack('<{}d'.format(nSamples*ncols), readExactly(f, 8*nSamples*ncols))
+        for i in range(nSamples):
+          out.write(''.join('  {:.15e}'.format(v) for v in values[i*ncols:(i+1)*ncols]) + '\n')
+
+    for out in outputs:
+      out.close()
+
+parser = argparse.ArgumentParser(description='Converts the binary receiver output to the ASCII receiver files.')
+parser.add_argument('files', nargs='+', help='binary receiver files')
+parser.add_argument('--output-prefix', help='prefix of the ASCII files (default: prefix of the binary files)')
+args = parser.parse_args()
+
+for fileName in args.files:
+  outputPrefix = args.output_prefix
+  if outputPrefix is None:
+    outputPrefix = re.sub(r'-receivers-\d+\.bin$', '', fileName)
+  convert(fileName, outputPrefix)
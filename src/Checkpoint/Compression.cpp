@@ -0,0 +1,288 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Lossless compression of checkpoint chunks
+ **/
+
+#include <algorithm>
+#include <cstring>
+
+#include "Compression.h"
+
+namespace
+{
+
+/** Minimal length of a match */
+const size_t MIN_MATCH = 4;
+
+/** Maximal distance of a match */
+const size_t MAX_OFFSET = 65535;
+
+/** Number of bits used for the hash table */
+const unsigned int HASH_BITS = 14;
+
+inline uint32_t read32(const unsigned char* p)
+{
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline uint64_t read64(const unsigned char* p)
+{
+	uint64_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline uint32_t hash4(uint32_t value)
+{
+	return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+inline uint64_t rotl(uint64_t value, unsigned int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * Writes the remainder of a length that did not fit into the token
+ */
+inline bool writeLength(size_t length, unsigned char* &op, const unsigned char* end)
+{
+	for (; length >= 255; length -= 255) {
+		if (op >= end)
+			return false;
+		*op++ = 255;
+	}
+	if (op >= end)
+		return false;
+	*op++ = static_cast<unsigned char>(length);
+	return true;
+}
+
+inline bool readLength(size_t &length, const unsigned char* &ip, const unsigned char* end)
+{
+	unsigned char byte;
+	do {
+		if (ip >= end)
+			return false;
+		byte = *ip++;
+		length += byte;
+	} while (byte == 255);
+	return true;
+}
+
+/**
+ * Writes one sequence consisting of literals and an (optional) match
+ */
+inline bool writeSequence(const unsigned char* literals, size_t numLiterals,
+		size_t offset, size_t matchLength,
+		unsigned char* &op, const unsigned char* end)
+{
+	if (op >= end)
+		return false;
+
+	unsigned char* token = op++;
+	*token = static_cast<unsigned char>((numLiterals < 15 ? numLiterals : 15) << 4);
+	if (numLiterals >= 15 && !writeLength(numLiterals - 15, op, end))
+		return false;
+
+	if (static_cast<size_t>(end - op) < numLiterals)
+		return false;
+	if (numLiterals > 0)
+		memcpy(op, literals, numLiterals);
+	op += numLiterals;
+
+	if (matchLength == 0)
+		// Last sequence
+		return true;
+
+	if (end - op < 2)
+		return false;
+	*op++ = static_cast<unsigned char>(offset & 0xFF);
+	*op++ = static_cast<unsigned char>(offset >> 8);
+
+	matchLength -= MIN_MATCH;
+	*token |= static_cast<unsigned char>(matchLength < 15 ? matchLength : 15);
+	if (matchLength >= 15 && !writeLength(matchLength - 15, op, end))
+		return false;
+
+	return true;
+}
+
+}
+
+void seissol::checkpoint::compression::shuffle(const void* in, size_t size, unsigned int typeSize, void* out)
+{
+	const unsigned char* input = static_cast<const unsigned char*>(in);
+	unsigned char* output = static_cast<unsigned char*>(out);
+
+	for (unsigned int j = 0; j < typeSize; j++) {
+		for (size_t i = 0; i < size; i++)
+			output[j*size + i] = input[i*typeSize + j];
+	}
+}
+
+void seissol::checkpoint::compression::unshuffle(const void* in, size_t size, unsigned int typeSize, void* out)
+{
+	const unsigned char* input = static_cast<const unsigned char*>(in);
+	unsigned char* output = static_cast<unsigned char*>(out);
+
+	for (unsigned int j = 0; j < typeSize; j++) {
+		for (size_t i = 0; i < size; i++)
+			output[i*typeSize + j] = input[j*size + i];
+	}
+}
+
+size_t seissol::checkpoint::compression::compress(const unsigned char* in, size_t size,
+		unsigned char* out, size_t capacity)
+{
+	// Position + 1 of the last occurrence of a hash, 0 means empty
+	uint32_t table[1 << HASH_BITS];
+	memset(table, 0, sizeof(table));
+
+	unsigned char* op = out;
+	const unsigned char* const end = out + capacity;
+
+	size_t anchor = 0;
+	size_t ip = 0;
+	size_t misses = 0;
+	while (ip + MIN_MATCH <= size) {
+		const uint32_t value = read32(&in[ip]);
+		const uint32_t h = hash4(value);
+		const size_t candidate = table[h];
+		table[h] = ip + 1;
+
+		if (candidate > 0 && ip - (candidate-1) <= MAX_OFFSET && read32(&in[candidate-1]) == value) {
+			const size_t ref = candidate - 1;
+			size_t length = MIN_MATCH;
+			while (ip + length < size && in[ref + length] == in[ip + length])
+				length++;
+
+			if (!writeSequence(&in[anchor], ip - anchor, ip - ref, length, op, end))
+				return 0;
+
+			ip += length;
+			anchor = ip;
+			misses = 0;
+		} else {
+			// Skip faster through incompressible data
+			ip += 1 + (misses++ >> 6);
+		}
+	}
+
+	if (!writeSequence(&in[anchor], size - anchor, 0, 0, op, end))
+		return 0;
+
+	return op - out;
+}
+
+bool seissol::checkpoint::compression::decompress(const unsigned char* in, size_t size,
+		unsigned char* out, size_t outSize)
+{
+	const unsigned char* ip = in;
+	const unsigned char* const end = in + size;
+	size_t op = 0;
+
+	while (true) {
+		// The stream always ends with a sequence without match
+		if (ip >= end)
+			return false;
+
+		const unsigned char token = *ip++;
+
+		size_t numLiterals = token >> 4;
+		if (numLiterals == 15 && !readLength(numLiterals, ip, end))
+			return false;
+		if (static_cast<size_t>(end - ip) < numLiterals || outSize - op < numLiterals)
+			return false;
+		if (numLiterals > 0)
+			memcpy(&out[op], ip, numLiterals);
+		ip += numLiterals;
+		op += numLiterals;
+
+		if (ip == end)
+			// Last sequence
+			return op == outSize;
+
+		if (end - ip < 2)
+			return false;
+		const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+		ip += 2;
+
+		size_t length = token & 0xF;
+		if (length == 15 && !readLength(length, ip, end))
+			return false;
+		length += MIN_MATCH;
+
+		if (offset == 0 || offset > op || outSize - op < length)
+			return false;
+
+		// The match may overlap with the output, copy whole periods which doubles the
+		// available source in each step
+		const size_t start = op - offset;
+		for (size_t copied = 0; copied < length; ) {
+			const size_t n = std::min(copied + offset, length - copied);
+			memcpy(&out[op + copied], &out[start], n);
+			copied += n;
+		}
+		op += length;
+	}
+}
+
+uint64_t seissol::checkpoint::compression::hash(const void* data, size_t size)
+{
+	const uint64_t PRIME1 = 0x9E3779B97F4A7C15ull;
+	const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+
+	uint64_t h = PRIME2 ^ size;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+		h = rotl(h ^ (read64(&p[i]) * PRIME1), 31) * PRIME2;
+	for (; i < size; i++)
+		h = rotl(h ^ (p[i] * PRIME1), 11) * PRIME2;
+
+	// Final avalanche
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDull;
+	h ^= h >> 33;
+	h *= 0xC4CEB9FE1A85EC53ull;
+	h ^= h >> 33;
+
+	return h;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Lossless compression of checkpoint chunks
+ **/
+
+#ifndef CHECKPOINT_COMPRESSION_H
+#define CHECKPOINT_COMPRESSION_H
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+/**
+ * Lossless compression of checkpoint chunks
+ *
+ * Floating point data is first byte shuffled (all first bytes, then all second bytes, ...)
+ * and then compressed with a simple LZ77 codec. The shuffle moves the sign and exponent
+ * bytes next to each other which makes them compressible.
+ */
+namespace compression
+{
+
+/**
+ * Reorder the bytes of <code>size</code> elements with <code>typeSize</code> bytes each
+ */
+void shuffle(const void* in, size_t size, unsigned int typeSize, void* out);
+
+/**
+ * Inverse of shuffle
+ */
+void unshuffle(const void* in, size_t size, unsigned int typeSize, void* out);
+
+/**
+ * Compress a buffer
+ *
+ * @param capacity The size of the output buffer
+ * @return The size of the compressed data or 0 if it does not fit into <code>capacity</code> bytes
+ */
+size_t compress(const unsigned char* in, size_t size, unsigned char* out, size_t capacity);
+
+/**
+ * Decompress a buffer
+ *
+ * @param outSize The size of the uncompressed data
+ * @return False if the compressed data is corrupt
+ */
+bool decompress(const unsigned char* in, size_t size, unsigned char* out, size_t outSize);
+
+/**
+ * 64 bit hash of a buffer (not cryptographic)
+ */
+uint64_t hash(const void* data, size_t size);
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_COMPRESSION_H
@@ -54,6 +54,18 @@ namespace seissol
 namespace checkpoint
 {
 
+/**
+ * Partition independent identification of a fault face
+ */
+struct FaultFaceKey
+{
+	/** Barycenter of the face, summed up in lexicographic order of the vertices */
+	double barycenter[3];
+
+	/** 1 if this rank holds the plus side of the face, 0 otherwise */
+	int owner;
+};
+
 /**
  * Common interface for fault checkpoints
  */
@@ -72,14 +84,29 @@ private:
 	/** Number of boundary points per side */
 	unsigned int m_numBndGP;
 
+	/** Partition independent keys of the fault faces */
+	const FaultFaceKey* m_faceKeys;
+
 public:
 	Fault(unsigned long identifier)
 		: CheckPoint(identifier),
-		  m_numSides(0), m_numBndGP(0)
+		  m_numSides(0), m_numBndGP(0),
+		  m_faceKeys(0L)
 	{}
 
 	virtual ~Fault() {}
 
+	/**
+	 * Set the keys of the fault faces.
+	 *
+	 * Back-ends that store the fault independent of the partitioning
+	 * use this to order the faces in the file. Must be called before init().
+	 */
+	void setFaceKeys(const FaultFaceKey* faceKeys)
+	{
+		m_faceKeys = faceKeys;
+	}
+
 	/**
 	 * @return True of a valid checkpoint is available
 	 */
@@ -209,6 +236,11 @@ protected:
 		return m_numBndGP;
 	}
 
+	const FaultFaceKey* faceKeys() const
+	{
+		return m_faceKeys;
+	}
+
 	/** Names of the different variables we need to store */
 	static const char* VAR_NAMES[NUM_VARIABLES];
 };
@@ -42,10 +42,25 @@
 
 #include "Manager.h"
 #include "SeisSol.h"
+#include "Initializer/MemoryAllocator.h"
+#include "Parallel/LoopSchedule.h"
+
+/**
+ * Copy a large buffer with all threads
+ */
+template<typename T>
+static void parallelCopy(T* dest, const T* src, unsigned int size)
+{
+	seissol::parallel::forStatic(size, [&](unsigned begin, unsigned end) {
+		memcpy(&dest[begin], &src[begin], (end-begin) * sizeof(T));
+	});
+}
 
 bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
+		const unsigned long* cellIds, unsigned int numCells,
 		double* mu, double* slipRate1, double* slipRate2, double* slip, double* slip1, double* slip2,
 		double* state, double* strength, unsigned int numSides, unsigned int numBndGP,
+		const FaultFaceKey* faceKeys,
 		int &faultTimeStep)
 {
 		if (m_backend == DISABLED) {
@@ -78,17 +93,50 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		m_numDofs = numDofs;
 		m_numDRDofs = numSides * numBndGP;
 
-		id = addBuffer(dofs, numDofs * sizeof(real));
-		assert(id == DOFS);
-		id = addBuffer(mu, m_numDRDofs * sizeof(double));
-		assert(id == DR_DOFS0);
-		addBuffer(slipRate1, m_numDRDofs * sizeof(double));
-		addBuffer(slipRate2, m_numDRDofs * sizeof(double));
-		addBuffer(slip, m_numDRDofs * sizeof(double));
-		addBuffer(slip1, m_numDRDofs * sizeof(double));
-		addBuffer(slip2, m_numDRDofs * sizeof(double));
-		addBuffer(state, m_numDRDofs * sizeof(double));
-		addBuffer(strength, m_numDRDofs * sizeof(double));
+		m_staging = utils::Env::get<int>("SEISSOL_CHECKPOINT_STAGING", 0) != 0;
+		if (m_staging) {
+			// Managed buffers, the data is copied in stage()
+			m_dofs = dofs;
+			m_drDofs[0] = mu;
+			m_drDofs[1] = slipRate1;
+			m_drDofs[2] = slipRate2;
+			m_drDofs[3] = slip;
+			m_drDofs[4] = slip1;
+			m_drDofs[5] = slip2;
+			m_drDofs[6] = state;
+			m_drDofs[7] = strength;
+
+			id = addBuffer(0L, numDofs * sizeof(real));
+			assert(id == DOFS);
+			for (unsigned int i = 0; i < 8; i++)
+				addBuffer(0L, m_numDRDofs * sizeof(double));
+
+			if (utils::Env::get<int>("SEISSOL_CHECKPOINT_STAGING_HUGEPAGES", 0) != 0) {
+				seissol::memory::adviseHugePages(managedBuffer<real*>(DOFS), numDofs * sizeof(real));
+				for (unsigned int i = 0; i < 8; i++)
+					seissol::memory::adviseHugePages(managedBuffer<double*>(DR_DOFS0+i), m_numDRDofs * sizeof(double));
+			}
+
+			logInfo(seissol::MPI::mpi.rank()) << "Checkpoint: Staging enabled";
+		} else {
+			id = addBuffer(dofs, numDofs * sizeof(real));
+			assert(id == DOFS);
+			id = addBuffer(mu, m_numDRDofs * sizeof(double));
+			assert(id == DR_DOFS0);
+			addBuffer(slipRate1, m_numDRDofs * sizeof(double));
+			addBuffer(slipRate2, m_numDRDofs * sizeof(double));
+			addBuffer(slip, m_numDRDofs * sizeof(double));
+			addBuffer(slip1, m_numDRDofs * sizeof(double));
+			addBuffer(slip2, m_numDRDofs * sizeof(double));
+			addBuffer(state, m_numDRDofs * sizeof(double));
+			addBuffer(strength, m_numDRDofs * sizeof(double));
+		}
+
+		// Buffers for the partition independent ids (only required for initialization)
+		id = addSyncBuffer(cellIds, numCells * sizeof(unsigned long));
+		assert(id == CELL_IDS);
+		id = addSyncBuffer(faceKeys, numSides * sizeof(FaultFaceKey));
+		assert(id == FAULT_KEYS);
 
 		//
 		// Initialization for loading checkpoints
@@ -96,6 +144,9 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		waveField->setFilename(m_filename.c_str());
 		fault->setFilename(m_filename.c_str());
 
+		waveField->setCellIds(cellIds, numCells);
+		fault->setFaceKeys(faceKeys);
+
 		int exists = waveField->init(m_header.size(), numDofs, seissol::SeisSol::main.asyncIO().groupSize());
 		exists &= fault->init(numSides, numBndGP,
 			seissol::SeisSol::main.asyncIO().groupSize());
@@ -123,6 +174,8 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		delete fault;
 
 		sendBuffer(FILENAME,  m_filename.size()+1);
+		sendBuffer(CELL_IDS, numCells * sizeof(unsigned long));
+		sendBuffer(FAULT_KEYS, numSides * sizeof(FaultFaceKey));
 
 		// Initialize the executor
 		CheckpointInitParam param;
@@ -132,6 +185,31 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		callInit(param);
 
 		removeBuffer(FILENAME);
+		removeBuffer(CELL_IDS);
+		removeBuffer(FAULT_KEYS);
 
 		return exists;
-}
\ No newline at end of file
+}
+
+void seissol::checkpoint::Manager::stage()
+{
+	SCOREP_USER_REGION("CheckpointManager_stage", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	parallelCopy(managedBuffer<real*>(DOFS), m_dofs, m_numDofs);
+	for (unsigned int i = 0; i < 8; i++) {
+		if (m_numDRDofs > 0)
+			parallelCopy(managedBuffer<double*>(DR_DOFS0+i), m_drDofs[i], m_numDRDofs);
+	}
+}
+
+void seissol::checkpoint::Manager::printStallTime()
+{
+	double stallTime[2] = {m_stallTime, m_maxStallTime};
+#ifdef USE_MPI
+	const int rank = seissol::MPI::mpi.rank();
+	MPI_Reduce((rank == 0 ? MPI_IN_PLACE : stallTime), stallTime, 2, MPI_DOUBLE, MPI_MAX, 0, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+	logInfo(seissol::MPI::mpi.rank()) << "Time checkpoint stall (total, max per checkpoint):"
+		<< stallTime[0] << stallTime[1];
+}
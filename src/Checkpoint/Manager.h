@@ -44,6 +44,7 @@
 #include "Parallel/MPI.h"
 #include "Parallel/Pin.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <string>
@@ -82,6 +83,21 @@ private:
 	/** Number of DR DOFs */
 	unsigned int m_numDRDofs;
 
+	/** Snapshot the data into preallocated buffers before handing them to the executor */
+	bool m_staging;
+
+	/** Pointer to the DOFs (only required for staging) */
+	const real* m_dofs;
+
+	/** Pointers to the DR DOFs (only required for staging) */
+	const double* m_drDofs[8];
+
+	/** Total time the simulation was stalled by checkpointing */
+	double m_stallTime;
+
+	/** Maximum time the simulation was stalled by one checkpoint */
+	double m_maxStallTime;
+
 	/** Checkpoint header */
 	WavefieldHeader m_header;
 
@@ -91,7 +107,9 @@ private:
 public:
 	Manager()
 		: m_backend(DISABLED),
-		  m_numDofs(0), m_numDRDofs(0)
+		  m_numDofs(0), m_numDRDofs(0),
+		  m_staging(false), m_dofs(0L),
+		  m_stallTime(0), m_maxStallTime(0)
 	{
 	}
 
@@ -141,11 +159,16 @@ public:
 	/**
 	 * Initialize checkpointing and load the last checkpoint if present
 	 *
+	 * @param cellIds Global mesh index of each cell in <code>dofs</code>
+	 *  (Wavefield::NO_CELL_ID for duplicated cells)
+	 * @param faceKeys Partition independent keys of the fault faces
 	 * @return True is a checkpoint was loaded, false otherwise
 	 */
 	bool init(real* dofs, unsigned int numDofs,
+			const unsigned long* cellIds, unsigned int numCells,
 			double* mu, double* slipRate1, double* slipRate2, double* slip, double* slip1, double* slip2,
 			double* state, double* strength, unsigned int numSides, unsigned int numBndGP,
+			const FaultFaceKey* faceKeys,
 			int &faultTimeStep);
 
 	/**
@@ -163,6 +186,9 @@ public:
 
 		m_stopwatch.start();
 
+		Stopwatch stallWatch;
+		stallWatch.start();
+
 		const int rank = seissol::MPI::mpi.rank();
 
 		// Set current time
@@ -174,8 +200,14 @@ public:
 		wait();
 		SCOREP_USER_REGION_END(r_wait);
 
+		const double waitTime = stallWatch.split();
+
 		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << '.';
 
+		// Copy the data to the staging buffers
+		if (m_staging)
+			stage();
+
 		// Send buffers
 		sendBuffer(HEADER);
 		sendBuffer(DOFS, m_numDofs * sizeof(real));
@@ -193,7 +225,12 @@ public:
 
 		m_stopwatch.pause();
 
-		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << ". Done.";
+		const double stallTime = stallWatch.split();
+		m_stallTime += stallTime;
+		m_maxStallTime = std::max(m_maxStallTime, stallTime);
+
+		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << ". Done."
+			<< utils::space << "Stalled for" << stallTime << "s (waiting for last:" << waitTime << "s)";
 	}
 
 	/**
@@ -208,6 +245,7 @@ public:
 		wait();
 
 		m_stopwatch.printTime("Time checkpoint frontend:");
+		printStallTime();
 
 		// Cleanup the asynchronous module
 		async::Module<ManagerExecutor, CheckpointInitParam, CheckpointParam>::finalize();
@@ -222,6 +260,15 @@ public:
 	}
 
 private:
+	/**
+	 * Copy the DOFs and the DR DOFs into the managed buffers of the executor
+	 */
+	void stage();
+
+	/**
+	 * Print the total and maximum time the simulation was stalled
+	 */
+	void printStallTime();
 };
 
 }
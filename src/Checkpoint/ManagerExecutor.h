@@ -56,7 +56,9 @@ enum BufferTags {
 	FILENAME = 0,
 	HEADER = 1,
 	DOFS = 2,
-	DR_DOFS0 = 3
+	DR_DOFS0 = 3,
+	CELL_IDS = DR_DOFS0 + 8,
+	FAULT_KEYS = CELL_IDS + 1
 };
 
 /**
@@ -111,6 +113,10 @@ public:
 		m_waveField->setFilename(filename);
 		m_fault->setFilename(filename);
 
+		m_waveField->setCellIds(static_cast<const unsigned long*>(info.buffer(CELL_IDS)),
+			info.bufferSize(CELL_IDS) / sizeof(unsigned long));
+		m_fault->setFaceKeys(static_cast<const FaultFaceKey*>(info.buffer(FAULT_KEYS)));
+
 		m_waveField->init(info.bufferSize(HEADER), info.bufferSize(DOFS) / sizeof(real));
 		m_fault->init(info.bufferSize(DR_DOFS0) / param.numBndGP / sizeof(double), param.numBndGP);
 
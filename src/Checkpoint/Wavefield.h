@@ -75,6 +75,12 @@ private:
 	/** Number of dofs */
 	unsigned long m_numDofs;
 
+	/** Global mesh index of each cell (or NO_CELL_ID for duplicated cells) */
+	const unsigned long* m_cellIds;
+
+	/** Number of cells */
+	unsigned long m_numCells;
+
 	/** Number of (local) iterations we need to save all data (due to the 2GB limit) */
 	unsigned int m_iterations;
 
@@ -89,6 +95,7 @@ public:
 		: CheckPoint(identifier),
 		  m_header(0L),
 		  m_dofs(0L), m_numDofs(0),
+		  m_cellIds(0L), m_numCells(0),
 		  m_iterations(0), m_totalIterations(0),
 		  m_dofsPerIteration((1ul<<30) / sizeof(real))
 	{}
@@ -108,6 +115,21 @@ public:
 		m_header = &header;
 	}
 
+	/**
+	 * Set the global mesh index for each cell in the dofs array.
+	 *
+	 * Back-ends that store the wave field independent of the partitioning
+	 * use this to order the cells in the file. Must be called before init().
+	 *
+	 * @param cellIds The global index of each cell, cells marked with
+	 *  NO_CELL_ID (duplicates of other cells) are neither written nor read
+	 */
+	void setCellIds(const unsigned long* cellIds, unsigned long numCells)
+	{
+		m_cellIds = cellIds;
+		m_numCells = numCells;
+	}
+
 	/**
 	 * Initialize checkpointing
 	 *
@@ -240,6 +262,16 @@ protected:
 		return m_numDofs;
 	}
 
+	const unsigned long* cellIds() const
+	{
+		return m_cellIds;
+	}
+
+	unsigned long numCells() const
+	{
+		return m_numCells;
+	}
+
 	unsigned int iterations() const
 	{
 		return m_iterations;
@@ -254,6 +286,10 @@ protected:
 	{
 		return m_dofsPerIteration;
 	}
+
+public:
+	/** Cell id for cells that should be skipped */
+	static const unsigned long NO_CELL_ID = static_cast<unsigned long>(-1);
 };
 
 }
@@ -44,6 +44,8 @@
 #include <mpi.h>
 
 #include <cassert>
+#include <utility>
+#include <vector>
 
 #include "utils/env.h"
 
@@ -82,12 +84,16 @@ private:
 	/** The MPI data type of the file data */
 	MPI_Datatype m_fileDataType;
 
+	/** The MPI data type of the data in memory (only for global file views) */
+	MPI_Datatype m_memDataType;
+
 public:
 	CheckPoint(unsigned long identifier)
 		: seissol::checkpoint::CheckPoint(identifier),
 		  m_open(false),
 		  m_headerSize(0), m_headerType(MPI_DATATYPE_NULL),
-		  m_fileHeaderType(MPI_DATATYPE_NULL), m_fileDataType(MPI_DATATYPE_NULL)
+		  m_fileHeaderType(MPI_DATATYPE_NULL), m_fileDataType(MPI_DATATYPE_NULL),
+		  m_memDataType(MPI_DATATYPE_NULL)
 	{
 	}
 
@@ -113,6 +119,9 @@ public:
 			if (rank() == 0)
 				MPI_Type_free(&m_fileHeaderType);
 		}
+
+		if (m_memDataType != MPI_DATATYPE_NULL)
+			MPI_Type_free(&m_memDataType);
 	}
 
 protected:
@@ -136,18 +145,7 @@ protected:
 	 */
 	void defineFileView(unsigned long headerSize, unsigned int elemSize, unsigned long numElem, unsigned int numVars = 1)
 	{
-		// Check header size
-		MPI_Aint lb, size;
-		MPI_Type_get_extent(m_headerType, &lb, &size);
-		if (size != static_cast<MPI_Aint>(headerSize))
-			logError() << "Size of C struct and MPI data type do not match.";
-
-		unsigned long align = utils::Env::get<unsigned long>("SEISSOL_CHECKPOINT_ALIGNMENT", 0);
-		if (align > 0) {
-			unsigned int blocks = (headerSize + align - 1) / align;
-			m_headerSize = blocks * align;
-		} else
-			m_headerSize = headerSize;
+		defineHeaderSize(headerSize);
 
 		// Create element type
 		MPI_Datatype elemType;
@@ -186,14 +184,91 @@ protected:
 		delete [] blockLength;
 		delete [] displ;
 
-		// Create the header file type
-		if (rank() == 0) {
-			MPI_Type_contiguous(headerSize, MPI_BYTE, &m_fileHeaderType);
+		defineHeaderView(headerSize);
+	}
 
-			MPI_Type_commit(&m_fileHeaderType);
-		} else
-			// Only first rank write the header
-			m_fileHeaderType = m_fileDataType;
+	/**
+	 * Create a file view where the elements are ordered by a global index
+	 * instead of the rank.
+	 *
+	 * The file contains <code>numVars</code> arrays with <code>numGlobalElems</code>
+	 * elements each. The local element <code>order[i].second</code> is stored at
+	 * position <code>order[i].first</code> in each array. The resulting memory data
+	 * type describes one variable of the local buffer.
+	 *
+	 * @param order Pairs of global and local indices, sorted by the global index
+	 */
+	void defineGlobalFileView(unsigned long headerSize, unsigned int elemSize, unsigned long numGlobalElems,
+			const std::vector<std::pair<unsigned long, unsigned long> > &order, unsigned int numVars = 1)
+	{
+		defineHeaderSize(headerSize);
+
+		createGlobalTypes(elemSize, numGlobalElems, order, numVars, m_fileDataType, m_memDataType);
+
+		defineHeaderView(headerSize);
+	}
+
+	/**
+	 * Create the file and memory data type for a global file view
+	 *
+	 * @see defineGlobalFileView
+	 */
+	void createGlobalTypes(unsigned int elemSize, unsigned long numGlobalElems,
+			const std::vector<std::pair<unsigned long, unsigned long> > &order, unsigned int numVars,
+			MPI_Datatype &fileType, MPI_Datatype &memType) const
+	{
+		MPI_Datatype elemType;
+		MPI_Type_contiguous(elemSize, MPI_BYTE, &elemType);
+
+		// Merge consecutive elements into one block
+		std::vector<int> fileBlockLength;
+		std::vector<MPI_Aint> fileDispl;
+		std::vector<int> memBlockLength;
+		std::vector<MPI_Aint> memDispl;
+		for (unsigned long i = 0; i < order.size(); i++) {
+			if (i > 0 && order[i].first == order[i-1].first + 1) {
+				fileBlockLength.back()++;
+			} else {
+				fileBlockLength.push_back(1);
+				fileDispl.push_back(m_headerSize + order[i].first * elemSize);
+			}
+
+			if (i > 0 && order[i].second == order[i-1].second + 1) {
+				memBlockLength.back()++;
+			} else {
+				memBlockLength.push_back(1);
+				memDispl.push_back(order[i].second * elemSize);
+			}
+		}
+
+		// Repeat the blocks for all variables
+		const unsigned long numBlocks = fileBlockLength.size();
+		fileBlockLength.resize(numBlocks * numVars);
+		fileDispl.resize(numBlocks * numVars);
+		for (unsigned int i = 1; i < numVars; i++) {
+			for (unsigned long j = 0; j < numBlocks; j++) {
+				fileBlockLength[i*numBlocks + j] = fileBlockLength[j];
+				fileDispl[i*numBlocks + j] = fileDispl[j] + i * numGlobalElems * elemSize;
+			}
+		}
+
+		MPI_Type_create_hindexed(fileBlockLength.size(), fileBlockLength.data(), fileDispl.data(),
+			elemType, &fileType);
+		MPI_Type_commit(&fileType);
+
+		MPI_Type_create_hindexed(memBlockLength.size(), memBlockLength.data(), memDispl.data(),
+			elemType, &memType);
+		MPI_Type_commit(&memType);
+
+		MPI_Type_free(&elemType);
+	}
+
+	/**
+	 * @return The MPI data type of the local data for global file views
+	 */
+	MPI_Datatype memDataType() const
+	{
+		return m_memDataType;
 	}
 
 	bool exists()
@@ -287,6 +362,16 @@ protected:
 		return MPI_File_set_view(file, 0, MPI_BYTE, m_fileDataType, const_cast<char*>("native"), MPI_INFO_NULL);
 	}
 
+	/**
+	 * Set a custom data file view
+	 *
+	 * @return The MPI error code
+	 */
+	int setDataView(MPI_File file, MPI_Datatype fileType)
+	{
+		return MPI_File_set_view(file, 0, MPI_BYTE, fileType, const_cast<char*>("native"), MPI_INFO_NULL);
+	}
+
 	/**
 	 * @return The current MPI file
 	 */
@@ -313,6 +398,40 @@ protected:
 	 */
 	virtual bool validate(MPI_File file) = 0;
 
+private:
+	/**
+	 * Check the header data type and compute the aligned header size
+	 */
+	void defineHeaderSize(unsigned long headerSize)
+	{
+		// Check header size
+		MPI_Aint lb, size;
+		MPI_Type_get_extent(m_headerType, &lb, &size);
+		if (size != static_cast<MPI_Aint>(headerSize))
+			logError() << "Size of C struct and MPI data type do not match.";
+
+		unsigned long align = utils::Env::get<unsigned long>("SEISSOL_CHECKPOINT_ALIGNMENT", 0);
+		if (align > 0) {
+			unsigned int blocks = (headerSize + align - 1) / align;
+			m_headerSize = blocks * align;
+		} else
+			m_headerSize = headerSize;
+	}
+
+	/**
+	 * Create the header file type (requires the data file type)
+	 */
+	void defineHeaderView(unsigned long headerSize)
+	{
+		if (rank() == 0) {
+			MPI_Type_contiguous(headerSize, MPI_BYTE, &m_fileHeaderType);
+
+			MPI_Type_commit(&m_fileHeaderType);
+		} else
+			// Only first rank write the header
+			m_fileHeaderType = m_fileDataType;
+	}
+
 protected:
 	static void checkMPIErr(int ret)
 	{
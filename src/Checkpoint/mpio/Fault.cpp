@@ -37,7 +37,11 @@
  * @section DESCRIPTION
  */
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <utility>
+#include <vector>
 
 #include "Fault.h"
 
@@ -49,8 +53,48 @@ bool seissol::checkpoint::mpio::Fault::init(unsigned int numSides, unsigned int
 	if (numSides == 0)
 		return true;
 
-	// Compute total number of cells and local offset
-	setSumOffset(numSides);
+	if (faceKeys() == 0L)
+		logError() << "The MPI-IO checkpoint back-end requires the fault face keys";
+
+	// Collect the keys of all faces owned by some rank
+	std::vector<double> ownedKeys;
+	for (unsigned int i = 0; i < numSides; i++) {
+		if (faceKeys()[i].owner)
+			ownedKeys.insert(ownedKeys.end(), faceKeys()[i].barycenter, faceKeys()[i].barycenter+3);
+	}
+
+	int numKeys = ownedKeys.size();
+	std::vector<int> numAllKeys(partitions());
+	MPI_Allgather(&numKeys, 1, MPI_INT, numAllKeys.data(), 1, MPI_INT, comm());
+	std::vector<int> keyOffsets(partitions()+1, 0);
+	for (int i = 0; i < partitions(); i++)
+		keyOffsets[i+1] = keyOffsets[i] + numAllKeys[i];
+
+	std::vector<std::array<double, 3> > allKeys(keyOffsets[partitions()] / 3);
+	MPI_Allgatherv(ownedKeys.data(), numKeys, MPI_DOUBLE,
+		allKeys.data(), numAllKeys.data(), keyOffsets.data(), MPI_DOUBLE, comm());
+
+	// The position in the sorted list is the index of the face in the file
+	std::sort(allKeys.begin(), allKeys.end());
+	if (std::adjacent_find(allKeys.begin(), allKeys.end()) != allKeys.end())
+		logError() << "Fault faces cannot be identified by their barycenter";
+
+	std::vector<std::pair<unsigned long, unsigned long> > readOrder;
+	std::vector<std::pair<unsigned long, unsigned long> > writeOrder;
+	for (unsigned int i = 0; i < numSides; i++) {
+		std::array<double, 3> key = {{faceKeys()[i].barycenter[0], faceKeys()[i].barycenter[1], faceKeys()[i].barycenter[2]}};
+		std::vector<std::array<double, 3> >::const_iterator pos
+			= std::lower_bound(allKeys.begin(), allKeys.end(), key);
+		if (pos == allKeys.end() || *pos != key)
+			logError() << "Fault face" << i << "is not owned by any rank";
+
+		unsigned long index = pos - allKeys.begin();
+		readOrder.push_back(std::make_pair(index, i));
+		if (faceKeys()[i].owner)
+			writeOrder.push_back(std::make_pair(index, i));
+	}
+	std::sort(readOrder.begin(), readOrder.end());
+	std::sort(writeOrder.begin(), writeOrder.end());
 
 	// Create the header data type
 	MPI_Datatype headerType;
@@ -60,8 +104,10 @@ bool seissol::checkpoint::mpio::Fault::init(unsigned int numSides, unsigned int
 	MPI_Type_create_struct(2, blockLength, displ, types, &headerType);
 	setHeaderType(headerType);
 
-	// Define the file view
-	defineFileView(sizeof(Header), numBndGP * sizeof(double), numSides, NUM_VARIABLES);
+	// Define the file views, we only write the faces we own but read all local faces
+	defineGlobalFileView(sizeof(Header), numBndGP * sizeof(double), allKeys.size(), writeOrder, NUM_VARIABLES);
+	createGlobalTypes(numBndGP * sizeof(double), allKeys.size(), readOrder, NUM_VARIABLES,
+		m_fileReadType, m_memReadType);
 
 	return exists();
 }
@@ -93,9 +139,9 @@ void seissol::checkpoint::mpio::Fault::load(int &timestepFault, double* mu, doub
 	double* data[NUM_VARIABLES] = {mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength};
 
 	// Read data
-	checkMPIErr(setDataView(file));
+	checkMPIErr(setDataView(file, m_fileReadType));
 	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
-		checkMPIErr(MPI_File_read_all(file, data[i], numSides() * numBndGP(), MPI_DOUBLE, MPI_STATUS_IGNORE));
+		checkMPIErr(MPI_File_read_all(file, data[i], 1, m_memReadType, MPI_STATUS_IGNORE));
 
 	// Close the file
 	checkMPIErr(MPI_File_close(&file));
@@ -123,7 +169,7 @@ void seissol::checkpoint::mpio::Fault::write(int timestepFault)
 	checkMPIErr(setDataView(file()));
 
 	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
-		checkMPIErr(MPI_File_write_all(file(), const_cast<double*>(data(i)), numSides() * numBndGP(), MPI_DOUBLE, MPI_STATUS_IGNORE));
+		checkMPIErr(MPI_File_write_all(file(), const_cast<double*>(data(i)), 1, memDataType(), MPI_STATUS_IGNORE));
 
 	EPIK_USER_END(r_write_fault);
 	SCOREP_USER_REGION_END(r_write_fault);
@@ -73,11 +73,18 @@ private:
 		int timestepFault;
 	};
 
+	/** The MPI data type of the file data for reading (includes faces owned by other ranks) */
+	MPI_Datatype m_fileReadType;
+
+	/** The MPI data type of the data in memory for reading */
+	MPI_Datatype m_memReadType;
+
 public:
 	Fault()
 		: seissol::checkpoint::CheckPoint(IDENTIFIER),
 		seissol::checkpoint::Fault(IDENTIFIER),
-		CheckPoint(IDENTIFIER)
+		CheckPoint(IDENTIFIER),
+		m_fileReadType(MPI_DATATYPE_NULL), m_memReadType(MPI_DATATYPE_NULL)
 	{}
 
 	bool init(unsigned int numSides, unsigned int numBndGP,
@@ -97,6 +104,11 @@ public:
 		if (numSides() == 0)
 			return;
 
+		if (m_fileReadType != MPI_DATATYPE_NULL) {
+			MPI_Type_free(&m_fileReadType);
+			MPI_Type_free(&m_memReadType);
+		}
+
 		CheckPoint::close();
 	}
 
@@ -106,7 +118,7 @@ protected:
 	void writeHeader(int timestepFault);
 
 protected:
-	static const unsigned long IDENTIFIER = 0x7A849;
+	static const unsigned long IDENTIFIER = 0x7A84A;
 };
 
 #endif // USE_MPI
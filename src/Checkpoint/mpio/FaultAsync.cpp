@@ -48,9 +48,14 @@ bool seissol::checkpoint::mpio::FaultAsync::init(unsigned int numSides, unsigned
 {
 	bool exists = Fault::init(numSides, numBndGP, groupSize);
 
-	if (numSides != 0)
+	if (numSides != 0) {
 		m_dataCopy = new double[NUM_VARIABLES * numSides * numBndGP];
 
+		MPI_Type_create_hvector(NUM_VARIABLES, 1, numSides * numBndGP * sizeof(double),
+			memDataType(), &m_copyType);
+		MPI_Type_commit(&m_copyType);
+	}
+
 	return exists;
 }
 
@@ -77,7 +82,7 @@ void seissol::checkpoint::mpio::FaultAsync::writePrepare(int timestepFault)
 	SCOREP_USER_REGION_BEGIN(r_write_fault, "checkpoint_write_begin_fault", SCOREP_USER_REGION_TYPE_COMMON);
 
 	checkMPIErr(setDataView(file()));
-	checkMPIErr(MPI_File_write_all_begin(file(), m_dataCopy, numSides() * numBndGP() * NUM_VARIABLES, MPI_DOUBLE));
+	checkMPIErr(MPI_File_write_all_begin(file(), m_dataCopy, 1, m_copyType));
 
 	EPIK_USER_END(r_write_fault);
 	SCOREP_USER_REGION_END(r_write_fault);
@@ -111,6 +116,7 @@ void seissol::checkpoint::mpio::FaultAsync::close()
 		write(0); // Time does not matter
 
 		delete [] m_dataCopy;
+		MPI_Type_free(&m_copyType);
 	}
 
 	Fault::close();
@@ -67,6 +67,9 @@ private:
 	/** Buffer for storing a copy of the data */
 	double* m_dataCopy;
 
+	/** The MPI data type for all variables in the copy */
+	MPI_Datatype m_copyType;
+
 	/** True if a checkpoint was started */
 	bool m_started;
 
@@ -74,7 +77,7 @@ public:
 	FaultAsync()
 		: seissol::checkpoint::CheckPoint(IDENTIFIER),
 		seissol::checkpoint::Fault(IDENTIFIER),
-		m_dataCopy(0L), m_started(false)
+		m_dataCopy(0L), m_copyType(MPI_DATATYPE_NULL), m_started(false)
 	{
 	}
 
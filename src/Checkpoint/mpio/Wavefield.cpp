@@ -39,7 +39,9 @@
 
 #include <mpi.h>
 
-#include "utils/env.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "Wavefield.h"
 #include "Monitoring/instrumentation.fpp"
@@ -47,7 +49,7 @@
 void seissol::checkpoint::mpio::Wavefield::setHeader(seissol::checkpoint::WavefieldHeader &header)
 {
 	seissol::checkpoint::Wavefield::setHeader(header);
-	header.add(m_partitionComp);
+	header.add(m_numCellsComp);
 }
 
 bool seissol::checkpoint::mpio::Wavefield::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
@@ -60,11 +62,24 @@ bool seissol::checkpoint::mpio::Wavefield::init(size_t headerSize, unsigned long
 	MPI_Type_contiguous(headerSize, MPI_BYTE, &headerType);
 	setHeaderType(headerType);
 
-	// Define the file view
-	defineFileView(headerSize, sizeof(real), numDofs);
+	if (numDofs > 0 && cellIds() == 0L)
+		logError() << "The MPI-IO checkpoint back-end requires the global cell ids";
+
+	// Order the cells by the global id, this makes the file independent of the partitioning
+	std::vector<std::pair<unsigned long, unsigned long> > order;
+	order.reserve(numCells());
+	for (unsigned long i = 0; i < numCells(); i++) {
+		if (cellIds()[i] != NO_CELL_ID)
+			order.push_back(std::make_pair(cellIds()[i], i));
+	}
+	std::sort(order.begin(), order.end());
+
+	// Compute the total number of cells
+	setSumOffset(order.size());
 
-	// Large buffers are supported?
-	m_useLargeBuffer = utils::Env::get<int>("SEISSOL_CHECKPOINT_MPIO_LARGE_BUFFER", 1) != 0;
+	// Define the file view
+	unsigned int cellSize = (numCells() > 0 ? numDofs / numCells() : 0) * sizeof(real);
+	defineGlobalFileView(headerSize, cellSize, numTotalElems(), order);
 
 	return exists();
 }
@@ -89,7 +104,7 @@ void seissol::checkpoint::mpio::Wavefield::load(real* dofs)
 
 	// Read dofs
 	checkMPIErr(setDataView(file));
-	checkMPIErr(MPI_File_read_all(file, dofs, numDofs(), MPI_DOUBLE, MPI_STATUS_IGNORE));
+	checkMPIErr(MPI_File_read_all(file, dofs, 1, memDataType(), MPI_STATUS_IGNORE));
 
 	// Close the file
 	checkMPIErr(MPI_File_close(&file));
@@ -99,7 +114,7 @@ void seissol::checkpoint::mpio::Wavefield::initHeader(WavefieldHeader &header)
 {
 	seissol::checkpoint::Wavefield::initHeader(header);
 
-	header.value(m_partitionComp) = partitions();
+	header.value(m_numCellsComp) = numTotalElems();
 }
 
 void seissol::checkpoint::mpio::Wavefield::write(const void* header, size_t headerSize)
@@ -115,29 +130,7 @@ void seissol::checkpoint::mpio::Wavefield::write(const void* header, size_t head
 	SCOREP_USER_REGION_DEFINE(r_write_wavefield);
 	SCOREP_USER_REGION_BEGIN(r_write_wavefield, "checkpoint_write_wavefield", SCOREP_USER_REGION_TYPE_COMMON);
 	checkMPIErr(setDataView(file()));
-
-	unsigned int totalIter = totalIterations();
-	unsigned int iter = iterations();
-	unsigned int count = dofsPerIteration();
-	if (m_useLargeBuffer) {
-		totalIter = (totalIter + sizeof(real) - 1) / sizeof(real);
-		iter = (iter + sizeof(real) - 1) / sizeof(real);
-		count *= sizeof(real);
-	}
-	unsigned long offset = 0;
-	for (unsigned int i = 0; i < totalIter; i++) {
-		if (i == iter-1)
-			// Last iteration
-			count = numDofs() - (iter-1) * count;
-
-		checkMPIErr(MPI_File_write_all(file(), const_cast<real*>(&dofs()[offset]), count, MPI_DOUBLE, MPI_STATUS_IGNORE));
-
-		if (i < iter-1)
-			offset += count;
-		// otherwise we just continue writing the last chunk over and over
-		else if (i != totalIter-1)
-			checkMPIErr(MPI_File_seek(file(), -count * sizeof(real), MPI_SEEK_CUR));
-	}
+	checkMPIErr(MPI_File_write_all(file(), const_cast<real*>(dofs()), 1, memDataType(), MPI_STATUS_IGNORE));
 
 	SCOREP_USER_REGION_END(r_write_wavefield);
 
@@ -163,8 +156,8 @@ bool seissol::checkpoint::mpio::Wavefield::validate(MPI_File file)
 		if (header().identifier() != identifier()) {
 			logWarning() << "Checkpoint identifier does match";
 			result = false;
-		} else if (header().value(m_partitionComp) != partitions()) {
-			logWarning() << "Number of partitions in checkpoint does not match";
+		} else if (header().value(m_numCellsComp) != numTotalElems()) {
+			logWarning() << "Number of cells in checkpoint does not match";
 			result = false;
 		}
 	}
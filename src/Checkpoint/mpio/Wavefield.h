@@ -68,18 +68,14 @@ typedef WavefieldDummy Wavefield;
 class Wavefield : public CheckPoint, virtual public seissol::checkpoint::Wavefield
 {
 private:
-	/** The partition component in the header */
-	DynStruct::Component<int> m_partitionComp;
-
-	/** MPI-IO supports buffer larger > 2 GB */
-	bool m_useLargeBuffer;
+	/** The total number of cells in the header */
+	DynStruct::Component<unsigned long> m_numCellsComp;
 
 public:
 	Wavefield()
 		: seissol::checkpoint::CheckPoint(IDENTIFIER),
 		seissol::checkpoint::Wavefield(IDENTIFIER),
-		CheckPoint(IDENTIFIER),
-		m_useLargeBuffer(true)
+		CheckPoint(IDENTIFIER)
 	{
 	}
 
@@ -105,7 +101,7 @@ protected:
 	void writeHeader(const void* header, size_t headerSize);
 
 protected:
-	static const unsigned long IDENTIFIER = 0x7A3B4;
+	static const unsigned long IDENTIFIER = 0x7A3B5;
 };
 
 #endif // USE_MPI
@@ -43,9 +43,9 @@
 
 #include "WavefieldAsync.h"
 
-bool seissol::checkpoint::mpio::WavefieldAsync::init(unsigned long numDofs, unsigned int groupSize)
+bool seissol::checkpoint::mpio::WavefieldAsync::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
 {
-	bool exists = Wavefield::init(numDofs, groupSize);
+	bool exists = Wavefield::init(headerSize, numDofs, groupSize);
 
 	m_dofsCopy = new real[numDofs];
 
@@ -71,7 +71,7 @@ void seissol::checkpoint::mpio::WavefieldAsync::writePrepare(const void* header,
 
 	checkMPIErr(setDataView(file()));
 
-	checkMPIErr(MPI_File_write_all_begin(file(), m_dofsCopy, numDofs(), MPI_DOUBLE));
+	checkMPIErr(MPI_File_write_all_begin(file(), m_dofsCopy, 1, memDataType()));
 
 	EPIK_USER_END(r_write_wavefield);
 	SCOREP_USER_REGION_END(r_write_wavefield);
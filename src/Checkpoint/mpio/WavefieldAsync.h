@@ -78,7 +78,7 @@ public:
 	{
 	}
 
-	bool init(unsigned long numDofs, unsigned int groupSize = 1);
+	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1);
 
 	void writePrepare(const void* header, size_t headerSize);
 
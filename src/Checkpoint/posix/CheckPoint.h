@@ -46,6 +46,7 @@
 #endif // USE_MPI
 
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
 #include <errno.h>
 #include <fcntl.h>
@@ -213,6 +214,63 @@ protected:
 		return m_alignment;
 	}
 
+	/**
+	 * @return The size rounded up to the next multiple of the alignment
+	 */
+	size_t alignSize(size_t size) const
+	{
+		if (m_alignment)
+			size = (size + m_alignment - 1) / m_alignment * m_alignment;
+		return size;
+	}
+
+	/**
+	 * Allocate a buffer that can be used for (direct) writes
+	 */
+	void* allocBuffer(size_t size) const
+	{
+		void* buffer;
+		if (m_alignment) {
+			if (posix_memalign(&buffer, m_alignment, alignSize(size)) != 0)
+				logError() << "Could not allocate buffer for alignment";
+		} else {
+			buffer = malloc(size);
+		}
+		return buffer;
+	}
+
+	/**
+	 * Write a buffer at a specific position of the file
+	 */
+	static void writeAt(int file, const void* buffer, size_t size, off64_t offset)
+	{
+		const char* b = static_cast<const char*>(buffer);
+		while (size > 0) {
+			ssize_t written = pwrite64(file, b, size, offset);
+			if (written <= 0)
+				checkErr(written, size);
+			b += written;
+			size -= written;
+			offset += written;
+		}
+	}
+
+	/**
+	 * Read a buffer from a specific position of the file
+	 */
+	static void readAt(int file, void* buffer, size_t size, off64_t offset)
+	{
+		char* b = static_cast<char*>(buffer);
+		while (size > 0) {
+			ssize_t readSize = pread64(file, b, size, offset);
+			if (readSize <= 0)
+				checkErr(readSize, size);
+			b += readSize;
+			size -= readSize;
+			offset += readSize;
+		}
+	}
+
 protected:
 	void createFiles()
 	{
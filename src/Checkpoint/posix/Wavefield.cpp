@@ -37,7 +37,15 @@
  * @section DESCRIPTION
  */
 
+#include "Parallel/MPI.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "Wavefield.h"
+#include "Checkpoint/Compression.h"
+#include "Monitoring/Stopwatch.h"
 
 bool seissol::checkpoint::posix::Wavefield::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
 {
@@ -56,28 +64,96 @@ void seissol::checkpoint::posix::Wavefield::load(real* dofs)
 	checkErr(file);
 
 	// Read header
-	checkErr(read(file, header().data(), header().size()), header().size());
-
-	// Skip other processes before this in the group
-	checkErr(lseek64(file, groupOffset() * sizeof(real), SEEK_CUR));
-
-	// Convert to char* to do pointer arithmetic
-	char* buffer = reinterpret_cast<char*>(dofs);
-	unsigned long left = numDofs()*sizeof(real);
-
-	// Read dofs
-	while (left > 0) {
-		unsigned long readSize = read(file, buffer, left);
-		if (readSize <= 0)
-			checkErr(readSize, left);
-		buffer += readSize;
-		left -= readSize;
+	readAt(file, header().data(), header().size(), 0);
+
+	// Read the table
+	uint64_t tableHeader[TABLE_HEADER];
+	readAt(file, tableHeader, sizeof(tableHeader), header().size());
+	const unsigned long totalDofs = tableHeader[0];
+	const unsigned long chunkDofs = tableHeader[1];
+	const size_t slotSize = tableHeader[2];
+	const size_t dataOffset = header().size() + tableHeader[3];
+
+	if (groupOffset() + numDofs() > totalDofs)
+		logError() << "Checkpoint file contains" << totalDofs << "dofs, expected at least"
+			<< (groupOffset() + numDofs());
+
+	const unsigned long numChunks = (totalDofs + chunkDofs - 1) / chunkDofs;
+	std::vector<uint64_t> table(2*numChunks);
+	readAt(file, table.data(), table.size() * sizeof(uint64_t), header().size() + sizeof(tableHeader));
+
+	std::vector<unsigned char> stored(slotSize);
+	std::vector<unsigned char> shuffled(chunkDofs * sizeof(real));
+	std::vector<real> chunk(chunkDofs);
+
+	// Read all chunks that overlap with this rank
+	const unsigned long first = groupOffset();
+	const unsigned long last = groupOffset() + numDofs();
+	for (unsigned long i = first / chunkDofs; i * chunkDofs < last; i++) {
+		const unsigned long chunkFirst = i * chunkDofs;
+		const unsigned long size = std::min(chunkDofs, totalDofs - chunkFirst);
+		const size_t rawSize = size * sizeof(real);
+		const size_t storedSize = table[2*i];
+
+		if (storedSize > rawSize)
+			logError() << "Invalid size of checkpoint chunk" << i;
+
+		readAt(file, &stored[0], storedSize, dataOffset + i * slotSize);
+
+		if (storedSize == rawSize) {
+			memcpy(&chunk[0], &stored[0], rawSize);
+		} else {
+			if (!compression::decompress(&stored[0], storedSize, &shuffled[0], rawSize))
+				logError() << "Could not decompress checkpoint chunk" << i;
+			compression::unshuffle(&shuffled[0], size, sizeof(real), &chunk[0]);
+		}
+
+		if (compression::hash(&chunk[0], rawSize) != table[2*i+1])
+			logError() << "Checkpoint chunk" << i << "is corrupt";
+
+		const unsigned long copyFirst = std::max(first, chunkFirst);
+		const unsigned long copyLast = std::min(last, chunkFirst + size);
+		std::copy(chunk.begin() + (copyFirst - chunkFirst), chunk.begin() + (copyLast - chunkFirst),
+			dofs + (copyFirst - first));
 	}
 
 	// Close the file
 	checkErr(::close(file));
 }
 
+void seissol::checkpoint::posix::Wavefield::initLate(const real* dofs)
+{
+	seissol::checkpoint::Wavefield::initLate(dofs);
+
+	// Chunk boundaries should be aligned in memory and in the file
+	size_t chunkSize = utils::Env::get<size_t>("SEISSOL_CHECKPOINT_CHUNK_SIZE", 4*1024*1024);
+	chunkSize = alignSize(std::max(chunkSize / sizeof(real), static_cast<size_t>(1)) * sizeof(real));
+	if (chunkSize >= (1ul << 32))
+		logError() << "The checkpoint chunk size must be smaller than 4 GiB";
+
+	m_chunkDofs = chunkSize / sizeof(real);
+	m_numChunks = (numDofs() + m_chunkDofs - 1) / m_chunkDofs;
+	m_slotSize = alignSize(m_chunkDofs * sizeof(real));
+	m_tableSize = alignSize((TABLE_HEADER + 2*m_numChunks) * sizeof(uint64_t));
+
+	for (unsigned int i = 0; i < 2; i++) {
+		m_tables[i] = static_cast<uint64_t*>(allocBuffer(m_tableSize));
+		memset(m_tables[i], 0, m_tableSize);
+		m_tables[i][0] = numDofs();
+		m_tables[i][1] = m_chunkDofs;
+		m_tables[i][2] = m_slotSize;
+		m_tables[i][3] = m_tableSize;
+	}
+
+	m_buffer = static_cast<unsigned char*>(allocBuffer(m_slotSize));
+	if (m_compress)
+		m_shuffleBuffer = static_cast<unsigned char*>(malloc(m_chunkDofs * sizeof(real)));
+
+	logInfo(rank()) << "Checkpoint chunk size:" << chunkSize
+		<< "compression:" << (m_compress ? "on" : "off")
+		<< "incremental:" << (m_incremental ? "on" : "off");
+}
+
 void seissol::checkpoint::posix::Wavefield::write(const void* header, size_t headerSize)
 {
 	EPIK_TRACER("CheckPoint_write");
@@ -85,8 +161,8 @@ void seissol::checkpoint::posix::Wavefield::write(const void* header, size_t hea
 
 	logInfo(rank()) << "Checkpoint backend: Writing.";
 
-	// Start at the beginning
-	checkErr(lseek64(file(), 0, SEEK_SET));
+	Stopwatch stopwatch;
+	stopwatch.start();
 
 	// Write the header
 	EPIK_USER_REG(r_write_header, "checkpoint_write_header");
@@ -94,7 +170,7 @@ void seissol::checkpoint::posix::Wavefield::write(const void* header, size_t hea
 	EPIK_USER_START(r_write_header);
 	SCOREP_USER_REGION_BEGIN(r_write_header, "checkpoint_write_header", SCOREP_USER_REGION_TYPE_COMMON);
 
-	checkErr(::write(file(), header, headerSize), headerSize);
+	writeAt(file(), header, headerSize, 0);
 
 	EPIK_USER_END(r_write_header);
 	SCOREP_USER_REGION_END(r_write_header);
@@ -105,21 +181,50 @@ void seissol::checkpoint::posix::Wavefield::write(const void* header, size_t hea
 	EPIK_USER_START(r_write_wavefield);
 	SCOREP_USER_REGION_BEGIN(r_write_wavefield, "checkpoint_write_wavefield", SCOREP_USER_REGION_TYPE_COMMON);
 
-	// Convert to char* to do pointer arithmetic
-	const char* buffer = reinterpret_cast<const char*>(dofs());
-	unsigned long left = numDofs()*sizeof(real);
-	if (alignment()) {
-		left = (left + alignment() - 1) / alignment();
-		left *= alignment();
+	uint64_t* table = m_tables[odd()] + TABLE_HEADER;
+	// Without a complete previous write, the hashes in the table are not valid
+	const bool incremental = m_incremental && m_complete[odd()];
+	const size_t dataOffset = headerSize + m_tableSize;
+
+	unsigned long stat[2] = {headerSize + m_tableSize, 0}; // bytes, chunks
+	for (unsigned long i = 0; i < m_numChunks; i++) {
+		const unsigned long size = std::min(m_chunkDofs, numDofs() - i * m_chunkDofs);
+		const size_t rawSize = size * sizeof(real);
+		const real* chunk = dofs() + i * m_chunkDofs;
+
+		const uint64_t hash = compression::hash(chunk, rawSize);
+		if (incremental && table[2*i+1] == hash)
+			continue;
+		table[2*i+1] = hash;
+
+		const void* buffer = chunk;
+		size_t storedSize = rawSize;
+		if (m_compress) {
+			compression::shuffle(chunk, size, sizeof(real), m_shuffleBuffer);
+			// Only store compressed data if it is smaller
+			const size_t compressedSize = compression::compress(m_shuffleBuffer, rawSize, m_buffer, rawSize-1);
+			if (compressedSize > 0) {
+				buffer = m_buffer;
+				storedSize = compressedSize;
+			}
+		}
+		table[2*i] = storedSize;
+
+		const size_t writeSize = alignSize(storedSize);
+		if (buffer == chunk && writeSize != rawSize) {
+			// Do not read beyond the dofs for the last chunk
+			memcpy(m_buffer, chunk, rawSize);
+			buffer = m_buffer;
+		}
+
+		writeAt(file(), buffer, writeSize, dataOffset + i * m_slotSize);
+
+		stat[0] += writeSize;
+		stat[1]++;
 	}
 
-	while (left > 0) {
-		unsigned long written = ::write(file(), buffer, left);
-		if (written <= 0)
-			checkErr(written, left);
-		buffer += written;
-		left -= written;
-	}
+	writeAt(file(), m_tables[odd()], m_tableSize, headerSize);
+	m_complete[odd()] = true;
 
 	EPIK_USER_END(r_write_wavefield);
 	SCOREP_USER_REGION_END(r_write_wavefield);
@@ -127,5 +232,15 @@ void seissol::checkpoint::posix::Wavefield::write(const void* header, size_t hea
 	// Finalize the checkpoint
 	finalizeCheckpoint();
 
-	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+	double time = stopwatch.stop();
+
+	unsigned long totalChunks = m_numChunks;
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, stat, 2, MPI_UNSIGNED_LONG, MPI_SUM, comm());
+	MPI_Allreduce(MPI_IN_PLACE, &totalChunks, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm());
+	MPI_Allreduce(MPI_IN_PLACE, &time, 1, MPI_DOUBLE, MPI_MAX, comm());
+#endif // USE_MPI
+
+	logInfo(rank()) << "Checkpoint backend: Writing. Done." << stat[0] / (1024.*1024.) << "MiB written,"
+		<< stat[1] << "of" << totalChunks << "chunks in" << time << "s";
 }
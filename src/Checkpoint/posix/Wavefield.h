@@ -40,6 +40,11 @@
 #ifndef CHECKPOINT_POSIX_WAVEFIELD_H
 #define CHECKPOINT_POSIX_WAVEFIELD_H
 
+#include <cstdlib>
+#include <stdint.h>
+
+#include "utils/env.h"
+
 #include "CheckPoint.h"
 #include "Checkpoint/Wavefield.h"
 
@@ -52,24 +57,89 @@ namespace checkpoint
 namespace posix
 {
 
+/**
+ * Wave field checkpoint with one file per rank
+ *
+ * The degrees of freedom are stored in chunks with a fixed slot in the file.
+ * The chunks can be compressed (SEISSOL_CHECKPOINT_COMPRESSION) and
+ * unchanged chunks can be skipped (SEISSOL_CHECKPOINT_INCREMENTAL).
+ *
+ * File layout: header | table | chunk slots
+ * The table contains the total number of dofs, the number of dofs per chunk,
+ * the slot size, the table size and for each chunk the stored size and the hash
+ * of the uncompressed data. A chunk is compressed iff its stored size is smaller
+ * than its uncompressed size.
+ */
 class Wavefield : public CheckPoint, virtual public seissol::checkpoint::Wavefield
 {
+private:
+	/** Compress the chunks */
+	bool m_compress;
+
+	/** Only write chunks that changed since the last checkpoint in the same file */
+	bool m_incremental;
+
+	/** Number of dofs per chunk */
+	unsigned long m_chunkDofs;
+
+	/** Number of chunks */
+	unsigned long m_numChunks;
+
+	/** Size of a chunk slot in the file (in bytes) */
+	size_t m_slotSize;
+
+	/** Size of the table (in bytes) */
+	size_t m_tableSize;
+
+	/** Chunk table for the even and the odd file */
+	uint64_t* m_tables[2];
+
+	/** True if all chunks of the even/odd file have been written */
+	bool m_complete[2];
+
+	/** Buffer for compressed (or aligned) chunks */
+	unsigned char* m_buffer;
+
+	/** Buffer for shuffled chunks */
+	unsigned char* m_shuffleBuffer;
+
 public:
 	Wavefield()
 		: seissol::checkpoint::CheckPoint(IDENTIFIER),
 		seissol::checkpoint::Wavefield(IDENTIFIER),
-		CheckPoint(IDENTIFIER)
+		CheckPoint(IDENTIFIER),
+		m_chunkDofs(0), m_numChunks(0),
+		m_slotSize(0), m_tableSize(0),
+		m_buffer(0L), m_shuffleBuffer(0L)
 	{
+		m_compress = utils::Env::get<int>("SEISSOL_CHECKPOINT_COMPRESSION", 0);
+		m_incremental = utils::Env::get<int>("SEISSOL_CHECKPOINT_INCREMENTAL", 0);
+
+		m_tables[0] = m_tables[1] = 0L;
+		m_complete[0] = m_complete[1] = false;
+	}
+
+	virtual ~Wavefield()
+	{
+		free(m_tables[0]);
+		free(m_tables[1]);
+		free(m_buffer);
+		free(m_shuffleBuffer);
 	}
 
 	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1);
 
 	void load(real* dofs);
 
+	void initLate(const real* dofs);
+
 	void write(const void* header, size_t headerSize);
 
 private:
-	static const unsigned long IDENTIFIER = 0x7A56F;
+	/** Number of values in the table before the chunk entries */
+	static const unsigned int TABLE_HEADER = 4;
+
+	static const unsigned long IDENTIFIER = 0x7A570;
 };
 
 }
@@ -75,6 +75,11 @@ void seissol::kernels::Local::setGlobalData(GlobalData const* global) {
   m_volumeKernelPrototype.kDivM = global->stiffnessMatrices;
   m_localFluxKernelPrototype.rDivM = global->changeOfBasisMatrices;
   m_localFluxKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
+#ifdef LOCAL_BATCH_SIZE
+  m_batchedVolumeKernelPrototype.kDivM = global->stiffnessMatrices;
+  m_batchedLocalFluxKernelPrototype.rDivM = global->changeOfBasisMatrices;
+  m_batchedLocalFluxKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
+#endif
 
   m_nodalLfKrnlPrototype.project2nFaceTo3m = global->project2nFaceTo3m;
 
@@ -230,6 +235,32 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   }
 }
 
+#ifdef LOCAL_BATCH_SIZE
+void seissol::kernels::Local::computeBatchedIntegral(real const*                  i_batchedTimeIntegrated,
+                                                     LocalIntegrationBatch const& i_batch,
+                                                     real*                        io_batchedDofs) {
+  assert(reinterpret_cast<uintptr_t>(i_batchedTimeIntegrated) % ALIGNMENT == 0);
+  assert(reinterpret_cast<uintptr_t>(io_batchedDofs) % ALIGNMENT == 0);
+
+  batched::kernel::volume volKrnl = m_batchedVolumeKernelPrototype;
+  volKrnl.batchedQ = io_batchedDofs;
+  volKrnl.batchedI = i_batchedTimeIntegrated;
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    volKrnl.batchedStar(dim) = i_batch.starMatrices[dim];
+  }
+  volKrnl.execute();
+
+  // the flux solvers of dynamic rupture faces are zero
+  batched::kernel::localFlux lfKrnl = m_batchedLocalFluxKernelPrototype;
+  lfKrnl.batchedQ = io_batchedDofs;
+  lfKrnl.batchedI = i_batchedTimeIntegrated;
+  for (unsigned face = 0; face < 4; ++face) {
+    lfKrnl.batchedAplusT = i_batch.nApNm1[face];
+    lfKrnl.execute(face);
+  }
+}
+#endif
+
 void seissol::kernels::Local::flopsIntegral(FaceType const i_faceTypes[4],
                                             unsigned int &o_nonZeroFlops,
                                             unsigned int &o_hardwareFlops)
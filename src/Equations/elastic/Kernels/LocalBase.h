@@ -60,6 +60,10 @@ class seissol::kernels::LocalBase {
     kernel::volume m_volumeKernelPrototype;
     kernel::localFlux m_localFluxKernelPrototype;
     kernel::localFluxNodal m_nodalLfKrnlPrototype;
+#ifdef LOCAL_BATCH_SIZE
+    batched::kernel::volume m_batchedVolumeKernelPrototype;
+    batched::kernel::localFlux m_batchedLocalFluxKernelPrototype;
+#endif
 
     kernel::projectToNodalBoundary m_projectKrnlPrototype;
     kernel::projectToNodalBoundaryRotated m_projectRotatedKrnlPrototype;
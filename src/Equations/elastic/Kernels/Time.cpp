@@ -112,6 +112,9 @@ void seissol::kernels::Time::setGlobalData(GlobalData const* global) {
   displacementAvgNodalPrototype.V3mTo2nFace = global->V3mTo2nFace;
   displacementAvgNodalPrototype.selectZDisplacementFromQuantities = init::selectZDisplacementFromQuantities::Values;
   displacementAvgNodalPrototype.selectZDisplacementFromDisplacements = init::selectZDisplacementFromDisplacements::Values;
+#ifdef LOCAL_BATCH_SIZE
+  m_batchedKrnlPrototype.kDivMT = global->stiffnessMatricesTransposed;
+#endif
 }
 
 void seissol::kernels::Time::computeAder(double i_timeStepWidth,
@@ -201,6 +204,46 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   }
 }
 
+#ifdef LOCAL_BATCH_SIZE
+void seissol::kernels::Time::computeBatchedAder(double                       i_timeStepWidth,
+                                                LocalIntegrationBatch const& i_batch,
+                                                real const*                  i_batchedDofs,
+                                                real*                        o_batchedTimeIntegrated) {
+  assert(reinterpret_cast<uintptr_t>(i_batchedDofs) % ALIGNMENT == 0);
+  assert(reinterpret_cast<uintptr_t>(o_batchedTimeIntegrated) % ALIGNMENT == 0);
+
+  // the derivatives are not stored, hence we only keep the previous and the current one
+  alignas(PAGESIZE_STACK) real derivativesBuffer[2][tensor::batchedQ::size()];
+
+  batched::kernel::derivative krnl = m_batchedKrnlPrototype;
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    krnl.batchedStar(dim) = i_batch.starMatrices[dim];
+  }
+
+  batched::kernel::derivativeTaylorExpansion intKrnl;
+  intKrnl.batchedI = o_batchedTimeIntegrated;
+  intKrnl.batchedDQ(0) = i_batchedDofs;
+  // powers in the taylor-series expansion
+  intKrnl.power = i_timeStepWidth;
+  intKrnl.execute0();
+
+  real* previousDerivative = const_cast<real*>(i_batchedDofs);
+  for (unsigned der = 1; der < CONVERGENCE_ORDER; ++der) {
+    real* currentDerivative = derivativesBuffer[der % 2];
+    krnl.batchedDQ(der-1) = previousDerivative;
+    krnl.batchedDQ(der) = currentDerivative;
+    krnl.execute(der);
+
+    // update scalar for this derivative
+    intKrnl.power *= i_timeStepWidth / real(der+1);
+    intKrnl.batchedDQ(der) = currentDerivative;
+    intKrnl.execute(der);
+
+    previousDerivative = currentDerivative;
+  }
+}
+#endif
+
 void seissol::kernels::Time::flopsAder( unsigned int        &o_nonZeroFlops,
                                         unsigned int        &o_hardwareFlops ) {
   // reset flops
@@ -83,6 +83,9 @@ class seissol::kernels::TimeBase {
   protected:
     kernel::derivative m_krnlPrototype;
     kernel::displacementAvgNodal displacementAvgNodalPrototype;
+#ifdef LOCAL_BATCH_SIZE
+    batched::kernel::derivative m_batchedKrnlPrototype;
+#endif
     unsigned int m_derivativesOffsets[CONVERGENCE_ORDER];
 
   public:
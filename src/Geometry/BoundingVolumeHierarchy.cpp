@@ -0,0 +1,216 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Bounding volume hierarchy for the point location in tetrahedral meshes.
+ **/
+
+#include "BoundingVolumeHierarchy.h"
+#include "MeshTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace {
+  /** Spreads the lower 21 bits such that two zero bits follow each bit */
+  std::uint64_t spreadBits(std::uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | (x << 32)) & 0x1f00000000ffffULL;
+    x = (x | (x << 16)) & 0x1f0000ff0000ffULL;
+    x = (x | (x << 8))  & 0x100f00f00f00f00fULL;
+    x = (x | (x << 4))  & 0x10c30c30c30c30c3ULL;
+    x = (x | (x << 2))  & 0x1249249249249249ULL;
+    return x;
+  }
+}
+
+seissol::geometry::BoundingVolumeHierarchy::Box seissol::geometry::BoundingVolumeHierarchy::elementBox(unsigned elem) const {
+  Box box;
+  for (unsigned v = 0; v < 4; ++v) {
+    VrtxCoords const& coords = m_vertices[ m_elements[elem].vertices[v] ].coords;
+    for (int d = 0; d < 3; ++d) {
+      box.min[d] = std::min(box.min[d], coords[d]);
+      box.max[d] = std::max(box.max[d], coords[d]);
+    }
+  }
+  // Points on a face may pass the plane test due to round-off but lie marginally outside of the box
+  for (int d = 0; d < 3; ++d) {
+    double tolerance = 1.0e-12 * (std::abs(box.min[d]) + std::abs(box.max[d]) + (box.max[d] - box.min[d]));
+    box.min[d] -= tolerance;
+    box.max[d] += tolerance;
+  }
+  return box;
+}
+
+bool seissol::geometry::BoundingVolumeHierarchy::inside(unsigned elem, double const point[4]) const {
+  // Same arithmetic as the plane equations in the former brute-force search,
+  // such that points on faces are treated identically.
+  for (int face = 0; face < 4; ++face) {
+    VrtxCoords n, p;
+    MeshTools::pointOnPlane(m_elements[elem], face, m_vertices, p);
+    MeshTools::normal(m_elements[elem], face, m_vertices, n);
+
+    double plane[4] = { n[0], n[1], n[2], -MeshTools::dot(n, p) };
+    double result = 0.0;
+    for (unsigned dim = 0; dim < 4; ++dim) {
+      result += plane[dim] * point[dim];
+    }
+    if (result > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+seissol::geometry::BoundingVolumeHierarchy::BoundingVolumeHierarchy( std::vector<Element> const& elements,
+                                                                     std::vector<Vertex> const&  vertices )
+  : m_elements(elements), m_vertices(vertices), m_firstLeaf(0), m_numberOfLeaves(0)
+{
+  unsigned numberOfElements = elements.size();
+  if (numberOfElements == 0) {
+    return;
+  }
+
+  // Bounding box of the domain
+  Box domain;
+  for (auto const& vertex : vertices) {
+    for (int d = 0; d < 3; ++d) {
+      domain.min[d] = std::min(domain.min[d], vertex.coords[d]);
+      domain.max[d] = std::max(domain.max[d], vertex.coords[d]);
+    }
+  }
+  double scale[3];
+  for (int d = 0; d < 3; ++d) {
+    double extent = domain.max[d] - domain.min[d];
+    scale[d] = (extent > 0.0) ? ((1 << 21) - 1) / extent : 0.0;
+  }
+
+  // Sort the elements along the Morton curve
+  std::vector<std::pair<std::uint64_t, unsigned>> codes(numberOfElements);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned elem = 0; elem < numberOfElements; ++elem) {
+    Box box = elementBox(elem);
+    std::uint64_t code = 0;
+    for (int d = 0; d < 3; ++d) {
+      double center = 0.5 * (box.min[d] + box.max[d]);
+      code |= spreadBits(static_cast<std::uint64_t>((center - domain.min[d]) * scale[d])) << d;
+    }
+    codes[elem] = std::make_pair(code, elem);
+  }
+  std::sort(codes.begin(), codes.end());
+
+  m_order.resize(numberOfElements);
+  for (unsigned elem = 0; elem < numberOfElements; ++elem) {
+    m_order[elem] = codes[elem].second;
+  }
+
+  // Complete binary tree over the leaves
+  m_numberOfLeaves = (numberOfElements + LeafSize - 1) / LeafSize;
+  m_firstLeaf = 1;
+  while (m_firstLeaf < m_numberOfLeaves) {
+    m_firstLeaf *= 2;
+  }
+  m_firstLeaf -= 1;
+  m_nodes.resize(2 * m_firstLeaf + 1);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned leaf = 0; leaf < m_numberOfLeaves; ++leaf) {
+    Box box;
+    unsigned end = std::min((leaf+1) * LeafSize, numberOfElements);
+    for (unsigned i = leaf * LeafSize; i < end; ++i) {
+      box.merge(elementBox(m_order[i]));
+    }
+    m_nodes[m_firstLeaf + leaf] = box;
+  }
+
+  // Inner nodes, level by level
+  for (unsigned levelEnd = m_firstLeaf; levelEnd > 0; levelEnd /= 2) {
+    unsigned levelBegin = levelEnd / 2;
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (unsigned node = levelBegin; node < levelEnd; ++node) {
+      Box box = m_nodes[2*node + 1];
+      box.merge(m_nodes[2*node + 2]);
+      m_nodes[node] = box;
+    }
+  }
+}
+
+bool seissol::geometry::BoundingVolumeHierarchy::find(double const point[3], unsigned& meshId) const {
+  if (m_nodes.empty()) {
+    return false;
+  }
+
+  double point1[4] = { point[0], point[1], point[2], 1.0 };
+
+  bool found = false;
+
+  // The depth of the tree is bounded by 32
+  unsigned stack[64];
+  unsigned stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    unsigned node = stack[--stackSize];
+    if (!m_nodes[node].contains(point)) {
+      continue;
+    }
+
+    if (node < m_firstLeaf) {
+      stack[stackSize++] = 2*node + 2;
+      stack[stackSize++] = 2*node + 1;
+    } else {
+      unsigned leaf = node - m_firstLeaf;
+      unsigned end = std::min((leaf+1) * LeafSize, static_cast<unsigned>(m_order.size()));
+      for (unsigned i = leaf * LeafSize; i < end; ++i) {
+        unsigned elem = m_order[i];
+        /* It might actually happen that a point is found in two tetrahedrons
+         * if it lies on the boundary. In this case we assign it to the one
+         * with the smaller meshId. */
+        if ((!found || elem < meshId) && inside(elem, point1)) {
+          found = true;
+          meshId = elem;
+        }
+      }
+    }
+  }
+
+  return found;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Bounding volume hierarchy for the point location in tetrahedral meshes.
+ **/
+
+#ifndef GEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_
+#define GEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_
+
+#include "MeshDefinition.h"
+
+#include <limits>
+#include <vector>
+
+namespace seissol {
+  namespace geometry {
+    class BoundingVolumeHierarchy;
+  }
+}
+
+/**
+ * Bounding volume hierarchy over the axis-aligned bounding boxes of the tetrahedrons.
+ *
+ * The elements are sorted along a Morton curve of their centers and grouped into leaves of
+ * LeafSize elements. The leaves form a complete binary tree (implicit heap layout), such that
+ * the tree is built level by level in parallel.
+ **/
+class seissol::geometry::BoundingVolumeHierarchy {
+  public:
+    //! maximum number of elements per leaf
+    static const unsigned LeafSize = 8;
+
+  private:
+    struct Box {
+      double min[3];
+      double max[3];
+
+      Box() {
+        for (int d = 0; d < 3; ++d) {
+          min[d] = std::numeric_limits<double>::max();
+          max[d] = -std::numeric_limits<double>::max();
+        }
+      }
+
+      void merge(Box const& other) {
+        for (int d = 0; d < 3; ++d) {
+          min[d] = std::min(min[d], other.min[d]);
+          max[d] = std::max(max[d], other.max[d]);
+        }
+      }
+
+      bool contains(double const point[3]) const {
+        return point[0] >= min[0] && point[0] <= max[0]
+            && point[1] >= min[1] && point[1] <= max[1]
+            && point[2] >= min[2] && point[2] <= max[2];
+      }
+    };
+
+    std::vector<Element> const& m_elements;
+    std::vector<Vertex> const&  m_vertices;
+
+    //! element ids in Morton order
+    std::vector<unsigned> m_order;
+
+    //! bounding boxes of all nodes, the leaves start at m_firstLeaf
+    std::vector<Box> m_nodes;
+
+    unsigned m_firstLeaf;
+
+    unsigned m_numberOfLeaves;
+
+    Box elementBox(unsigned elem) const;
+
+    /**
+     * Tests if the point lies inside the tetrahedron (or on its boundary).
+     **/
+    bool inside(unsigned elem, double const point[4]) const;
+
+  public:
+    BoundingVolumeHierarchy(std::vector<Element> const& elements,
+                            std::vector<Vertex> const&  vertices);
+
+    /**
+     * Finds the element containing the point.
+     * If the point lies on the boundary of several elements, the element with the smallest id is returned.
+     *
+     * @param point the point.
+     * @param meshId the element containing the point (only set if found).
+     * @return true if an element contains the point.
+     **/
+    bool find(double const point[3], unsigned& meshId) const;
+};
+
+#endif
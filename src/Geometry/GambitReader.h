@@ -205,6 +205,7 @@ private:
 				assert(static_cast<size_t>(k) < m_elements.size());
 
 				m_elements[k].localId = k;
+				m_elements[k].globalId = i;
 
 				m_mesh >> n; // Element number
 				m_mesh >> t; // Type
@@ -353,6 +354,7 @@ private:
 		for (int i = 0; i < m_nGlobElements; i++) {
 			Element element;
 			element.localId = m_elements.size();
+			element.globalId = i;
 			element.rank = nextRank();
 
 			if (element.rank != m_rank) {
@@ -57,6 +57,8 @@ typedef int ElemFaultTags[4];
 
 struct Element {
 	int localId;
+	/** Index of the element in the (unpartitioned) mesh */
+	unsigned long globalId;
 	ElemVertices vertices;
 	int rank;
 	ElemNeighbors neighbors;
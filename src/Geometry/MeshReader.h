@@ -43,10 +43,12 @@
 
 #include "MeshDefinition.h"
 #include "MeshTools.h"
+#include "BoundingVolumeHierarchy.h"
 
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <memory>
 #include <vector>
 
 class MeshReader
@@ -76,6 +78,9 @@ protected:
 	/** Has a plus fault side */
 	bool m_hasPlusFault;
 
+	/** Bounding volume hierarchy for the point location (built on demand) */
+	mutable std::unique_ptr<seissol::geometry::BoundingVolumeHierarchy> m_boundingVolumeHierarchy;
+
 protected:
 	MeshReader(int rank)
 		: m_rank(rank), m_hasPlusFault(false)
@@ -121,8 +126,19 @@ public:
 		return m_hasPlusFault;
 	}
 
+	/**
+	 * Bounding volume hierarchy over the local elements; built on the first call
+	 */
+	const seissol::geometry::BoundingVolumeHierarchy& boundingVolumeHierarchy() const
+	{
+		if (!m_boundingVolumeHierarchy)
+			m_boundingVolumeHierarchy.reset(new seissol::geometry::BoundingVolumeHierarchy(m_elements, m_vertices));
+		return *m_boundingVolumeHierarchy;
+	}
+
   void displaceMesh(double const displacement[3])
   {
+    m_boundingVolumeHierarchy.reset();
     for (unsigned vertexNo = 0; vertexNo < m_vertices.size(); ++vertexNo) {
       for (unsigned i = 0; i < 3; ++i) {
         m_vertices[vertexNo].coords[i] += displacement[i];
@@ -134,6 +150,7 @@ public:
   // scalingMatrix_ij = scalingMatrix[j][i]
   void scaleMesh(double const scalingMatrix[3][3])
   {
+    m_boundingVolumeHierarchy.reset();
     for (unsigned vertexNo = 0; vertexNo < m_vertices.size(); ++vertexNo) {
       double x = m_vertices[vertexNo].coords[0];
       double y = m_vertices[vertexNo].coords[1];
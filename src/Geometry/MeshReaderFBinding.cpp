@@ -285,7 +285,7 @@ void read_mesh_netcdf_c(int rank, int nProcs, const char* meshfile, bool hasFaul
 }
 
 
-void read_mesh_puml_c(const char* meshfile, const char* checkPointFile, bool hasFault, double const displacement[3], double const scalingMatrix[3][3], char const* easiVelocityModel, int clusterRate)
+void read_mesh_puml_c(const char* meshfile, bool hasFault, double const displacement[3], double const scalingMatrix[3][3], char const* easiVelocityModel, int clusterRate)
 {
 	SCOREP_USER_REGION("read_mesh", SCOREP_USER_REGION_TYPE_FUNCTION);
 
@@ -309,10 +309,11 @@ void read_mesh_puml_c(const char* meshfile, const char* checkPointFile, bool has
 	Stopwatch watch;
 	watch.start();
 
-	bool readPartitionFromFile = seissol::SeisSol::main.simulator().checkPointingEnabled();
+	bool usePartitionCache = seissol::SeisSol::main.simulator().checkPointingEnabled();
 
 	seissol::initializers::time_stepping::LtsWeights ltsWeights(easiVelocityModel, clusterRate);
-	seissol::SeisSol::main.setMeshReader(new seissol::PUMLReader(meshfile, checkPointFile, &ltsWeights, tpwgt, readPartitionFromFile));
+	seissol::SeisSol::main.setMeshReader(new seissol::PUMLReader(meshfile, &ltsWeights, tpwgt, usePartitionCache));
+	seissol::SeisSol::main.timeManager().setPredictedImbalance(ltsWeights.predictedImbalance());
 
 	read_mesh(rank, seissol::SeisSol::main.meshReader(), hasFault, displacement, scalingMatrix);
 
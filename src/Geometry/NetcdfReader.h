@@ -251,6 +251,13 @@ public:
 
 		m_elements.resize(sizes[0]);
 
+		// Netcdf meshes are partitioned in the file, number the elements in partition order
+		unsigned long elementOffset = sizes[0];
+#ifdef USE_MPI
+		MPI_Scan(MPI_IN_PLACE, &elementOffset, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+		elementOffset -= sizes[0];
+
 		ElemVertices* elemVertices = new ElemVertices[maxSize];
 		ElemNeighbors* elemNeighbors = new ElemNeighbors[maxSize];
 		ElemNeighborSides* elemNeighborSides = new ElemNeighborSides[maxSize];
@@ -319,6 +326,7 @@ public:
 		// Copy buffers to elements
 		for (int i = 0; i < sizes[0]; i++) {
 			m_elements[i].localId = i;
+			m_elements[i].globalId = elementOffset + i;
 
 			memcpy(m_elements[i].vertices, &elemVertices[i], sizeof(ElemVertices));
 			memcpy(m_elements[i].neighbors, &elemNeighbors[i], sizeof(ElemNeighbors));
@@ -0,0 +1,175 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Parallel reader for PUML mesh files
+ **/
+
+#include "PUMLFile.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "Parallel/MPI.h"
+
+#include "utils/logger.h"
+
+seissol::PUMLFile::PUMLFile(const std::string &fileName)
+	: m_fileName(fileName), m_bytesRead(0)
+{
+	hid_t plist = H5Pcreate(H5P_FILE_ACCESS);
+	H5Pset_fapl_mpio(plist, MPI::mpi.comm(), MPI_INFO_NULL);
+	m_file = H5Fopen(m_fileName.c_str(), H5F_ACC_RDONLY, plist);
+	H5Pclose(plist);
+	if (m_file < 0)
+		logError() << "Could not open mesh" << m_fileName;
+
+	m_transfer = H5Pcreate(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(m_transfer, H5FD_MPIO_COLLECTIVE);
+
+	hsize_t dims[2];
+	H5Dclose(openDataset("connect", 2, dims));
+	if (dims[1] != 4)
+		logError() << "Data set connect in" << m_fileName << "has the wrong size";
+	m_numTotalCells = dims[0];
+
+	H5Dclose(openDataset("geometry", 2, dims));
+	if (dims[1] != 3)
+		logError() << "Data set geometry in" << m_fileName << "has the wrong size";
+	m_numTotalVertices = dims[0];
+
+	// The first ranks get one additional cell
+	const unsigned long ranks = MPI::mpi.size();
+	const unsigned long rank = MPI::mpi.rank();
+	const unsigned long remainder = m_numTotalCells % ranks;
+	m_numCells = m_numTotalCells / ranks + (rank < remainder ? 1 : 0);
+	m_cellOffset = (m_numTotalCells / ranks) * rank + std::min(rank, remainder);
+}
+
+seissol::PUMLFile::~PUMLFile()
+{
+	H5Pclose(m_transfer);
+	H5Fclose(m_file);
+}
+
+void seissol::PUMLFile::readCells(unsigned long (*cells)[4])
+{
+	readCellRange("connect", H5T_NATIVE_ULONG, 4, cells);
+}
+
+void seissol::PUMLFile::readCellData(const char* name, int* data)
+{
+	readCellRange(name, H5T_NATIVE_INT, 1, data);
+}
+
+void seissol::PUMLFile::readVertices(const std::vector<unsigned long> &vertexIds, double (*coordinates)[3])
+{
+	hsize_t dims[2];
+	hid_t dataset = openDataset("geometry", 2, dims);
+	hid_t filespace = H5Dget_space(dataset);
+
+	// Select runs of consecutive vertices, in increasing order
+	H5Sselect_none(filespace);
+	for (unsigned long i = 0; i < vertexIds.size();) {
+		unsigned long j = i + 1;
+		while (j < vertexIds.size() && vertexIds[j] == vertexIds[j-1] + 1)
+			j++;
+		assert(i == 0 || vertexIds[i] > vertexIds[i-1]);
+
+		hsize_t start[2] = {vertexIds[i], 0};
+		hsize_t count[2] = {j - i, 3};
+		H5Sselect_hyperslab(filespace, i == 0 ? H5S_SELECT_SET : H5S_SELECT_OR, start, 0L, count, 0L);
+
+		i = j;
+	}
+
+	hsize_t dimMem[2] = {vertexIds.size(), 3};
+	hid_t memspace = H5Screate_simple(2, dimMem, 0L);
+	if (vertexIds.empty())
+		H5Sselect_none(memspace);
+
+	read(dataset, H5T_NATIVE_DOUBLE, memspace, filespace, coordinates);
+
+	H5Sclose(memspace);
+	H5Sclose(filespace);
+	H5Dclose(dataset);
+}
+
+hid_t seissol::PUMLFile::openDataset(const char* name, int rank, hsize_t* dims) const
+{
+	hid_t dataset = H5Dopen2(m_file, name, H5P_DEFAULT);
+	if (dataset < 0)
+		logError() << "Could not open data set" << name << "in" << m_fileName;
+
+	hid_t filespace = H5Dget_space(dataset);
+	if (H5Sget_simple_extent_ndims(filespace) != rank)
+		logError() << "Data set" << name << "in" << m_fileName << "has the wrong dimension";
+	H5Sget_simple_extent_dims(filespace, dims, 0L);
+	H5Sclose(filespace);
+
+	return dataset;
+}
+
+void seissol::PUMLFile::readCellRange(const char* name, hid_t type, unsigned int columns, void* data)
+{
+	hsize_t dims[2];
+	hid_t dataset = openDataset(name, columns > 1 ? 2 : 1, dims);
+	if (dims[0] != m_numTotalCells || (columns > 1 && dims[1] != columns))
+		logError() << "Data set" << name << "in" << m_fileName << "has the wrong size";
+
+	hid_t filespace = H5Dget_space(dataset);
+	hsize_t start[2] = {m_cellOffset, 0};
+	hsize_t count[2] = {m_numCells, columns};
+	hid_t memspace = H5Screate_simple(columns > 1 ? 2 : 1, count, 0L);
+	if (m_numCells > 0) {
+		H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, 0L, count, 0L);
+	} else {
+		H5Sselect_none(filespace);
+		H5Sselect_none(memspace);
+	}
+
+	read(dataset, type, memspace, filespace, data);
+
+	H5Sclose(memspace);
+	H5Sclose(filespace);
+	H5Dclose(dataset);
+}
+
+void seissol::PUMLFile::read(hid_t dataset, hid_t type, hid_t memspace, hid_t filespace, void* data)
+{
+	if (H5Dread(dataset, type, memspace, filespace, m_transfer, data) < 0)
+		logError() << "Could not read mesh" << m_fileName;
+
+	m_bytesRead += H5Sget_select_npoints(filespace) * H5Tget_size(type);
+}
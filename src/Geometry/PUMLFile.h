@@ -0,0 +1,151 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Parallel reader for PUML mesh files
+ **/
+
+#ifndef GEOMETRY_PUMLFILE_H
+#define GEOMETRY_PUMLFILE_H
+
+#include <hdf5.h>
+#include <string>
+#include <vector>
+
+namespace seissol
+{
+
+/**
+ * Reads the data sets of a PUML mesh file with parallel HDF5
+ *
+ * Each rank reads a contiguous range of cells. The ranges are computed when the
+ * file is opened: the first <code>numTotalCells % ranks</code> ranks get one
+ * additional cell. Cells and cell data are read with one collective hyperslab
+ * read per data set. Vertices are read sparsely, i.e. only the coordinates of
+ * the requested vertices are read.
+ *
+ * All functions are collective.
+ */
+class PUMLFile
+{
+private:
+	/** Name of the HDF5 file */
+	const std::string m_fileName;
+
+	hid_t m_file;
+
+	/** Collective transfer */
+	hid_t m_transfer;
+
+	unsigned long m_numTotalCells;
+
+	unsigned long m_numTotalVertices;
+
+	/** First cell of this rank */
+	unsigned long m_cellOffset;
+
+	/** Number of cells of this rank */
+	unsigned long m_numCells;
+
+	/** Number of bytes read by this rank */
+	unsigned long m_bytesRead;
+
+public:
+	PUMLFile(const std::string &fileName);
+
+	~PUMLFile();
+
+	unsigned long numTotalCells() const
+	{
+		return m_numTotalCells;
+	}
+
+	unsigned long numTotalVertices() const
+	{
+		return m_numTotalVertices;
+	}
+
+	unsigned long cellOffset() const
+	{
+		return m_cellOffset;
+	}
+
+	unsigned long numCells() const
+	{
+		return m_numCells;
+	}
+
+	unsigned long bytesRead() const
+	{
+		return m_bytesRead;
+	}
+
+	/**
+	 * Read the vertices of the local cells (data set <code>connect</code>)
+	 */
+	void readCells(unsigned long (*cells)[4]);
+
+	/**
+	 * Read an integer value for each local cell (e.g. <code>group</code> or <code>boundary</code>)
+	 */
+	void readCellData(const char* name, int* data);
+
+	/**
+	 * Read the coordinates of some vertices (data set <code>geometry</code>)
+	 *
+	 * @param vertexIds Global ids of the vertices, sorted and unique
+	 * @param coordinates The coordinates of the vertices in the same order
+	 */
+	void readVertices(const std::vector<unsigned long> &vertexIds, double (*coordinates)[3]);
+
+private:
+	/**
+	 * @return The data set and its dimensions
+	 */
+	hid_t openDataset(const char* name, int rank, hsize_t* dims) const;
+
+	/**
+	 * Read the local cells of a data set with <code>columns</code> values per cell
+	 */
+	void readCellRange(const char* name, hid_t type, unsigned int columns, void* data);
+
+	/**
+	 * Read the selected elements of a data set
+	 */
+	void read(hid_t dataset, hid_t type, hid_t memspace, hid_t filespace, void* data);
+};
+
+}
+
+#endif // GEOMETRY_PUMLFILE_H
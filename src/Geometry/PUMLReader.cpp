@@ -39,6 +39,7 @@
 #include <cassert>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "PUML/PUML.h"
 #include "PUML/PartitionMetis.h"
@@ -46,13 +47,15 @@
 #include "PUML/Neighbor.h"
 
 #include "PUMLReader.h"
+#include "PartitionCache.h"
+#include "PUMLFile.h"
 #include "Monitoring/instrumentation.fpp"
+#include "Monitoring/Stopwatch.h"
+#include "Numerical_aux/Statistics.h"
 
 #include "Initializer/time_stepping/LtsWeights.h"
 
-#include <hdf5.h>
-#include <sstream>
-#include <fstream>
+#include "utils/env.h"
 
 class GlobalFaceSorter
 {
@@ -73,7 +76,7 @@ public:
 /**
  * @todo Cleanup this code
  */
-seissol::PUMLReader::PUMLReader(const char *meshFile, const char* checkPointFile, initializers::time_stepping::LtsWeights* ltsWeights, double tpwgt, bool readPartitionFromFile)
+seissol::PUMLReader::PUMLReader(const char *meshFile, initializers::time_stepping::LtsWeights* ltsWeights, double tpwgt, bool usePartitionCache)
 	: MeshReader(MPI::mpi.rank())
 {
 	PUML::TETPUML puml;
@@ -85,7 +88,7 @@ seissol::PUMLReader::PUMLReader(const char *meshFile, const char* checkPointFile
 		generatePUML(puml);
 		ltsWeights->computeWeights(puml);
 	}
-	partition(puml, ltsWeights, tpwgt, meshFile, readPartitionFromFile, checkPointFile);
+	partition(puml, ltsWeights, tpwgt, meshFile, usePartitionCache);
 
 	generatePUML(puml);
 
@@ -98,192 +101,134 @@ void seissol::PUMLReader::read(PUML::TETPUML &puml, const char* meshFile)
 
 	std::string file(meshFile);
 
+	Stopwatch watch;
+	watch.start();
+
 	puml.open((file + ":/connect").c_str(), (file + ":/geometry").c_str());
 	puml.addData((file + ":/group").c_str(), PUML::CELL);
 	puml.addData((file + ":/boundary").c_str(), PUML::CELL);
-}
-
-int seissol::PUMLReader::readPartition(PUML::TETPUML &puml, int* partition, const char* checkPointFile)
-{
-	/*
-	write the partionning array to an hdf5 file using parallel access
-	see https://support.hdfgroup.org/ftp/HDF5/examples/parallel/coll_test.c for more info about the hdf5 functions
-	*/
-	SCOREP_USER_REGION("PUMLReader_readPartition", SCOREP_USER_REGION_TYPE_FUNCTION);
-	const int rank = seissol::MPI::mpi.rank();
-	const int nrank = seissol::MPI::mpi.size();
-	int nPartitionCells = puml.numOriginalCells();
-
-	/* 
-	 Gather number of cells in each nodes. This is necessary to be able to write the data in the correct location
-	*/
-	int *num_cells = new int[nrank];
-	int *offsets = new int[nrank];
-	MPI_Allgather(&nPartitionCells, 1, MPI_INT, num_cells, 1, MPI_INT, MPI::mpi.comm());
-
-	offsets[0] = 0;
-	for (int rk = 1; rk < nrank; ++rk) {
-		offsets[rk] = offsets[rk-1] + num_cells[rk-1];
-	}
-	const hsize_t dimMem[] = {static_cast<hsize_t>(nPartitionCells)};
-
-	/* 
-	 Open file and dataset 
-	*/
-	MPI_Info info  = MPI_INFO_NULL;
-	hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
-	H5Pset_fapl_mpio(plist_id, seissol::MPI::mpi.comm(), info);
-
-	std::ostringstream os;
-	os << checkPointFile<<"_partitions_o" <<CONVERGENCE_ORDER<<"_n"<< nrank << ".h5";
-	std::string fname = os.str();
-
-	std::ifstream ifile(fname.c_str());
-	if (!ifile) { 
-		logInfo(rank) <<fname.c_str()<<"does not exist";
-		return -1;
-	}
-
-	hid_t file = H5Fopen(fname.c_str(), H5F_ACC_RDONLY, plist_id);
-	H5Pclose(plist_id);
-
-	hid_t dataset = H5Dopen2(file, "/partition", H5P_DEFAULT);
-	/* 
-	 Create memspace (portion of filespace) and read collectively the data
-	*/
-	hid_t memspace = H5Screate_simple(1, dimMem, NULL);
-	hid_t filespace = H5Dget_space(dataset);
-
-	hsize_t start[] = {static_cast<hsize_t>(offsets[rank])};
-	hsize_t count[] = {static_cast<hsize_t>(nPartitionCells)};
-	H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, 0L, count, 0L);
 
-	plist_id = H5Pcreate(H5P_DATASET_XFER);
-	H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+	double time = watch.stop();
 
-	int status = H5Dread(dataset, H5T_NATIVE_INT, memspace, filespace, plist_id, partition);
+	// PUML reads a block of cells (connect, group, boundary) and a block of vertices (geometry) on each rank
+	double bytes = puml.numOriginalCells() * (4*sizeof(unsigned long) + 2*sizeof(int))
+		+ puml.numOriginalVertices() * 3*sizeof(double);
+	logRead("PUML", bytes, time);
 
-	if (status<0)
-		logError() << "An error occured when reading the partitionning with HDF5";
-	H5Dclose(dataset);
-	H5Fclose(file);
-
-	logInfo(rank)<<"partitionning was read successfully from "<<fname.c_str();
-	return 0;
+	if (utils::Env::get<int>("SEISSOL_MESH_READ_BENCHMARK", 0))
+		benchmarkRead(meshFile);
 }
 
-
-void seissol::PUMLReader::writePartition(PUML::TETPUML &puml, int* partition, const char *checkPointFile)
+void seissol::PUMLReader::benchmarkRead(const char* meshFile)
 {
-	/*
-	write the partionning array to an hdf5 file using parallel access
-	see https://support.hdfgroup.org/ftp/HDF5/examples/parallel/coll_test.c for more info about the hdf5 functions
-	*/
-	SCOREP_USER_REGION("PUMLReader_writePartition", SCOREP_USER_REGION_TYPE_FUNCTION);
-	const int rank = seissol::MPI::mpi.rank();
-	const int nrank = seissol::MPI::mpi.size();
-	int nPartitionCells = puml.numOriginalCells();
-
-	/* 
-	 Gather number of cells in each nodes. This is necessary to be able to write the data in the correct location
-	*/
-	int *num_cells = new int[nrank];
-	int *offsets = new int[nrank];
-	MPI_Allgather(&nPartitionCells, 1, MPI_INT, num_cells, 1, MPI_INT, MPI::mpi.comm());
-
-	offsets[0] = 0;
-	for (int rk = 1; rk < nrank; ++rk) {
-		offsets[rk] = offsets[rk-1] + num_cells[rk-1];
-	}
-	int nCells = offsets[nrank-1]+num_cells[nrank-1];
-
-	const hsize_t dim[] = {static_cast<hsize_t>(nCells)};
-	const hsize_t dimMem[] = {static_cast<hsize_t>(nPartitionCells)};
+	SCOREP_USER_REGION("PUMLReader_benchmarkRead", SCOREP_USER_REGION_TYPE_FUNCTION);
 
-	/* 
-	 Create file and file space 
-	*/
-	MPI_Info info  = MPI_INFO_NULL;
-	hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
-	H5Pset_fapl_mpio(plist_id, seissol::MPI::mpi.comm(), info);
+	Stopwatch watch;
+	watch.start();
 
-	std::ostringstream os;
-	os << checkPointFile<<"_partitions_o" <<CONVERGENCE_ORDER<<"_n"<< nrank << ".h5";
-	std::string fname = os.str();
+	// Each rank reads a contiguous range of cells and only the vertices of these cells.
+	// The data is not used, PUML reads the mesh itself.
+	PUMLFile file(meshFile);
 
-	hid_t file = H5Fcreate(fname.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
-	H5Pclose(plist_id);
+	std::vector<unsigned long> cells(4 * file.numCells());
+	file.readCells(reinterpret_cast<unsigned long (*)[4]>(cells.data()));
+	std::vector<int> group(file.numCells());
+	file.readCellData("group", group.data());
+	std::vector<int> boundary(file.numCells());
+	file.readCellData("boundary", boundary.data());
 
-	hid_t filespace = H5Screate_simple(1, dim, NULL);
-	hid_t dataset = H5Dcreate(file, "/partition", H5T_NATIVE_INT, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-	H5Sclose(filespace);
+	std::vector<unsigned long> vertexIds(cells);
+	std::sort(vertexIds.begin(), vertexIds.end());
+	vertexIds.erase(std::unique(vertexIds.begin(), vertexIds.end()), vertexIds.end());
+	std::vector<double> coordinates(3 * vertexIds.size());
+	file.readVertices(vertexIds, reinterpret_cast<double (*)[3]>(coordinates.data()));
 
-	/* 
-	 Create memspace (portion of filespace) and write collectively the data
-	*/
-	hid_t memspace = H5Screate_simple(1, dimMem, NULL);
-	filespace = H5Dget_space(dataset);
+	double time = watch.stop();
 
-	hsize_t start[] = {static_cast<hsize_t>(offsets[rank])};
-	hsize_t count[] = {static_cast<hsize_t>(nPartitionCells)};
-	H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, 0L, count, 0L);
-
-	plist_id = H5Pcreate(H5P_DATASET_XFER);
-	H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
-
-	int status = H5Dwrite(dataset, H5T_NATIVE_INT, memspace, filespace, plist_id, partition);
+	logRead("collective reads", file.bytesRead(), time);
+}
 
-	if (status<0)
-		logError() << "An error occured when writing the partitionning with HDF5";
-	H5Dclose(dataset);
-	H5Fclose(file);
+void seissol::PUMLReader::logRead(const char* reader, double bytes, double time)
+{
+	const int rank = MPI::mpi.rank();
+	const auto summary = seissol::statistics::parallelSummary(bytes / (1024.*1024.));
+	const auto bandwidth = seissol::statistics::parallelSummary(bytes / (1024.*1024.) / time);
+	double totalBytes = bytes;
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, &totalBytes, 1, MPI_DOUBLE, MPI_SUM, MPI::mpi.comm());
+	MPI_Allreduce(MPI_IN_PLACE, &time, 1, MPI_DOUBLE, MPI_MAX, MPI::mpi.comm());
+#endif // USE_MPI
+
+	logInfo(rank) << "Read" << totalBytes / (1024.*1024.) << "MiB of the mesh with" << reader << "in" << time
+		<< "s" << utils::nospace << " (" << totalBytes / (1024.*1024.) / time << " MiB/s)";
+	logInfo(rank) << "Mesh MiB read per rank: mean =" << summary.mean
+		<< " std =" << summary.std
+		<< " min =" << summary.min
+		<< " max =" << summary.max;
+	logInfo(rank) << "Mesh MiB/s per rank: mean =" << bandwidth.mean
+		<< " std =" << bandwidth.std
+		<< " min =" << bandwidth.min
+		<< " max =" << bandwidth.max;
 }
 
 void seissol::PUMLReader::partition(  PUML::TETPUML &puml,
                                       initializers::time_stepping::LtsWeights* ltsWeights,
                                       double tpwgt,
                                       const char *meshFile,
-                                      bool readPartitionFromFile,
-                                      const char *checkPointFile )
+                                      bool usePartitionCache )
 {
 	SCOREP_USER_REGION("PUMLReader_partition", SCOREP_USER_REGION_TYPE_FUNCTION);
 
 	int* partition = new int[puml.numOriginalCells()];
 
-  auto partitionMetis = [&] {
-    PUML::TETPartitionMetis metis(puml.originalCells(), puml.numOriginalCells());
 #ifdef USE_MPI
-    double* nodeWeights = new double[seissol::MPI::mpi.size()];
-    MPI_Allgather(&tpwgt, 1, MPI_DOUBLE, nodeWeights, 1, MPI_DOUBLE, seissol::MPI::mpi.comm());
-    double sum = 0.0;
-    for (int rk = 0; rk < seissol::MPI::mpi.size(); ++rk) {
-     sum += nodeWeights[rk];
-    }
-    for (int rk = 0; rk < seissol::MPI::mpi.size(); ++rk) {
-     nodeWeights[rk] /= sum;
-    }
+  std::vector<double> nodeWeights(seissol::MPI::mpi.size());
+  MPI_Allgather(&tpwgt, 1, MPI_DOUBLE, nodeWeights.data(), 1, MPI_DOUBLE, seissol::MPI::mpi.comm());
+  double sum = 0.0;
+  for (int rk = 0; rk < seissol::MPI::mpi.size(); ++rk) {
+   sum += nodeWeights[rk];
+  }
+  for (int rk = 0; rk < seissol::MPI::mpi.size(); ++rk) {
+   nodeWeights[rk] /= sum;
+  }
 #else
-    tpwgt = 1.0;
-    double* nodeWeights = &tpwgt;
+  std::vector<double> nodeWeights(1, 1.0);
 #endif
 
-    metis.partition(partition, ltsWeights->vertexWeights(), ltsWeights->nWeightsPerVertex(), nodeWeights, 1.01);
-
-#ifdef USE_MPI
-    delete[] nodeWeights;
-#endif
+  auto partitionMetis = [&] {
+    PUML::TETPartitionMetis metis(puml.originalCells(), puml.numOriginalCells());
+    // With more than one constraint, METIS balances each of them individually
+    metis.partition(partition, ltsWeights->vertexWeights(), ltsWeights->nWeightsPerVertex(), nodeWeights.data(), 1.01);
   };
 
-  if (readPartitionFromFile) {
-    int status = readPartition(puml, &partition[0], checkPointFile);
-    if (status < 0) {
+  usePartitionCache = utils::Env::get<int>("SEISSOL_PARTITION_CACHE", usePartitionCache);
+  if (usePartitionCache) {
+    // The cells are already distributed (but not yet partitioned) by the weight computation
+    const std::vector<PUML::TETPUML::cell_t> &cells = puml.cells();
+    const std::vector<PUML::TETPUML::vertex_t> &vertices = puml.vertices();
+    std::vector<double> barycenters(3 * cells.size(), 0.0);
+    for (unsigned int i = 0; i < cells.size(); i++) {
+      unsigned int vertLids[4];
+      PUML::Downward::vertices(puml, cells[i], vertLids);
+      for (unsigned int j = 0; j < 4; j++) {
+        for (unsigned int d = 0; d < 3; d++)
+          barycenters[3*i + d] += 0.25 * vertices[vertLids[j]].coordinate()[d];
+      }
+    }
+
+    PartitionCache cache(std::string(meshFile) + ".partitions.h5", puml.numOriginalCells(), puml.originalCells(),
+      reinterpret_cast<const double (*)[3]>(barycenters.data()),
+      ltsWeights->vertexWeights(), ltsWeights->nWeightsPerVertex());
+    if (!cache.read(partition, nodeWeights.data())) {
       partitionMetis();
-      writePartition(puml, partition, checkPointFile);
+      cache.write(partition, nodeWeights.data());
     }
   } else {
     partitionMetis();
   }
 
+  ltsWeights->printImbalance(partition, nodeWeights.data());
+
 	puml.partition(partition);
 	delete [] partition;
 }
@@ -314,6 +259,7 @@ void seissol::PUMLReader::getMesh(const PUML::TETPUML &puml)
 	m_elements.resize(cells.size());
 	for (unsigned int i = 0; i < cells.size(); i++) {
 		m_elements[i].localId = i;
+		m_elements[i].globalId = cells[i].gid();
 
 		// Vertices
 		PUML::Downward::vertices(puml, cells[i], reinterpret_cast<unsigned int*>(m_elements[i].vertices));
@@ -61,7 +61,7 @@ namespace seissol
 class PUMLReader : public MeshReader
 {
 public:
-        PUMLReader(const char* meshFile, const char* checkPointFile, initializers::time_stepping::LtsWeights* ltsWeights = nullptr, double tpwgt = 1.0, bool readPartitionFromFile = false);
+        PUMLReader(const char* meshFile, initializers::time_stepping::LtsWeights* ltsWeights = nullptr, double tpwgt = 1.0, bool usePartitionCache = false);
 
 private:
 	/**
@@ -69,12 +69,22 @@ private:
 	 */
 	void read(PUML::TETPUML &puml, const char* meshFile);
 
+	/**
+	 * Read the mesh again with collective reads of contiguous cell ranges
+	 * and sparse vertex reads (for comparison with PUML)
+	 */
+	void benchmarkRead(const char* meshFile);
+
+	/**
+	 * Print the amount of data read and the bandwidth
+	 */
+	static void logRead(const char* reader, double bytes, double time);
+
 	/**
 	 * Create the partitioning
 	 */
-	void partition(PUML::TETPUML &puml, initializers::time_stepping::LtsWeights* ltsWeights, double tpwgt, const char *meshFile, bool readPartitionFromFile, const char* checkPointFile);
-	int readPartition(PUML::TETPUML &puml, int* partition, const char *checkPointFile);
-	void writePartition(PUML::TETPUML &puml, int* partition, const char *checkPointFile);
+	void partition(PUML::TETPUML &puml, initializers::time_stepping::LtsWeights* ltsWeights, double tpwgt, const char *meshFile, bool usePartitionCache);
+
 	/**
 	 * Generate the PUML data structure
 	 */
@@ -0,0 +1,514 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Cache for mesh partitions
+ **/
+
+#include "Parallel/MPI.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "utils/logger.h"
+
+#include "PartitionCache.h"
+#include "Monitoring/instrumentation.fpp"
+
+const double seissol::PartitionCache::MAX_IMBALANCE = 1.05;
+
+seissol::PartitionCache::PartitionCache(const std::string &fileName, unsigned int numCells, const unsigned long (*cells)[4],
+	const double (*barycenters)[3], const int* vertexWeights, int ncon)
+	: m_fileName(fileName), m_numCells(numCells), m_barycenters(barycenters),
+	m_ncon(ncon), m_weights(numCells * ncon)
+{
+	m_cellOffset = numCells;
+	MPI_Scan(MPI_IN_PLACE, &m_cellOffset, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI::mpi.comm());
+	m_cellOffset -= numCells;
+	m_numTotalCells = numCells;
+	MPI_Allreduce(MPI_IN_PLACE, &m_numTotalCells, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI::mpi.comm());
+
+	// The key does not depend on the distribution of the cells, hence we
+	// combine the hash of each cell with a sum
+	uint64_t hash = 0;
+	for (unsigned int i = 0; i < numCells; i++) {
+		uint64_t cellHash = mix(m_cellOffset + i);
+		for (unsigned int j = 0; j < 4; j++)
+			cellHash = mix(cellHash ^ cells[i][j]);
+		for (int j = 0; j < ncon; j++) {
+			cellHash = mix(cellHash ^ static_cast<uint64_t>(vertexWeights[i*ncon + j]));
+			m_weights[i*ncon + j] = vertexWeights[i*ncon + j];
+		}
+		hash += cellHash;
+	}
+	MPI_Allreduce(MPI_IN_PLACE, &hash, 1, MPI_UINT64_T, MPI_SUM, MPI::mpi.comm());
+	hash = mix(hash ^ mix(m_numTotalCells ^ mix(ncon)));
+
+	char key[17];
+	snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+	m_key = key;
+}
+
+bool seissol::PartitionCache::read(int* partition, const double* nodeWeights)
+{
+	SCOREP_USER_REGION("PartitionCache_read", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	const int rank = MPI::mpi.rank();
+	const int nparts = MPI::mpi.size();
+
+	std::ifstream ifile(m_fileName.c_str());
+	if (!ifile) {
+		logInfo(rank) << "Partition cache" << m_fileName << "does not exist";
+		return false;
+	}
+
+	hid_t plist = H5Pcreate(H5P_FILE_ACCESS);
+	H5Pset_fapl_mpio(plist, MPI::mpi.comm(), MPI_INFO_NULL);
+	hid_t file = H5Fopen(m_fileName.c_str(), H5F_ACC_RDONLY, plist);
+	H5Pclose(plist);
+	if (file < 0) {
+		logWarning(rank) << "Could not open partition cache" << m_fileName;
+		return false;
+	}
+
+	if (H5Lexists(file, m_key.c_str(), H5P_DEFAULT) <= 0) {
+		logInfo(rank) << "No partition for this mesh and these weights found in" << m_fileName;
+		H5Fclose(file);
+		return false;
+	}
+	hid_t group = H5Gopen2(file, m_key.c_str(), H5P_DEFAULT);
+
+	const std::string name = datasetName(nparts, nodeWeights);
+	if (H5Lexists(group, name.c_str(), H5P_DEFAULT) > 0) {
+		readDataset(group, name, partition);
+
+		H5Gclose(group);
+		H5Fclose(file);
+
+		logInfo(rank) << "Read partition for" << nparts << "ranks from" << m_fileName;
+		return true;
+	}
+
+	// Find a partition we can split or merge (only for uniform node weights)
+	int splitFrom = 0;
+	int mergeFrom = std::numeric_limits<int>::max();
+	if (uniform(nparts, nodeWeights)) {
+		H5G_info_t info;
+		H5Gget_info(group, &info);
+		for (hsize_t i = 0; i < info.nlinks; i++) {
+			char linkName[64];
+			H5Lget_name_by_idx(group, ".", H5_INDEX_NAME, H5_ITER_INC, i, linkName, sizeof(linkName), H5P_DEFAULT);
+
+			int cached;
+			char rest;
+			if (sscanf(linkName, "n%d%c", &cached, &rest) != 1 || cached <= 0)
+				// Not a partition with uniform node weights
+				continue;
+
+			if (cached < nparts && nparts % cached == 0)
+				splitFrom = std::max(splitFrom, cached);
+			if (cached > nparts && cached % nparts == 0)
+				mergeFrom = std::min(mergeFrom, cached);
+		}
+	}
+
+	bool found = false;
+	if (splitFrom > 0) {
+		// Splitting keeps the partition boundaries of the cached partition
+		readDataset(group, datasetName(splitFrom, 0L), partition);
+		found = split(partition, splitFrom, nparts / splitFrom);
+
+		if (found)
+			logInfo(rank) << "Derived partition for" << nparts << "ranks from the cached partition for"
+				<< splitFrom << "ranks";
+		else
+			logInfo(rank) << "Splitting the cached partition for" << splitFrom << "ranks does not balance all constraints";
+	}
+	if (!found && mergeFrom < std::numeric_limits<int>::max()) {
+		readDataset(group, datasetName(mergeFrom, 0L), partition);
+		found = merge(partition, mergeFrom, mergeFrom / nparts);
+
+		if (found)
+			logInfo(rank) << "Derived partition for" << nparts << "ranks from the cached partition for"
+				<< mergeFrom << "ranks";
+		else
+			logInfo(rank) << "Merging the cached partition for" << mergeFrom << "ranks does not balance all constraints";
+	}
+	if (!found)
+		logInfo(rank) << "No partition for" << nparts << "ranks found in" << m_fileName;
+
+	H5Gclose(group);
+	H5Fclose(file);
+
+	if (found)
+		write(partition, nodeWeights);
+
+	return found;
+}
+
+void seissol::PartitionCache::write(const int* partition, const double* nodeWeights)
+{
+	SCOREP_USER_REGION("PartitionCache_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	const int rank = MPI::mpi.rank();
+	const int nparts = MPI::mpi.size();
+
+	hid_t plist = H5Pcreate(H5P_FILE_ACCESS);
+	H5Pset_fapl_mpio(plist, MPI::mpi.comm(), MPI_INFO_NULL);
+	std::ifstream ifile(m_fileName.c_str());
+	hid_t file;
+	if (ifile) {
+		ifile.close();
+		file = H5Fopen(m_fileName.c_str(), H5F_ACC_RDWR, plist);
+	} else {
+		file = H5Fcreate(m_fileName.c_str(), H5F_ACC_EXCL, H5P_DEFAULT, plist);
+	}
+	H5Pclose(plist);
+	if (file < 0) {
+		logWarning(rank) << "Could not write partition cache" << m_fileName;
+		return;
+	}
+
+	hid_t group;
+	if (H5Lexists(file, m_key.c_str(), H5P_DEFAULT) > 0)
+		group = H5Gopen2(file, m_key.c_str(), H5P_DEFAULT);
+	else
+		group = H5Gcreate2(file, m_key.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+	const std::string name = datasetName(nparts, nodeWeights);
+	if (H5Lexists(group, name.c_str(), H5P_DEFAULT) <= 0) {
+		const hsize_t dim[] = {m_numTotalCells};
+		hid_t filespace = H5Screate_simple(1, dim, 0L);
+		hid_t dataset = H5Dcreate(group, name.c_str(), H5T_NATIVE_INT, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+		const hsize_t dimMem[] = {m_numCells};
+		hid_t memspace = H5Screate_simple(1, dimMem, 0L);
+
+		hsize_t start[] = {m_cellOffset};
+		hsize_t count[] = {m_numCells};
+		H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, 0L, count, 0L);
+
+		hid_t xfer = H5Pcreate(H5P_DATASET_XFER);
+		H5Pset_dxpl_mpio(xfer, H5FD_MPIO_COLLECTIVE);
+
+		if (H5Dwrite(dataset, H5T_NATIVE_INT, memspace, filespace, xfer, partition) < 0)
+			logWarning(rank) << "Could not write partition to" << m_fileName;
+		else
+			logInfo(rank) << "Added partition for" << nparts << "ranks to" << m_fileName;
+
+		H5Pclose(xfer);
+		H5Sclose(memspace);
+		H5Sclose(filespace);
+		H5Dclose(dataset);
+	}
+
+	H5Gclose(group);
+	H5Fclose(file);
+}
+
+std::string seissol::PartitionCache::datasetName(int nparts, const double* nodeWeights)
+{
+	std::ostringstream name;
+	name << 'n' << nparts;
+
+	if (nodeWeights && !uniform(nparts, nodeWeights)) {
+		uint64_t hash = 0;
+		for (int i = 0; i < nparts; i++)
+			hash = mix(hash ^ static_cast<uint64_t>(std::round(20 * nparts * nodeWeights[i])));
+		name << "_w" << std::hex << hash;
+	}
+
+	return name.str();
+}
+
+bool seissol::PartitionCache::uniform(int nparts, const double* nodeWeights)
+{
+	for (int i = 0; i < nparts; i++) {
+		if (std::round(20 * nparts * nodeWeights[i]) != 20)
+			return false;
+	}
+	return true;
+}
+
+void seissol::PartitionCache::readDataset(hid_t group, const std::string &name, int* partition) const
+{
+	hid_t dataset = H5Dopen2(group, name.c_str(), H5P_DEFAULT);
+	hid_t filespace = H5Dget_space(dataset);
+
+	hsize_t dim;
+	H5Sget_simple_extent_dims(filespace, &dim, 0L);
+	if (dim != m_numTotalCells)
+		logError() << "Partition" << name << "in" << m_fileName << "has the wrong size";
+
+	const hsize_t dimMem[] = {m_numCells};
+	hid_t memspace = H5Screate_simple(1, dimMem, 0L);
+
+	hsize_t start[] = {m_cellOffset};
+	hsize_t count[] = {m_numCells};
+	H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, 0L, count, 0L);
+
+	hid_t xfer = H5Pcreate(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(xfer, H5FD_MPIO_COLLECTIVE);
+
+	if (H5Dread(dataset, H5T_NATIVE_INT, memspace, filespace, xfer, partition) < 0)
+		logError() << "Could not read partition" << name << "from" << m_fileName;
+
+	H5Pclose(xfer);
+	H5Sclose(memspace);
+	H5Sclose(filespace);
+	H5Dclose(dataset);
+}
+
+bool seissol::PartitionCache::split(int* partition, int nparts, int factor) const
+{
+	const unsigned int BISECTION_ITERATIONS = 50;
+	const MPI_Comm comm = MPI::mpi.comm();
+
+	// Balance the sum of the normalized constraints
+	std::vector<double> total(m_ncon, 0.0);
+	for (unsigned int i = 0; i < m_numCells; i++) {
+		for (int j = 0; j < m_ncon; j++)
+			total[j] += m_weights[i*m_ncon + j];
+	}
+	MPI_Allreduce(MPI_IN_PLACE, total.data(), m_ncon, MPI_DOUBLE, MPI_SUM, comm);
+
+	std::vector<double> weights(m_numCells, 0.0);
+	for (unsigned int i = 0; i < m_numCells; i++) {
+		for (int j = 0; j < m_ncon; j++) {
+			if (total[j] > 0.0)
+				weights[i] += m_weights[i*m_ncon + j] / total[j];
+		}
+	}
+
+	// Each piece will become the parts [first, first+count)
+	std::vector<int> first(nparts);
+	std::vector<int> count(nparts, factor);
+	for (int i = 0; i < nparts; i++)
+		first[i] = i * factor;
+
+	std::vector<int> piece(partition, partition + m_numCells);
+
+	while (*std::max_element(count.begin(), count.end()) > 1) {
+		const unsigned int numPieces = first.size();
+
+		// Bounding box of each piece (the maximum is stored negated to use one reduction)
+		std::vector<double> box(6*numPieces, std::numeric_limits<double>::max());
+		for (unsigned int i = 0; i < m_numCells; i++) {
+			for (unsigned int d = 0; d < 3; d++) {
+				box[6*piece[i] + d] = std::min(box[6*piece[i] + d], m_barycenters[i][d]);
+				box[6*piece[i] + 3 + d] = std::min(box[6*piece[i] + 3 + d], -m_barycenters[i][d]);
+			}
+		}
+		MPI_Allreduce(MPI_IN_PLACE, box.data(), box.size(), MPI_DOUBLE, MPI_MIN, comm);
+
+		// Split along the longest axis
+		std::vector<unsigned int> axis(numPieces);
+		std::vector<double> lower(numPieces);
+		std::vector<double> upper(numPieces);
+		for (unsigned int p = 0; p < numPieces; p++) {
+			axis[p] = 0;
+			for (unsigned int d = 1; d < 3; d++) {
+				if (-box[6*p + 3 + d] - box[6*p + d] > -box[6*p + 3 + axis[p]] - box[6*p + axis[p]])
+					axis[p] = d;
+			}
+			lower[p] = box[6*p + axis[p]];
+			upper[p] = -box[6*p + 3 + axis[p]];
+		}
+
+		// Target weight of the lower half
+		std::vector<double> target(numPieces, 0.0);
+		for (unsigned int i = 0; i < m_numCells; i++)
+			target[piece[i]] += weights[i];
+		MPI_Allreduce(MPI_IN_PLACE, target.data(), numPieces, MPI_DOUBLE, MPI_SUM, comm);
+		for (unsigned int p = 0; p < numPieces; p++)
+			target[p] *= static_cast<double>(count[p] / 2) / count[p];
+
+		// Find the split coordinate with a bisection
+		std::vector<double> below(numPieces);
+		for (unsigned int it = 0; it < BISECTION_ITERATIONS; it++) {
+			std::fill(below.begin(), below.end(), 0.0);
+			for (unsigned int i = 0; i < m_numCells; i++) {
+				const int p = piece[i];
+				if (m_barycenters[i][axis[p]] < 0.5 * (lower[p] + upper[p]))
+					below[p] += weights[i];
+			}
+			MPI_Allreduce(MPI_IN_PLACE, below.data(), numPieces, MPI_DOUBLE, MPI_SUM, comm);
+
+			for (unsigned int p = 0; p < numPieces; p++) {
+				if (below[p] < target[p])
+					lower[p] = 0.5 * (lower[p] + upper[p]);
+				else
+					upper[p] = 0.5 * (lower[p] + upper[p]);
+			}
+		}
+
+		// Create the new pieces
+		std::vector<int> newFirst;
+		std::vector<int> newCount;
+		std::vector<int> newIndex(numPieces);
+		for (unsigned int p = 0; p < numPieces; p++) {
+			newIndex[p] = newFirst.size();
+			if (count[p] > 1) {
+				newFirst.push_back(first[p]);
+				newCount.push_back(count[p] / 2);
+				newFirst.push_back(first[p] + count[p] / 2);
+				newCount.push_back(count[p] - count[p] / 2);
+			} else {
+				newFirst.push_back(first[p]);
+				newCount.push_back(1);
+			}
+		}
+
+		for (unsigned int i = 0; i < m_numCells; i++) {
+			const int p = piece[i];
+			if (count[p] > 1 && m_barycenters[i][axis[p]] >= upper[p])
+				piece[i] = newIndex[p] + 1;
+			else
+				piece[i] = newIndex[p];
+		}
+
+		first.swap(newFirst);
+		count.swap(newCount);
+	}
+
+	for (unsigned int i = 0; i < m_numCells; i++)
+		partition[i] = first[piece[i]];
+
+	return imbalance(partition, nparts * factor) <= MAX_IMBALANCE;
+}
+
+bool seissol::PartitionCache::merge(int* partition, int nparts, int factor) const
+{
+	// Centroid of each part (the fourth value is the number of cells)
+	std::vector<double> centroids(4*nparts, 0.0);
+	for (unsigned int i = 0; i < m_numCells; i++) {
+		for (unsigned int d = 0; d < 3; d++)
+			centroids[4*partition[i] + d] += m_barycenters[i][d];
+		centroids[4*partition[i] + 3] += 1.0;
+	}
+	MPI_Allreduce(MPI_IN_PLACE, centroids.data(), centroids.size(), MPI_DOUBLE, MPI_SUM, MPI::mpi.comm());
+	for (int p = 0; p < nparts; p++) {
+		for (unsigned int d = 0; d < 3; d++)
+			centroids[4*p + d] /= std::max(centroids[4*p + 3], 1.0);
+	}
+
+	// All ranks compute the same groups
+	std::vector<int> parts(nparts);
+	for (int p = 0; p < nparts; p++)
+		parts[p] = p;
+	std::vector<int> group(nparts);
+	groupParts(centroids, parts.begin(), parts.end(), factor, 0, group);
+
+	for (unsigned int i = 0; i < m_numCells; i++)
+		partition[i] = group[partition[i]];
+
+	return imbalance(partition, nparts / factor) <= MAX_IMBALANCE;
+}
+
+double seissol::PartitionCache::imbalance(const int* partition, int nparts) const
+{
+	std::vector<double> partWeights(nparts * m_ncon, 0.0);
+	for (unsigned int i = 0; i < m_numCells; i++) {
+		for (int j = 0; j < m_ncon; j++)
+			partWeights[partition[i]*m_ncon + j] += m_weights[i*m_ncon + j];
+	}
+	MPI_Allreduce(MPI_IN_PLACE, partWeights.data(), partWeights.size(), MPI_DOUBLE, MPI_SUM, MPI::mpi.comm());
+
+	double maxImbalance = 1.0;
+	for (int j = 0; j < m_ncon; j++) {
+		double total = 0.0;
+		double maxWeight = 0.0;
+		for (int p = 0; p < nparts; p++) {
+			total += partWeights[p*m_ncon + j];
+			maxWeight = std::max(maxWeight, partWeights[p*m_ncon + j]);
+		}
+		if (total > 0.0)
+			maxImbalance = std::max(maxImbalance, maxWeight * nparts / total);
+	}
+
+	return maxImbalance;
+}
+
+void seissol::PartitionCache::groupParts(const std::vector<double> &centroids, std::vector<int>::iterator first,
+	std::vector<int>::iterator last, int factor, int firstGroup, std::vector<int> &group)
+{
+	const int numGroups = (last - first) / factor;
+	if (numGroups <= 1) {
+		for (std::vector<int>::iterator it = first; it != last; ++it)
+			group[*it] = firstGroup;
+		return;
+	}
+
+	// Split along the longest axis of the bounding box of the centroids
+	double lower[3];
+	double upper[3];
+	std::fill(lower, lower+3, std::numeric_limits<double>::max());
+	std::fill(upper, upper+3, -std::numeric_limits<double>::max());
+	for (std::vector<int>::iterator it = first; it != last; ++it) {
+		for (unsigned int d = 0; d < 3; d++) {
+			lower[d] = std::min(lower[d], centroids[4*(*it) + d]);
+			upper[d] = std::max(upper[d], centroids[4*(*it) + d]);
+		}
+	}
+	unsigned int axis = 0;
+	for (unsigned int d = 1; d < 3; d++) {
+		if (upper[d] - lower[d] > upper[axis] - lower[axis])
+			axis = d;
+	}
+
+	// The lower half gets numGroups/2 groups (ties are broken by the part id)
+	const int lowerGroups = numGroups / 2;
+	std::vector<int>::iterator middle = first + lowerGroups * factor;
+	std::nth_element(first, middle, last, [&centroids, axis](int a, int b) {
+		return centroids[4*a + axis] < centroids[4*b + axis]
+			|| (centroids[4*a + axis] == centroids[4*b + axis] && a < b);
+	});
+
+	groupParts(centroids, first, middle, factor, firstGroup, group);
+	groupParts(centroids, middle, last, factor, firstGroup + lowerGroups, group);
+}
+
+uint64_t seissol::PartitionCache::mix(uint64_t value)
+{
+	value ^= value >> 30;
+	value *= 0xBF58476D1CE4E5B9ull;
+	value ^= value >> 27;
+	value *= 0x94D049BB133111EBull;
+	value ^= value >> 31;
+	return value;
+}
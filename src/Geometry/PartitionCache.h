@@ -0,0 +1,173 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Cache for mesh partitions
+ **/
+
+#ifndef GEOMETRY_PARTITIONCACHE_H
+#define GEOMETRY_PARTITIONCACHE_H
+
+#include <hdf5.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace seissol
+{
+
+/**
+ * Cache for mesh partitions
+ *
+ * The partitions are stored in an HDF5 file next to the mesh. Each partition is
+ * identified by a key, computed from the connectivity of the mesh and the
+ * vertex weights, and by the number of partitions (and the node weights if they
+ * are not uniform). Node weights are compared in steps of 5%.
+ *
+ * If no partition for the requested number of partitions exists, a partition is
+ * derived from a cached partition: Either by recursively bisecting each cached
+ * partition along its longest axis (if the requested number is a multiple) or by
+ * merging groups of cached partitions (if the cached number of partitions is a
+ * multiple). The groups are found by a recursive coordinate bisection of the
+ * centroids of the cached partitions, such that only nearby partitions are merged.
+ * A derived partition is only used if all constraints are balanced up to
+ * MAX_IMBALANCE.
+ */
+class PartitionCache
+{
+public:
+	/** Maximal imbalance (per constraint) of a derived partition */
+	static const double MAX_IMBALANCE;
+
+private:
+	/** Name of the HDF5 file */
+	const std::string m_fileName;
+
+	/** Number of local cells */
+	const unsigned int m_numCells;
+
+	/** Global index of the first local cell */
+	unsigned long m_cellOffset;
+
+	/** Total number of cells */
+	unsigned long m_numTotalCells;
+
+	/** Barycenters of the local cells */
+	const double (*m_barycenters)[3];
+
+	/** Number of constraints */
+	const int m_ncon;
+
+	/** Weights of each local cell (<code>m_ncon</code> per cell) */
+	std::vector<double> m_weights;
+
+	/** Key of the mesh and the weights */
+	std::string m_key;
+
+public:
+	/**
+	 * @param cells The global vertex ids of the local cells
+	 * @param vertexWeights Weights of the local cells (<code>ncon</code> per cell)
+	 */
+	PartitionCache(const std::string &fileName, unsigned int numCells, const unsigned long (*cells)[4],
+		const double (*barycenters)[3], const int* vertexWeights, int ncon);
+
+	/**
+	 * Read or derive a partition for the current number of ranks
+	 *
+	 * A derived partition is added to the cache.
+	 *
+	 * @param nodeWeights The relative weight of each rank
+	 * @return True if a partition was found
+	 */
+	bool read(int* partition, const double* nodeWeights);
+
+	/**
+	 * Add a partition for the current number of ranks to the cache
+	 */
+	void write(const int* partition, const double* nodeWeights);
+
+	/**
+	 * Split each part of the partition into <code>factor</code> parts
+	 *
+	 * Each part is bisected recursively along its longest axis. The sum of the
+	 * normalized constraints is balanced.
+	 *
+	 * @return False if a constraint is not balanced (the partition is modified anyway)
+	 */
+	bool split(int* partition, int nparts, int factor) const;
+
+	/**
+	 * Merge groups of <code>factor</code> parts
+	 *
+	 * @return False if a constraint is not balanced (the partition is modified anyway)
+	 */
+	bool merge(int* partition, int nparts, int factor) const;
+
+	/**
+	 * @return The maximal imbalance of all constraints (maximal weight of a part
+	 *  divided by the average weight)
+	 */
+	double imbalance(const int* partition, int nparts) const;
+
+private:
+	/**
+	 * @return The name of the data set for a number of partitions
+	 */
+	static std::string datasetName(int nparts, const double* nodeWeights);
+
+	/**
+	 * @return True if all node weights are the same
+	 */
+	static bool uniform(int nparts, const double* nodeWeights);
+
+	void readDataset(hid_t group, const std::string &name, int* partition) const;
+
+	/**
+	 * Recursive coordinate bisection of parts into groups of <code>factor</code> parts
+	 *
+	 * @param centroids The centroids of all parts
+	 * @param first The first part that is assigned to a group
+	 * @param last The end of the parts that are assigned to a group
+	 * @param group The group of each part
+	 */
+	static void groupParts(const std::vector<double> &centroids, std::vector<int>::iterator first,
+		std::vector<int>::iterator last, int factor, int firstGroup, std::vector<int> &group);
+
+	static uint64_t mix(uint64_t value);
+};
+
+}
+
+#endif // GEOMETRY_PARTITIONCACHE_H
@@ -73,7 +73,7 @@ public:
 
     MeshRefiner(const std::vector<const Element *>& subElements,
             const std::vector<const Vertex *>& subVertices,
-            const std::map<int, int>& oldToNewVertexMap,
+            const std::vector<unsigned int>& oldToNewVertexMap,
             const TetrahedronRefiner<T>& tetRefiner);
 
     ~MeshRefiner();
@@ -175,7 +175,7 @@ template<typename T>
 MeshRefiner<T>::MeshRefiner(
             const std::vector<const Element *>& subElements,
             const std::vector<const Vertex *>& subVertices,
-            const std::map<int, int>& oldToNewVertexMap,
+            const std::vector<unsigned int>& oldToNewVertexMap,
         	const TetrahedronRefiner<T>& tetRefiner)
 		: kSubCellsPerCell(tetRefiner.getDivisionCount())
 
@@ -208,7 +208,7 @@ MeshRefiner<T>::MeshRefiner(
 
     // Start the actual cell-refinement
 #ifdef _OPENMP
-    #pragma omp parallel shared(oldToNewVertexMap)
+    #pragma omp parallel
     {
 #endif // _OPENMPI
     	Eigen::Matrix<T, 3, 1>* newVerticesTmp = new Eigen::Matrix<T, 3, 1>[additionalVertices];
@@ -221,14 +221,14 @@ MeshRefiner<T>::MeshRefiner(
         {
             // Build a Terahedron containing the coordinates of the vertices.
             Tetrahedron<T> inTet = Tetrahedron<T>(
-                    kVertices[oldToNewVertexMap.at(kElements[c]->vertices[0])]->coords,
-                    kVertices[oldToNewVertexMap.at(kElements[c]->vertices[1])]->coords,
-                    kVertices[oldToNewVertexMap.at(kElements[c]->vertices[2])]->coords,
-                    kVertices[oldToNewVertexMap.at(kElements[c]->vertices[3])]->coords,
-    				oldToNewVertexMap.at(kElements[c]->vertices[0]),
-    				oldToNewVertexMap.at(kElements[c]->vertices[1]),
-    				oldToNewVertexMap.at(kElements[c]->vertices[2]),
-    				oldToNewVertexMap.at(kElements[c]->vertices[3]));
+                    kVertices[oldToNewVertexMap[kElements[c]->vertices[0]]]->coords,
+                    kVertices[oldToNewVertexMap[kElements[c]->vertices[1]]]->coords,
+                    kVertices[oldToNewVertexMap[kElements[c]->vertices[2]]]->coords,
+                    kVertices[oldToNewVertexMap[kElements[c]->vertices[3]]]->coords,
+    				oldToNewVertexMap[kElements[c]->vertices[0]],
+    				oldToNewVertexMap[kElements[c]->vertices[1]],
+    				oldToNewVertexMap[kElements[c]->vertices[2]],
+    				oldToNewVertexMap[kElements[c]->vertices[3]]);
 
             // Generate the tets
             tetRefiner.refine(inTet,
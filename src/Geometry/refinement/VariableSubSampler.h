@@ -62,6 +62,9 @@ class VariableSubsampler
 private:
     std::vector<basisFunction::SampledBasisFunctions<T> > m_BasisFunctions;
 
+    /** The sampled basis functions, one row per subcell */
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> m_basisMatrix;
+
     /** The original number of cells (without refinement) */
     const unsigned int m_numCells;
 
@@ -92,6 +95,15 @@ public:
 
     void get(const double* inData, const unsigned int* cellMap,
             int variable, double* outData) const;
+
+    /**
+     * Evaluates all variables of a cell at once
+     *
+     * @param outData The output array for each variable. Variables with
+     *  a null pointer are not stored.
+     */
+    void getAll(const double* inData, const unsigned int* cellMap,
+            double* const* outData) const;
 };
 
 //------------------------------------------------------------------------------
@@ -122,6 +134,12 @@ VariableSubsampler<T>::VariableSubsampler(
                     order, pnt(0), pnt(1), pnt(2)));
     }
 
+    m_basisMatrix.resize(kSubCellsPerCell, m_BasisFunctions[0].getSize());
+    for (unsigned int i = 0; i < kSubCellsPerCell; i++) {
+        for (unsigned int j = 0; j < m_BasisFunctions[i].getSize(); j++)
+            m_basisMatrix(i, j) = m_BasisFunctions[i].m_data[j];
+    }
+
     delete [] subCells;
     delete [] additionalVertices;
 }
@@ -146,6 +164,43 @@ void VariableSubsampler<T>::get(const double* inData,  const unsigned int* cellM
 
 //------------------------------------------------------------------------------
 
+template<typename T>
+void VariableSubsampler<T>::getAll(const double* inData, const unsigned int* cellMap,
+        double* const* outData) const
+{
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> Matrix;
+
+    const unsigned int numBasisFunctions = m_basisMatrix.cols();
+    assert(numBasisFunctions <= kNumAlignedDOF);
+
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+        Matrix subcellValues(kSubCellsPerCell, kNumVariables);
+
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for (unsigned int c = 0; c < m_numCells; ++c) {
+            // The degrees of freedom of all variables (one per column)
+            const Eigen::Map<const Matrix, Eigen::Unaligned, Eigen::OuterStride<> > dofs(
+                    &inData[getInVarOffset(c, 0, cellMap)], numBasisFunctions, kNumVariables,
+                    Eigen::OuterStride<>(kNumAlignedDOF));
+
+            subcellValues.noalias() = m_basisMatrix * dofs;
+
+            for (unsigned int v = 0; v < kNumVariables; ++v) {
+                if (outData[v])
+                    std::copy_n(subcellValues.col(v).data(), kSubCellsPerCell,
+                            &outData[v][getOutVarOffset(c, 0)]);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace
 }
 
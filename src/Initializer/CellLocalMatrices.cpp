@@ -413,6 +413,8 @@ void seissol::initializers::initializeDynamicRuptureMatrices( MeshReader const&
       }
       real* timeDerivative1 = NULL;
       real* timeDerivative2 = NULL;
+      // the face neighbor may be a ghost cell stored in reduced precision
+      bool timeDerivative2Reduced = false;
       for (unsigned duplicate = 0; duplicate < Lut::MaxDuplicates; ++duplicate) {
         unsigned ltsId = i_ltsLut->ltsId(i_lts->cellInformation.mask, derivativesMeshId, duplicate);
         if (timeDerivative1 == NULL && (cellInformation[ltsId].ltsSetup >> 9)%2 == 1) {
@@ -420,6 +422,7 @@ void seissol::initializers::initializeDynamicRuptureMatrices( MeshReader const&
         }
         if (timeDerivative2 == NULL && (cellInformation[ltsId].ltsSetup >> derivativesSide)%2 == 1) {
           timeDerivative2 = faceNeighbors[ i_ltsLut->ltsId(i_lts->faceNeighbors.mask, derivativesMeshId, duplicate) ][ derivativesSide ];
+          timeDerivative2Reduced = (cellInformation[ltsId].ltsSetup >> (12 + derivativesSide))%2 == 1;
         }
       }
 
@@ -428,9 +431,13 @@ void seissol::initializers::initializeDynamicRuptureMatrices( MeshReader const&
       if (fault[meshFace].element >= 0) {
         timeDerivativePlus[ltsFace] = timeDerivative1;
         timeDerivativeMinus[ltsFace] = timeDerivative2;
+        faceInformation[ltsFace].plusSideReduced = false;
+        faceInformation[ltsFace].minusSideReduced = timeDerivative2Reduced;
       } else {
         timeDerivativePlus[ltsFace] = timeDerivative2;
         timeDerivativeMinus[ltsFace] = timeDerivative1;
+        faceInformation[ltsFace].plusSideReduced = timeDerivative2Reduced;
+        faceInformation[ltsFace].minusSideReduced = false;
       }
 
       assert(timeDerivativePlus[ltsFace] != NULL && timeDerivativeMinus[ltsFace] != NULL);
@@ -61,20 +61,27 @@ struct seissol::initializers::DynamicRupture {
   Variable<DRFaceInformation>                                       faceInformation;
   Variable<model::IsotropicWaveSpeeds>                              waveSpeedsPlus;
   Variable<model::IsotropicWaveSpeeds>                              waveSpeedsMinus;
+  // Interpolated states of all faces, such that the C++ friction solver evaluates a chunk of faces at once
+  Variable<real[CONVERGENCE_ORDER][tensor::QInterpolated::size()]>  QInterpolatedPlus;
+  Variable<real[CONVERGENCE_ORDER][tensor::QInterpolated::size()]>  QInterpolatedMinus;
   
   
-  void addTo(LTSTree& tree) {
+  /// QInterpolated is only stored if the C++ friction solver is requested
+  void addTo(LTSTree& tree, bool cppFrictionSolver) {
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(      timeDerivativePlus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(     timeDerivativeMinus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(        imposedStatePlus,             mask,     PAGESIZE_HEAP,      seissol::memory::Standard );
-    tree.addVar(       imposedStateMinus,             mask,     PAGESIZE_HEAP,      seissol::memory::Standard );
-    tree.addVar(             godunovData,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(          fluxSolverPlus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(         fluxSolverMinus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(         faceInformation,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(          waveSpeedsPlus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(         waveSpeedsMinus,             mask,                 1,      seissol::memory::Standard );
+    LayerMask frictionSolverMask = cppFrictionSolver ? LayerMask(Ghost) : LayerMask(Ghost) | LayerMask(Copy) | LayerMask(Interior);
+    tree.addVar(      timeDerivativePlus,             mask,                 1,      seissol::memory::Standard, "timeDerivativePlus" );
+    tree.addVar(     timeDerivativeMinus,             mask,                 1,      seissol::memory::Standard, "timeDerivativeMinus" );
+    tree.addVar(        imposedStatePlus,             mask,     PAGESIZE_HEAP,      seissol::memory::Standard, "imposedStatePlus" );
+    tree.addVar(       imposedStateMinus,             mask,     PAGESIZE_HEAP,      seissol::memory::Standard, "imposedStateMinus" );
+    tree.addVar(             godunovData,             mask,                 1,      seissol::memory::Standard, "godunovData" );
+    tree.addVar(          fluxSolverPlus,             mask,                 1,      seissol::memory::Standard, "fluxSolverPlus" );
+    tree.addVar(         fluxSolverMinus,             mask,                 1,      seissol::memory::Standard, "fluxSolverMinus" );
+    tree.addVar(         faceInformation,             mask,                 1,      seissol::memory::Standard, "faceInformation" );
+    tree.addVar(          waveSpeedsPlus,             mask,                 1,      seissol::memory::Standard, "waveSpeedsPlus" );
+    tree.addVar(         waveSpeedsMinus,             mask,                 1,      seissol::memory::Standard, "waveSpeedsMinus" );
+    tree.addVar(       QInterpolatedPlus, frictionSolverMask,     PAGESIZE_HEAP,      seissol::memory::Standard, "QInterpolatedPlus" );
+    tree.addVar(      QInterpolatedMinus, frictionSolverMask,     PAGESIZE_HEAP,      seissol::memory::Standard, "QInterpolatedMinus" );
   }
 };
 #endif
@@ -0,0 +1,151 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Batches of cells for the local integration.
+ **/
+
+#include "LocalIntegrationBatches.h"
+
+#include <generated_code/kernel.h>
+#include <generated_code/tensor.h>
+
+#include <algorithm>
+#include <cassert>
+
+bool seissol::initializers::isLocalBatchCell(CellLocalInformation const& cellInformation) {
+#ifdef LOCAL_BATCH_SIZE
+  // the batched kernels do not store the time derivatives
+  if ((cellInformation.ltsSetup >> 9) % 2 == 1) {
+    return false;
+  }
+
+  // nodal boundary conditions require the cell-wise boundary treatment
+  for (unsigned face = 0; face < 4; ++face) {
+    if (cellInformation.faceTypes[face] == FaceType::freeSurfaceGravity
+        || cellInformation.faceTypes[face] == FaceType::dirichlet
+        || cellInformation.faceTypes[face] == FaceType::analytical) {
+      return false;
+    }
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+#ifdef LOCAL_BATCH_SIZE
+unsigned seissol::initializers::getNumberOfLocalIntegrationBatches(Layer& layer, LTS& lts) {
+  CellLocalInformation* cellInformation = layer.var(lts.cellInformation);
+
+  unsigned numberOfCells = 0;
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    if (isLocalBatchCell(cellInformation[cell])) {
+      ++numberOfCells;
+    }
+  }
+
+  return (numberOfCells + LOCAL_BATCH_SIZE - 1) / LOCAL_BATCH_SIZE;
+}
+
+void seissol::initializers::initializeLocalIntegrationBatches(Layer& layer, LTS& lts) {
+  unsigned numberOfBatches = layer.getBucketSize(lts.localIntegrationBatches) / sizeof(LocalIntegrationBatch);
+  assert(numberOfBatches == getNumberOfLocalIntegrationBatches(layer, lts));
+  if (numberOfBatches == 0) {
+    return;
+  }
+
+  LocalIntegrationBatch* batches = static_cast<LocalIntegrationBatch*>(layer.bucket(lts.localIntegrationBatches));
+  CellLocalInformation* cellInformation = layer.var(lts.cellInformation);
+  LocalIntegrationData* localIntegration = layer.var(lts.localIntegration);
+
+  // assign the cells in the order of the layer
+  unsigned batch = 0;
+  batches[0].numberOfCells = 0;
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    if (isLocalBatchCell(cellInformation[cell])) {
+      if (batches[batch].numberOfCells == LOCAL_BATCH_SIZE) {
+        ++batch;
+        batches[batch].numberOfCells = 0;
+      }
+      batches[batch].cells[ batches[batch].numberOfCells++ ] = cell;
+    }
+  }
+  assert(batch+1 == numberOfBatches);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned batch = 0; batch < numberOfBatches; ++batch) {
+    LocalIntegrationBatch& localBatch = batches[batch];
+
+    // idle lanes remain zero
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      std::fill_n(localBatch.starMatrices[dim], tensor::batchedStar::size(0), static_cast<real>(0.0));
+    }
+    for (unsigned face = 0; face < 4; ++face) {
+      std::fill_n(localBatch.nApNm1[face], tensor::batchedAplusT::size(), static_cast<real>(0.0));
+    }
+
+    alignas(ALIGNMENT) real batchLane[tensor::batchLane::size()];
+    batched::kernel::packStar packStarKrnl;
+    batched::kernel::packAplusT packAplusTKrnl;
+    packStarKrnl.batchLane = batchLane;
+    packAplusTKrnl.batchLane = batchLane;
+
+    for (unsigned lane = 0; lane < localBatch.numberOfCells; ++lane) {
+      unsigned cell = localBatch.cells[lane];
+
+      std::fill_n(batchLane, tensor::batchLane::size(), static_cast<real>(0.0));
+      batchLane[lane] = static_cast<real>(1.0);
+
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        packStarKrnl.star(dim) = localIntegration[cell].starMatrices[dim];
+        packStarKrnl.batchedStar(dim) = localBatch.starMatrices[dim];
+        packStarKrnl.execute(dim);
+      }
+
+      for (unsigned face = 0; face < 4; ++face) {
+        // no element local contribution in the case of dynamic rupture boundary conditions
+        if (cellInformation[cell].faceTypes[face] != FaceType::dynamicRupture) {
+          packAplusTKrnl.AplusT = localIntegration[cell].nApNm1[face];
+          packAplusTKrnl.batchedAplusT = localBatch.nApNm1[face];
+          packAplusTKrnl.execute();
+        }
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Batches of cells for the local integration.
+ **/
+
+#ifndef INITIALIZER_LOCALINTEGRATIONBATCHES_H_
+#define INITIALIZER_LOCALINTEGRATIONBATCHES_H_
+
+#include <Initializer/typedefs.hpp>
+#include <Initializer/LTS.h>
+#include <Initializer/tree/Layer.hpp>
+
+namespace seissol {
+  namespace initializers {
+    /**
+     * Returns true if the local integration of the cell is computed in a batch.
+     * Cells which store time derivatives or have faces with nodal boundary conditions
+     * are integrated cell by cell.
+     **/
+    bool isLocalBatchCell(CellLocalInformation const& cellInformation);
+
+#ifdef LOCAL_BATCH_SIZE
+    /**
+     * Returns the number of batches required for the batchable cells of the layer.
+     **/
+    unsigned getNumberOfLocalIntegrationBatches(Layer& layer, LTS& lts);
+
+    /**
+     * Assigns the batchable cells to the batches and interleaves their star matrices and flux solvers.
+     * Requires the cell local matrices and a bucket of
+     * getNumberOfLocalIntegrationBatches() * sizeof(LocalIntegrationBatch) bytes.
+     **/
+    void initializeLocalIntegrationBatches(Layer& layer, LTS& lts);
+#endif
+  }
+}
+
+#endif
@@ -70,8 +70,18 @@
  **/
 #include "MemoryAllocator.h"
 
+#include <algorithm>
+#include <cstdint>
+
+#include <utils/env.h>
 #include <utils/logger.h>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind i_memkind)
 {
     void* l_ptrBuffer;
@@ -133,17 +143,137 @@ void seissol::memory::printMemoryAlignment( std::vector< std::vector<unsigned lo
 
 seissol::memory::ManagedAllocator::~ManagedAllocator()
 {
-  for (AddressVector::const_iterator it = m_dataMemoryAddresses.begin(); it != m_dataMemoryAddresses.end(); ++it) {
-    seissol::memory::free(it->second, it->first);
+  for (AllocationVector::const_iterator it = m_allocations.begin(); it != m_allocations.end(); ++it) {
+    seissol::memory::free(it->pointer, it->memkind);
   }
 
   // reset memory vectors
-  m_dataMemoryAddresses.clear();
+  m_allocations.clear();
 }
 
-void* seissol::memory::ManagedAllocator::allocateMemory( size_t i_size, size_t i_alignment, enum Memkind i_memkind )
+void* seissol::memory::ManagedAllocator::allocateMemory( size_t i_size, size_t i_alignment, enum Memkind i_memkind, char const* i_name )
 {
   void* l_ptrBuffer = seissol::memory::allocate(i_size, i_alignment, i_memkind);
-  m_dataMemoryAddresses.push_back( Address(i_memkind, l_ptrBuffer) );
+  Allocation l_allocation;
+  l_allocation.memkind = i_memkind;
+  l_allocation.pointer = l_ptrBuffer;
+  l_allocation.size    = i_size;
+  l_allocation.name    = i_name;
+  m_allocations.push_back( l_allocation );
   return l_ptrBuffer;
 }
+
+size_t seissol::memory::ManagedAllocator::spilledBytes() const
+{
+  size_t l_spilled = 0;
+#ifdef USE_MEMKIND
+  for (AllocationVector::const_iterator it = m_allocations.begin(); it != m_allocations.end(); ++it) {
+    if (it->memkind == HighBandwidth && it->pointer != NULL
+        && hbw_verify_memory_region(it->pointer, it->size, HBW_TOUCH_PAGES) != 0) {
+      l_spilled += it->size;
+    }
+  }
+#endif
+  return l_spilled;
+}
+
+void seissol::memory::adviseHugePages( void* i_pointer, size_t i_size )
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (i_pointer != NULL && i_size > 0) {
+    // madvise requires a page aligned address, only advise the pages fully inside the region
+    const uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+    const uintptr_t begin = (reinterpret_cast<uintptr_t>(i_pointer) + pageSize - 1) & ~(pageSize-1);
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(i_pointer) + i_size) & ~(pageSize-1);
+    if (begin < end) {
+      // Failure is not critical, e.g. if transparent huge pages are disabled
+      madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+  }
+#endif
+}
+
+size_t seissol::memory::pagePlacement( void const*          i_pointer,
+                                       size_t               i_size,
+                                       size_t               i_maxSamples,
+                                       std::vector<size_t>& o_pagesPerNode,
+                                       size_t&              o_untouched )
+{
+  o_untouched = 0;
+#if defined(__linux__) && defined(SYS_move_pages)
+  if (i_pointer == NULL || i_size == 0 || i_maxSamples == 0) {
+    return 0;
+  }
+
+  const uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(i_pointer) & ~(pageSize-1);
+  const uintptr_t end = reinterpret_cast<uintptr_t>(i_pointer) + i_size;
+  const size_t numberOfPages = (end - begin + pageSize - 1) / pageSize;
+  const size_t stride = (numberOfPages + i_maxSamples - 1) / i_maxSamples;
+
+  std::vector<void*> pages;
+  for (size_t page = 0; page < numberOfPages; page += stride) {
+    pages.push_back(reinterpret_cast<void*>(begin + page * pageSize));
+  }
+  std::vector<int> status(pages.size());
+
+  // nodes == NULL only queries the node of each page
+  if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), NULL, status.data(), 0) != 0) {
+    return 0;
+  }
+
+  for (int node : status) {
+    if (node >= 0) {
+      if (static_cast<size_t>(node) >= o_pagesPerNode.size()) {
+        o_pagesPerNode.resize(node+1, 0);
+      }
+      ++o_pagesPerNode[node];
+    } else {
+      ++o_untouched;
+    }
+  }
+  return pages.size();
+#else
+  return 0;
+#endif
+}
+
+seissol::memory::Arena::Arena()
+{
+  std::fill(m_sizes, m_sizes + NumberOfMemkinds, 0);
+  std::fill(m_regions, m_regions + NumberOfMemkinds, static_cast<char*>(NULL));
+}
+
+unsigned seissol::memory::Arena::add( size_t i_size, size_t i_alignment, enum Memkind i_memkind )
+{
+  assert(i_memkind < NumberOfMemkinds);
+  assert(m_regions[i_memkind] == NULL);
+
+  Chunk chunk;
+  chunk.offset = (i_alignment > 1) ? ((m_sizes[i_memkind] + i_alignment - 1) / i_alignment) * i_alignment : m_sizes[i_memkind];
+  chunk.size = i_size;
+  chunk.memkind = i_memkind;
+  m_sizes[i_memkind] = chunk.offset + chunk.size;
+
+  m_chunks.push_back(chunk);
+  return m_chunks.size() - 1;
+}
+
+void seissol::memory::Arena::allocate( ManagedAllocator& io_allocator, char const* i_name )
+{
+  const bool hugePages = utils::Env::get<bool>("SEISSOL_HUGE_PAGES", true);
+
+  for (unsigned memkind = 0; memkind < NumberOfMemkinds; ++memkind) {
+    m_regions[memkind] = static_cast<char*>(io_allocator.allocateMemory(m_sizes[memkind], HugePageSize, static_cast<enum Memkind>(memkind), i_name));
+    if (hugePages && memkind == Standard) {
+      adviseHugePages(m_regions[memkind], m_sizes[memkind]);
+    }
+  }
+}
+
+void* seissol::memory::Arena::pointer( unsigned i_id ) const
+{
+  Chunk const& chunk = m_chunks[i_id];
+  assert(chunk.size == 0 || m_regions[chunk.memkind] != NULL);
+  return (chunk.size > 0) ? m_regions[chunk.memkind] + chunk.offset : NULL;
+}
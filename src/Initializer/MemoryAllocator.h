@@ -96,7 +96,28 @@ namespace seissol {
      * @param i_memoryAlignment memory alignment.
      **/
     void printMemoryAlignment( std::vector< std::vector<unsigned long long> > i_memoryAlignment );
+
+    /**
+     * Advises the kernel to back the memory region with transparent huge pages (Linux only).
+     **/
+    void adviseHugePages( void* i_pointer, size_t i_size );
+
+    /**
+     * Counts the pages of a memory region per NUMA node (Linux only).
+     * At most i_maxSamples equidistant pages are queried.
+     *
+     * @param o_pagesPerNode number of sampled pages per NUMA node.
+     * @param o_untouched number of sampled pages, which are not backed by physical memory yet.
+     * @return number of sampled pages; 0 if the placement cannot be queried.
+     **/
+    size_t pagePlacement( void const*          i_pointer,
+                          size_t               i_size,
+                          size_t               i_maxSamples,
+                          std::vector<size_t>& o_pagesPerNode,
+                          size_t&              o_untouched );
+
     class ManagedAllocator;
+    class Arena;
   }
 }
 
@@ -104,12 +125,20 @@ namespace seissol {
  * Automatically frees allocated memory on destruction.
  **/
 class seissol::memory::ManagedAllocator {
+  public:
+    struct Allocation {
+      enum Memkind  memkind;
+      void*         pointer;
+      size_t        size;
+      //! label of the allocation in the memory report
+      char const*   name;
+    };
+
   private:
-    typedef std::pair<enum Memkind, void*> Address; 
-    typedef std::vector<Address>       AddressVector;
+    typedef std::vector<Allocation> AllocationVector;
   
-    //! holds all memory addresses, which point to data arrays and have been returned by mallocs calling functions of the memory allocator.
-    AddressVector m_dataMemoryAddresses;
+    //! holds all allocations, which point to data arrays and have been returned by mallocs calling functions of the memory allocator.
+    AllocationVector m_allocations;
 
   public:  
     ManagedAllocator() {}
@@ -124,9 +153,73 @@ class seissol::memory::ManagedAllocator {
      *
      * @param  i_size size of the chunk in byte.
      * @param  i_alignment alignment of the memory chunk in byte.
+     * @param  i_name label of the allocation in the memory report.
      * @return pointer, which points to the aligned memory of the given size.
      **/
-    void* allocateMemory( size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard );
+    void* allocateMemory( size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard, char const* i_name = "" );
+
+    AllocationVector const& allocations() const {
+      return m_allocations;
+    }
+
+    /**
+     * Returns the number of bytes of high-bandwidth allocations, which are not
+     * completely placed in high-bandwidth memory (only with memkind).
+     **/
+    size_t spilledBytes() const;
+};
+
+/**
+ * Sub-allocates many arrays from one large allocation per memkind.
+ * All arrays are registered with add() first; allocate() then reserves the regions
+ * (huge page aligned) with the given managed allocator, which also frees them.
+ **/
+class seissol::memory::Arena {
+  private:
+    struct Chunk {
+      size_t        offset;
+      size_t        size;
+      enum Memkind  memkind;
+    };
+
+    //! Standard and HighBandwidth
+    static const unsigned NumberOfMemkinds = 2;
+
+    std::vector<Chunk> m_chunks;
+
+    size_t m_sizes[NumberOfMemkinds];
+
+    char* m_regions[NumberOfMemkinds];
+
+  public:
+    //! alignment of the regions
+    static const size_t HugePageSize = 2097152;
+
+    Arena();
+
+    /**
+     * Registers an array.
+     *
+     * @return id of the array.
+     **/
+    unsigned add( size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard );
+
+    /**
+     * Allocates one region per memkind.
+     **/
+    void allocate( ManagedAllocator& io_allocator, char const* i_name = "arena" );
+
+    /**
+     * Returns the memory of an array; NULL for arrays of size 0.
+     **/
+    void* pointer( unsigned i_id ) const;
+
+    /**
+     * Size of the region of a memkind in bytes.
+     **/
+    size_t regionSize( enum Memkind i_memkind ) const {
+      return m_sizes[i_memkind];
+    }
 };
 
 #endif
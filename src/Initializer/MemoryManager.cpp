@@ -71,10 +71,20 @@
 #include "MemoryManager.h"
 #include "InternalState.h"
 #include "GlobalData.h"
+#include "LocalIntegrationBatches.h"
 #include <yateto.h>
 
 #include <Kernels/common.hpp>
+#include <Parallel/LoopSchedule.h>
+#include <Monitoring/MemoryReport.h>
+#include <Numerical_aux/ReducedPrecision.h>
+#include <Physics/FrictionSolver.h>
 #include <generated_code/tensor.h>
+#include <utils/env.h>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -226,9 +236,18 @@ void seissol::initializers::MemoryManager::initializeCommunicationStructure() {
   for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
     TimeCluster& cluster = m_ltsTree.child(tc);
     real* ghostStart = static_cast<real*>(cluster.child<Ghost>().bucket(m_lts.buffersDerivatives));
+    reduced_real* reducedGhostStart = static_cast<reduced_real*>(cluster.child<Ghost>().bucket(m_lts.buffersDerivatives));
+    if (m_reducedPrecisionGhostLayer) {
+      m_meshStructure[tc].reducedGhostRegions = static_cast<reduced_real**>(m_memoryAllocator.allocateMemory(m_meshStructure[tc].numberOfRegions * sizeof(reduced_real*), 1, seissol::memory::Standard, "reducedGhostRegions"));
+    }
     for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
       // set pointer to ghost region
-      m_meshStructure[tc].ghostRegions[l_region] = ghostStart;
+      if (m_reducedPrecisionGhostLayer) {
+        m_meshStructure[tc].ghostRegions[l_region] = NULL;
+        m_meshStructure[tc].reducedGhostRegions[l_region] = reducedGhostStart;
+      } else {
+        m_meshStructure[tc].ghostRegions[l_region] = ghostStart;
+      }
 
       // derive the ghost region size
       unsigned int l_numberOfDerivatives = m_meshStructure[tc].numberOfGhostRegionDerivatives[l_region];
@@ -238,8 +257,9 @@ void seissol::initializers::MemoryManager::initializeCommunicationStructure() {
       m_meshStructure[tc].ghostRegionSizes[l_region] = tensor::Q::size() * l_numberOfBuffers +
                                                        yateto::computeFamilySize<tensor::dQ>() * l_numberOfDerivatives;
 
-      // update the pointer
+      // update the pointers
       ghostStart += m_meshStructure[tc].ghostRegionSizes[l_region];
+      reducedGhostStart += m_meshStructure[tc].ghostRegionSizes[l_region];
     }
   }
 
@@ -279,7 +299,34 @@ void seissol::initializers::MemoryManager::initializeCommunicationStructure() {
       // jump over region
       l_offset += m_meshStructure[tc].numberOfCopyRegionCells[l_region];
     }
+
+    // send buffers in reduced precision
+    if (m_reducedPrecisionGhostLayer) {
+      size_t l_size = 0;
+      for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
+        l_size += m_meshStructure[tc].copyRegionSizes[l_region];
+      }
+      m_meshStructure[tc].reducedCopyRegions = static_cast<reduced_real**>(m_memoryAllocator.allocateMemory(m_meshStructure[tc].numberOfRegions * sizeof(reduced_real*), 1, seissol::memory::Standard, "reducedCopyRegions"));
+      reduced_real* reducedCopyStart = static_cast<reduced_real*>(m_memoryAllocator.allocateMemory(l_size * sizeof(reduced_real), ALIGNMENT, seissol::memory::Standard, "reducedCopyRegions"));
+      for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
+        m_meshStructure[tc].reducedCopyRegions[l_region] = reducedCopyStart;
+        reducedCopyStart += m_meshStructure[tc].copyRegionSizes[l_region];
+      }
+    }
+  }
+}
+
+bool seissol::initializers::MemoryManager::isGhostCell( unsigned ltsId ) {
+  // the tree is ordered by cluster and layer: ghost, copy, interior
+  unsigned l_offset = 0;
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    TimeCluster& cluster = m_ltsTree.child(tc);
+    if (ltsId < l_offset + cluster.child<Ghost>().getNumberOfCells()) {
+      return ltsId >= l_offset;
+    }
+    l_offset += cluster.getNumberOfCells();
   }
+  return false;
 }
 #endif
 
@@ -313,6 +360,12 @@ void seissol::initializers::MemoryManager::initializeFaceNeighbors( unsigned
           faceNeighbors[cell][face] = buffers[ cellInformation[cell].faceNeighborIds[face] ];
         }
         assert(faceNeighbors[cell][face] != nullptr);
+#ifdef USE_MPI
+        // neighbors in the ghost layer are stored in reduced precision
+        if (m_reducedPrecisionGhostLayer && isGhostCell(cellInformation[cell].faceNeighborIds[face])) {
+          cellInformation[cell].ltsSetup |= (1 << (12 + face));
+        }
+#endif
       }
       // boundaries using local cells
       else if (cellInformation[cell].faceTypes[face] == FaceType::freeSurface ||
@@ -357,6 +410,22 @@ void seissol::initializers::MemoryManager::initializeBuffersDerivatives() {
                                        cluster.child<Ghost>().var(m_lts.buffers),
                                        cluster.child<Ghost>().var(m_lts.derivatives) );
 
+    if (m_reducedPrecisionGhostLayer) {
+      // the offsets are in reals; scale them to reduced_real
+      Layer& ghost = cluster.child<Ghost>();
+      real* ghostStart = static_cast<real*>(ghost.bucket(m_lts.buffersDerivatives));
+      real** buffers = ghost.var(m_lts.buffers);
+      real** derivatives = ghost.var(m_lts.derivatives);
+      for (unsigned cell = 0; cell < ghost.getNumberOfCells(); ++cell) {
+        if (buffers[cell] != NULL) {
+          buffers[cell] = reinterpret_cast<real*>(reinterpret_cast<reduced_real*>(ghostStart) + (buffers[cell] - ghostStart));
+        }
+        if (derivatives[cell] != NULL) {
+          derivatives[cell] = reinterpret_cast<real*>(reinterpret_cast<reduced_real*>(ghostStart) + (derivatives[cell] - ghostStart));
+        }
+      }
+    }
+
     /*
      * Copy layer
      */
@@ -386,26 +455,63 @@ void seissol::initializers::MemoryManager::initializeBuffersDerivatives() {
 void seissol::initializers::MemoryManager::touchBuffersDerivatives( Layer& layer ) {
   real** buffers = layer.var(m_lts.buffers);
   real** derivatives = layer.var(m_lts.derivatives);
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
+#ifdef USE_MPI
+  if (m_reducedPrecisionGhostLayer && layer.getLayerType() == Ghost) {
+    size_t size = layer.getBucketSize(m_lts.buffersDerivatives);
+    if (size > 0) {
+      std::memset(layer.bucket(m_lts.buffersDerivatives), 0, size);
+    }
+    return;
+  }
 #endif
-  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
-    // touch buffers
-    real* buffer = buffers[cell];
-    if (buffer != NULL) {
-      for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
-          // zero time integration buffers
-          buffer[dof] = (real) 0;
+  // same distribution of the cells to threads as in the compute loops
+  parallel::forStatic(layer.getNumberOfCells(), [&](unsigned begin, unsigned end) {
+    for (unsigned cell = begin; cell < end; ++cell) {
+      // touch buffers
+      real* buffer = buffers[cell];
+      if (buffer != NULL) {
+        for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
+            // zero time integration buffers
+            buffer[dof] = (real) 0;
+        }
       }
-    }
 
-    // touch derivatives
-    real* derivative = derivatives[cell];
-    if (derivative != NULL) {
-      for (unsigned dof = 0; dof < yateto::computeFamilySize<tensor::dQ>(); ++dof ) {
-        derivative[dof] = (real) 0;
+      // touch derivatives
+      real* derivative = derivatives[cell];
+      if (derivative != NULL) {
+        for (unsigned dof = 0; dof < yateto::computeFamilySize<tensor::dQ>(); ++dof ) {
+          derivative[dof] = (real) 0;
+        }
       }
     }
+  });
+}
+
+void seissol::initializers::MemoryManager::printMemoryPlacement( LTSTree const& tree, char const* treeName ) {
+  const int rank = seissol::MPI::mpi.rank();
+  // sampling keeps the query cheap for large variables
+  const size_t maxSamples = 16384;
+
+  auto print = [&](char const* name, void const* memory, size_t size) {
+    std::vector<size_t> pagesPerNode;
+    size_t untouched = 0;
+    size_t samples = seissol::memory::pagePlacement(memory, size, maxSamples, pagesPerNode, untouched);
+    if (samples == 0) {
+      return;
+    }
+    std::stringstream nodes;
+    for (unsigned node = 0; node < pagesPerNode.size(); ++node) {
+      nodes << " node " << node << ": " << std::fixed << std::setprecision(1) << 100.0 * pagesPerNode[node] / samples << "%";
+    }
+    logInfo(rank) << "Memory placement of" << std::string(treeName) + "." + name + ":" << size / (1024.0*1024.0) << "MiB,"
+                  << samples << "sampled pages," << nodes.str() << "(untouched:" << 100.0 * untouched / samples << "%)";
+  };
+
+  for (unsigned var = 0; var < tree.getNumberOfVariables(); ++var) {
+    print(tree.info(var).name, tree.varMemory(var), tree.varSize(var));
+  }
+  for (unsigned bucket = 0; bucket < tree.getNumberOfBuckets(); ++bucket) {
+    print(tree.bucketMemoryInfo(bucket).name, tree.bucketMemory(bucket), tree.bucketSize(bucket));
   }
 }
 
@@ -436,7 +542,7 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
   m_ltsTree.touchVariables();
 
   /// Dynamic rupture tree
-  m_dynRup.addTo(m_dynRupTree);
+  m_dynRup.addTo(m_dynRupTree, seissol::physics::FrictionSolver::requestedMode() != seissol::physics::FrictionSolver::Fortran);
   m_dynRupTree.setNumberOfTimeClusters(i_timeStepping.numberOfLocalClusters);
   m_dynRupTree.fixate();
 
@@ -584,6 +690,13 @@ void seissol::initializers::MemoryManager::initializeDisplacements()
 
 void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFreeSurfaceIntegration)
 {
+#ifdef USE_MPI
+  m_reducedPrecisionGhostLayer = utils::Env::get<bool>("SEISSOL_REDUCED_PRECISION", false);
+  if (m_reducedPrecisionGhostLayer) {
+    logInfo(seissol::MPI::mpi.rank()) << "Storing and communicating the ghost layer in reduced precision.";
+  }
+#endif
+
   // correct LTS-information in the ghost layer
   correctGhostRegionSetups();
 
@@ -597,9 +710,10 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
     size_t l_copySize = 0;
     size_t l_interiorSize = 0;
 #ifdef USE_MPI
+    size_t l_ghostRealSize = m_reducedPrecisionGhostLayer ? sizeof(reduced_real) : sizeof(real);
     for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
-      l_ghostSize    += sizeof(real) * tensor::Q::size() * m_numberOfGhostRegionBuffers[tc][l_region];
-      l_ghostSize    += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfGhostRegionDerivatives[tc][l_region];
+      l_ghostSize    += l_ghostRealSize * tensor::Q::size() * m_numberOfGhostRegionBuffers[tc][l_region];
+      l_ghostSize    += l_ghostRealSize * yateto::computeFamilySize<tensor::dQ>() * m_numberOfGhostRegionDerivatives[tc][l_region];
 
       l_copySize     += sizeof(real) * tensor::Q::size() * m_numberOfCopyRegionBuffers[tc][l_region];
       l_copySize     += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfCopyRegionDerivatives[tc][l_region];
@@ -615,6 +729,12 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
 
   deriveDisplacementsBucket();
 
+#ifdef LOCAL_BATCH_SIZE
+  for (auto layer = m_ltsTree.beginLeaf(LayerMask(Ghost)); layer != m_ltsTree.endLeaf(); ++layer) {
+    layer->setBucketSize(m_lts.localIntegrationBatches, getNumberOfLocalIntegrationBatches(*layer, m_lts) * sizeof(LocalIntegrationBatch));
+  }
+#endif
+
   m_ltsTree.allocateBuckets();
 
   // initialize the internal state
@@ -633,6 +753,10 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
     touchBuffersDerivatives(*it);
   }
 
+  if (utils::Env::get<bool>("SEISSOL_MEMORY_PLACEMENT", false)) {
+    printMemoryPlacement(m_ltsTree, "lts");
+  }
+
 #ifdef USE_MPI
   // initialize the communication structure
   initializeCommunicationStructure();
@@ -641,6 +765,15 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
   initializeDisplacements();
 }
 
+void seissol::initializers::MemoryManager::printMemoryReport() {
+  MemoryReport report;
+  report.addTree("lts", m_ltsTree);
+  report.addTree("dynamicRupture", m_dynRupTree);
+  report.addTree("boundary", m_boundaryTree);
+  report.addAllocator("global", m_memoryAllocator);
+  report.print(utils::Env::get<std::string>("SEISSOL_MEMORY_REPORT", ""));
+}
+
 void seissol::initializers::MemoryManager::getMemoryLayout( unsigned int                    i_cluster,
                                                             struct MeshStructure          *&o_meshStructure,
                                                             struct GlobalData             *&o_globalData
@@ -142,6 +142,9 @@ class seissol::initializers::MemoryManager {
 
     //! number of derivatives in the copy regionsper cluster
     unsigned int **m_numberOfCopyRegionDerivatives;
+
+    //! true if the ghost layer is stored and communicated in reduced precision
+    bool m_reducedPrecisionGhostLayer;
 #endif
 
     /*
@@ -178,6 +181,13 @@ class seissol::initializers::MemoryManager {
     void initializeFaceNeighbors( unsigned    cluster,
                                   Layer& layer);
 
+#ifdef USE_MPI
+    /**
+     * Returns true if the cell with the given lts id is in the ghost layer.
+     **/
+    bool isGhostCell( unsigned ltsId );
+#endif
+
     /**
      * Initializes the pointers of the internal state.
      **/
@@ -200,6 +210,14 @@ class seissol::initializers::MemoryManager {
      **/
     void touchBuffersDerivatives( Layer& layer );
 
+    /**
+     * Prints the distribution of the pages of all variables and buckets to the NUMA nodes.
+     *
+     * @param tree lts tree.
+     * @param treeName name of the tree in the output.
+     **/
+    void printMemoryPlacement( LTSTree const& tree, char const* treeName );
+
 #ifdef USE_MPI
     /**
      * Initializes the communication structure.
@@ -211,7 +229,11 @@ class seissol::initializers::MemoryManager {
     /**
      * Constructor
      **/
-    MemoryManager() {}
+    MemoryManager()
+#ifdef USE_MPI
+      : m_reducedPrecisionGhostLayer(false)
+#endif
+    {}
 
     /**
      * Destructor, memory is freed by managed allocator
@@ -235,6 +257,12 @@ class seissol::initializers::MemoryManager {
                        unsigned* numberOfDRInteriorFaces);
 
     void fixateBoundaryLtsTree();
+
+    /**
+     * Prints the memory footprint of all trees and the global data (collective operation).
+     * The full report is only written if SEISSOL_MEMORY_REPORT is set.
+     **/
+    void printMemoryReport();
     /**
      * Set up the internal structure.
      *
@@ -48,6 +48,7 @@ namespace seissol {
     /** Finds the tetrahedrons that contain the points.
      *  In "contained" we save if the point source is contained in the mesh.
      *  We use short here as bool. For MPI use cleanDoubles afterwards.
+     *  The points are located with the bounding volume hierarchy of the mesh reader.
      */
     void findMeshIds( Eigen::Vector3d const*  points,
                       MeshReader const& mesh,
@@ -55,6 +56,7 @@ namespace seissol {
                       short*            contained,
                       unsigned*         meshId );
 #ifdef USE_MPI
+    /** Keeps points contained on several ranks only on the smallest rank. */
     void cleanDoubles(short* contained, unsigned numPoints);
 #endif
   }
@@ -501,7 +501,7 @@ CONTAINS
                                               )
     enddo
 
-    enableFreeSurfaceIntegration = (io%surfaceOutput > 0)
+    enableFreeSurfaceIntegration = (io%surfaceOutput > 0 .or. io%SurfaceGroundMotion > 0)
     ! put the clusters under control of the time manager
     call c_interoperability_initializeClusteredLts( i_clustering = disc%galerkin%clusteredLts, i_enableFreeSurfaceIntegration = enableFreeSurfaceIntegration )
 
@@ -718,6 +718,7 @@ CONTAINS
     USE COMMON_operators_mod
     USE QuadPoints_mod
     USE JacobiNormal_mod
+    USE ParallelInputFile_mod
 
     !-------------------------------------------------------------------------!
     IMPLICIT NONE
@@ -734,7 +735,6 @@ CONTAINS
     !-------------------------------------------------------------------------!
     ! Local variable declaration                                              !
     INTEGER :: allocstat                                  ! Allocation status !
-    INTEGER :: stat                                       ! IO status         !
     INTEGER :: iDegFr                                     ! Loop counter      !
     INTEGER :: iElem, iSide, iBndGP
     INTEGER :: iNeighbor, iLocalNeighborSide, iNeighborSide, iNeighborVertex
@@ -778,9 +778,11 @@ CONTAINS
     REAL                            :: VAND(DISC%Galerkin%nPoly+1,DISC%Galerkin%nPoly+1),Temp(DISC%Galerkin%nPoly+1,1)
     REAL                            :: grad(EQN%Dimension,EQN%Dimension)
     !
-    LOGICAL                         :: configexist
     CHARACTER(LEN=600)              :: FileName_Tet, FileName_Hex, FileName_Time
     CHARACTER(LEN=200)              :: DGPATH
+    CHARACTER(LEN=:), ALLOCATABLE   :: InputLines(:)                 ! Shared content of the input files
+    LOGICAL                         :: FileRead
+    INTEGER                         :: iLine, nLines
     ! CHARACTER(LEN=600)              :: TimeFile
     !
     ! Dynamic Rupture variables
@@ -804,40 +806,28 @@ CONTAINS
     ENDIF
 
     ! Reading polynomial coefficients and mass matrices
-
-    INQUIRE(                                            & !
-         FILE= 'DGPATH'                               , & !
-         EXIST=configexist                              ) !
-    !                                                     !
-    IF (configexist) THEN                                 !
-       !                                                  !
-       OPEN(                                            & !
-            UNIT= IO%UNIT%FileIn                      , & !
-            FILE= 'DGPATH'                            , & !
-            IOSTAT = STAT                               ) !
-       !                                                  !
-       IF (stat.NE.0) THEN                                !
-          logError(*) 'cannot open DGPATH'         !
-          STOP
-       END IF                                             !
-       !                                                  !
-       READ(IO%UNIT%FileIn,'(A)') DGPATH                  !
-       !                                                  !
-       CLOSE(IO%UNIT%FileIn)                              !
-       !                                                  !
-       !                                                  !
+    ! The files are read by rank 0 and shared with all other ranks
+
+    IF (readInputFile('DGPATH', InputLines)) THEN
+       IF (SIZE(InputLines).GT.0) THEN
+          DGPATH = InputLines(1)
+       ELSE
+          DGPATH = ''
+       ENDIF
+       !
        logInfo(*) 'Path to the DG directory is: ',TRIM(DGPATH)
 
-       IF (MESH%nElem_Tet.GT.0) WRITE(FileName_Tet,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.tri'
-       IF (MESH%nElem_Hex.GT.0) WRITE(FileName_Hex,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.qua'
+       WRITE(FileName_Tet,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.tri'
+       WRITE(FileName_Hex,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.qua'
 
     ELSE                                                  !
        !                                                  !
        logWarning(*) 'Configuration file DGPATH missing!'
        logWarning(*) 'Use . as default path'    !
        !                                                  !
-       IF (MESH%nElem_Tet.GT.0) WRITE(FileName_Tet,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.tri'
-       IF (MESH%nElem_Hex.GT.0) WRITE(FileName_Hex,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.qua'
+       DGPATH = ''
+       WRITE(FileName_Tet,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.tri'
+       WRITE(FileName_Hex,'(a,a20)') TRIM(DGPATH), 'BasisFunctions3D.qua'
        !
     ENDIF
 
@@ -845,22 +835,36 @@ CONTAINS
 !--------------------------------Tetrahedral Elements-------------------------------!
 !===================================================================================!
 
+    ! readInputFile is collective, hence every rank reads the file but only ranks
+    ! with tetrahedral elements parse it
+    FileRead = readInputFile(FileName_Tet, InputLines)
     IF(MESH%nElem_Tet .GT. 0)THEN
         logInfo0(*) 'Tetrahedral Elements '
-        CALL OpenFile(IO%UNIT%FileIn,FileName_Tet,.FALSE.)
+        IF (.NOT. FileRead) THEN
+            logError(*) 'Could not read file ', TRIM(FileName_Tet)
+            STOP
+        ENDIF
 
         logInfo0(*) 'Reading basis functions and mass matrices for DG method '
         logInfo0(*) '  from file ', TRIM(FileName_Tet)
 
-        ! Read comment
-        READ(IO%UNIT%FileIn,*)
-        READ(IO%UNIT%FileIn,*)
-        ! Read maximal degree of basis polynomials stored in the file.
-        READ(IO%UNIT%FileIn,*) DISC%Galerkin%nMaxPoly
-        IF(DISC%Galerkin%nPoly.GT.DISC%Galerkin%nMaxPoly) THEN
+        ! Skip comment and read maximal degree of basis polynomials stored in the file.
+        nLines = 3
+        IF(SIZE(InputLines).GE.nLines) READ(InputLines(3),*) DISC%Galerkin%nMaxPoly
+        IF(SIZE(InputLines).LT.nLines .OR. DISC%Galerkin%nPoly.GT.DISC%Galerkin%nMaxPoly) THEN
             logError(*) 'Required polynomial for DG method is higher than the ones stored in file ', FileName_Tet
             STOP
         ENDIF
+        iLine = 3
+        ! Number of lines required up to degree DISC%Galerkin%nPolyRec (two comments per degree)
+        DO iPoly = 0, DISC%Galerkin%nPolyRec
+            nDegFr = (iPoly + 1)*(iPoly + 2)*(iPoly + 3)/6
+            nLines = nLines + 2 + nDegFr*(iPoly+1)**3 + nDegFr**2
+        ENDDO
+        IF(SIZE(InputLines).LT.nLines) THEN
+            logError(*) 'Unexpected end of file ', TRIM(FileName_Tet)
+            STOP
+        ENDIF
         MaxDegFr = (DISC%Galerkin%nPolyRec+1)*(DISC%Galerkin%nPolyRec+2)*(DISC%Galerkin%nPolyRec+3)/6
         ALLOCATE(DISC%Galerkin%cPoly3D_Tet(0:DISC%Galerkin%nPolyRec,0:DISC%Galerkin%nPolyRec,0:DISC%Galerkin%nPolyRec, &
                                            0:MaxDegFr-1, 0:DISC%Galerkin%nPolyRec),                                    &
@@ -893,7 +897,7 @@ CONTAINS
         DO iPoly = 0, DISC%Galerkin%nPolyRec
             ! Read comment in front of the basis functions' coefficients
             logInfo0(*) 'Reading basis functions of order ', iPoly
-            READ(IO%UNIT%FileIn,*)
+            iLine = iLine + 1
             nDegFr = (iPoly + 1)*(iPoly + 2)*(iPoly + 3)/6
             ! Read polynomial coefficients
             ! where the index of the degrees of freedom starts at zero
@@ -901,25 +905,27 @@ CONTAINS
                 DO iZeta = 0, iPoly
                     DO iEta = 0, iPoly
                         DO iXi = 0, iPoly
-                            READ(IO%UNIT%FileIn,*) DISC%Galerkin%cPoly3D_Tet(iXi,iEta,iZeta,iDegFr,iPoly)
+                            iLine = iLine + 1
+                            READ(InputLines(iLine),*) DISC%Galerkin%cPoly3D_Tet(iXi,iEta,iZeta,iDegFr,iPoly)
                         ENDDO
                     ENDDO
                 ENDDO
             ENDDO
             ! Read comment in front of the entries of the mass matrix
-            READ(IO%UNIT%FileIn,*)
+            iLine = iLine + 1
             logInfo0(*) 'Reading mass matrices   of order ', iPoly
             ! Read entries of the mass matrix
             DO k = 1, nDegFr
                 DO l = 1, nDegFr
-                    READ(IO%UNIT%FileIn,*) DISC%Galerkin%MassMatrix_Tet(k,l,iPoly)
+                    iLine = iLine + 1
+                    READ(InputLines(iLine),*) DISC%Galerkin%MassMatrix_Tet(k,l,iPoly)
                     IF(DISC%Galerkin%MassMatrix_Tet(k,l,iPoly).NE.0) THEN
                        DISC%Galerkin%iMassMatrix_Tet(k,l,iPoly) = 1.0d0/DISC%Galerkin%MassMatrix_Tet(k,l,iPoly)
                     ENDIF
                 ENDDO
             ENDDO
         ENDDO
-        CLOSE(IO%UNIT%FileIn)
+        DEALLOCATE(InputLines)
         ! Detecting non-zero coefficients in basis polynomials
         DISC%Galerkin%NonZeroCPoly_Tet(:,:)          = 0
         DISC%Galerkin%NonZeroCPolyIndex_Tet(:,:,:,:) = -1
@@ -946,22 +952,35 @@ CONTAINS
 !--------------------------------Hexahedral Elements--------------------------------!
 !===================================================================================!
 
+    ! readInputFile is collective (see above)
+    FileRead = readInputFile(FileName_Hex, InputLines)
     IF(MESH%nElem_Hex .GT. 0)THEN
         logInfo0(*) 'Hexahedral Elements '
-        CALL OpenFile(IO%UNIT%FileIn,FileName_Hex,.FALSE.)
+        IF (.NOT. FileRead) THEN
+            logError(*) 'Could not read file ', TRIM(FileName_Hex)
+            STOP
+        ENDIF
 
         logInfo0(*) 'Reading basis functions and mass matrices for DG method '
         logInfo0(*) '  from file ', TRIM(FileName_Hex)
 
-        ! Read comment
-        READ(IO%UNIT%FileIn,*)
-        READ(IO%UNIT%FileIn,*)
-        ! Read maximal degree of basis polynomials stored in the file.
-        READ(IO%UNIT%FileIn,*) DISC%Galerkin%nMaxPoly
-        IF(DISC%Galerkin%nPoly.GT.DISC%Galerkin%nMaxPoly) THEN
+        ! Skip comment and read maximal degree of basis polynomials stored in the file.
+        nLines = 3
+        IF(SIZE(InputLines).GE.nLines) READ(InputLines(3),*) DISC%Galerkin%nMaxPoly
+        IF(SIZE(InputLines).LT.nLines .OR. DISC%Galerkin%nPoly.GT.DISC%Galerkin%nMaxPoly) THEN
             logError(*) 'Required polynomial for DG method is higher than the ones stored in file ', FileName_Hex
             STOP
         ENDIF
+        iLine = 3
+        ! Number of lines required up to degree DISC%Galerkin%nPolyRec (two comments per degree)
+        DO iPoly = 0, DISC%Galerkin%nPolyRec
+            nDegFr = (iPoly + 1)*(iPoly + 2)*(iPoly + 3)/6
+            nLines = nLines + 2 + nDegFr*(iPoly+1)**3 + nDegFr**2
+        ENDDO
+        IF(SIZE(InputLines).LT.nLines) THEN
+            logError(*) 'Unexpected end of file ', TRIM(FileName_Hex)
+            STOP
+        ENDIF
         MaxDegFr = (DISC%Galerkin%nPolyRec+1)*(DISC%Galerkin%nPolyRec+2)*(DISC%Galerkin%nPolyRec+3)/6 !**3
 
         ALLOCATE(DISC%Galerkin%cPoly3D_Hex(0:DISC%Galerkin%nPolyRec,0:DISC%Galerkin%nPolyRec,0:DISC%Galerkin%nPolyRec,      &
@@ -996,7 +1015,7 @@ CONTAINS
         DO iPoly = 0, DISC%Galerkin%nPolyRec
             ! Read comment in front of the basis functions' coefficients
             logInfo(*) 'Reading basis functions of order ', iPoly
-            READ(IO%UNIT%FileIn,*)
+            iLine = iLine + 1
             nDegFr = (iPoly + 1)*(iPoly + 2)*(iPoly + 3)/6
             ! Read polynomial coefficients
             ! where the index of the degrees of freedom starts at zero
@@ -1004,25 +1023,27 @@ CONTAINS
                 DO iZeta = 0, iPoly
                     DO iEta = 0, iPoly
                         DO iXi = 0, iPoly
-                            READ(IO%UNIT%FileIn,*) DISC%Galerkin%cPoly3D_Hex(iXi,iEta,iZeta,iDegFr,iPoly)
+                            iLine = iLine + 1
+                            READ(InputLines(iLine),*) DISC%Galerkin%cPoly3D_Hex(iXi,iEta,iZeta,iDegFr,iPoly)
                         ENDDO
                     ENDDO
                 ENDDO
             ENDDO
             ! Read comment in front of the entries of the mass matrix
-            READ(IO%UNIT%FileIn,*)
+            iLine = iLine + 1
             logInfo(*) 'Reading mass matrices   of order ', iPoly
             ! Read entries of the mass matrix
             DO k = 1, nDegFr
                 DO l = 1, nDegFr
-                    READ(IO%UNIT%FileIn,*) DISC%Galerkin%MassMatrix_Hex(k,l,iPoly)
+                    iLine = iLine + 1
+                    READ(InputLines(iLine),*) DISC%Galerkin%MassMatrix_Hex(k,l,iPoly)
                     IF(DISC%Galerkin%MassMatrix_Hex(k,l,iPoly).NE.0) THEN
                        DISC%Galerkin%iMassMatrix_Hex(k,l,iPoly) = 1.0d0/DISC%Galerkin%MassMatrix_Hex(k,l,iPoly)
                     ENDIF
                 ENDDO
             ENDDO
         ENDDO
-        CLOSE(IO%UNIT%FileIn)
+        DEALLOCATE(InputLines)
         ! Detecting non-zero coefficients in basis polynomials
         DISC%Galerkin%NonZeroCPoly_Hex(:,:)          = 0
         DISC%Galerkin%NonZeroCPolyIndex_Hex(:,:,:,:) = -1
@@ -2489,57 +2510,51 @@ CONTAINS
 
   SUBROUTINE Read2dGF(DISC,IO)
     USE QuadPoints_mod
+    USE ParallelInputFile_mod
     TYPE(tInputOutput)       :: IO
     TYPE(tDiscretization)           :: DISC
     INTEGER :: allocstat                                  ! Allocation status !
-    INTEGER :: stat                                       ! IO status         !
     INTEGER nMaxPoly,MaxDegFr,iPoly,iDegFr,DegFr,iEta,iXi,k,l
-    LOGICAL                         :: configexist
+    INTEGER :: iLine, nLines
     CHARACTER(LEN=200)   :: DGPATH
     CHARACTER(LEN=200)   :: FileName_Tri
+    CHARACTER(LEN=:), ALLOCATABLE :: InputLines(:)      ! Shared content of the input files
 
 
-    INQUIRE(                                            & !
-     FILE= 'DGPATH'                                   , & !
-     EXIST=configexist                                  ) !
-    !                                                     !
-    IF (configexist) THEN                                 !
-       !                                                  !
-       OPEN(                                            & !
-        UNIT= IO%UNIT%FileIn                          , & !
-        FILE= 'DGPATH'                                , & !
-        IOSTAT = STAT                                   ) !
-       !                                                  !
-       IF (stat.NE.0) THEN                                !
-      logError(*) 'cannot open DGPATH'                    !
-      STOP
-       END IF                                             !
-       !                                                  !
-       READ(IO%UNIT%FileIn,'(A)') DGPATH                  !
-       !                                                  !
-       CLOSE(IO%UNIT%FileIn)                              !
+    ! The files are read by rank 0 and shared with all other ranks
+    IF (readInputFile('DGPATH', InputLines)) THEN       !
        !                                                  !
+       DGPATH = ''                                        !
+       IF (SIZE(InputLines).GT.0) DGPATH = InputLines(1)  !
        !                                                  !
        logInfo0(*) 'Path to the DG directory is: ',TRIM(DGPATH)
 
     WRITE(FileName_Tri,'(a,a20)') TRIM(DGPATH), 'BasisFunctions2D.tri'
-    OPEN( UNIT = IO%UNIT%FileIn, FILE = TRIM(FileName_Tri), IOSTAT = STAT, STATUS='OLD' )
     !
-    IF(stat.NE.0) THEN
+    IF(.NOT. readInputFile(FileName_Tri, InputLines)) THEN
         logError(*) ' ERROR! File ', TRIM(FileName_Tri), ' could not be opened. '
         STOP
     ENDIF
     logInfo0(*) 'Reading basis functions and mass matrices for DG method '
     logInfo0(*) 'from file ', TRIM(FileName_Tri)
 
-    READ(IO%UNIT%FileIn,*)
-    READ(IO%UNIT%FileIn,*)
-    ! Read maximal degree of basis polynomials stored in the file.
-    READ(IO%UNIT%FileIn,*) nMaxPoly
-    IF(DISC%Galerkin%nPoly.GT.nMaxPoly) THEN
+    ! Skip comment and read maximal degree of basis polynomials stored in the file.
+    nLines = 3
+    IF(SIZE(InputLines).GE.nLines) READ(InputLines(3),*) nMaxPoly
+    IF(SIZE(InputLines).LT.nLines .OR. DISC%Galerkin%nPoly.GT.nMaxPoly) THEN
         logError(*) 'ERROR: Required polynomial for DG method is higher than the ones stored in file ', TRIM(FileName_Tri)
         STOP
     ENDIF
+    iLine = 3
+    ! Number of lines required up to degree DISC%Galerkin%nPoly (two comments per degree)
+    DO iPoly = 0, DISC%Galerkin%nPoly
+        DegFr = (iPoly + 1)*(iPoly + 2)/2
+        nLines = nLines + 2 + DegFr*(iPoly+1)**2 + DegFr**2
+    ENDDO
+    IF(SIZE(InputLines).LT.nLines) THEN
+        logError(*) 'ERROR: Unexpected end of file ', TRIM(FileName_Tri)
+        STOP
+    ENDIF
 
     MaxDegFr = (DISC%Galerkin%nPoly+1)*(DISC%Galerkin%nPoly+2)/2
 
@@ -2559,28 +2574,30 @@ CONTAINS
     DO iPoly = 0, DISC%Galerkin%nPoly
         ! Read comment in front of the basis functions' coefficients
         logInfo0(*) 'Reading basis functions of order ', iPoly
-        READ(IO%UNIT%FileIn,*)
+        iLine = iLine + 1
         DegFr = (iPoly + 1)*(iPoly + 2)/2
         ! Read polynomial coefficients
         ! where the index of the degrees of freedom starts at zero
         DO iDegFr = 0, DegFr-1
             DO iEta = 0, iPoly
                 DO iXi = 0, iPoly
-                    READ(IO%UNIT%FileIn,*) DISC%Galerkin%cPoly_Tri(iXi,iEta,iDegFr,iPoly)
+                    iLine = iLine + 1
+                    READ(InputLines(iLine),*) DISC%Galerkin%cPoly_Tri(iXi,iEta,iDegFr,iPoly)
                 ENDDO
             ENDDO
         ENDDO
         ! Read comment in front of the entries of the mass matrix
-        READ(IO%UNIT%FileIn,*)
+        iLine = iLine + 1
         logInfo0(*)  'Reading mass matrices   of order ', iPoly
         ! Read entries of the mass matrix
         DO k = 1, DegFr
             DO l = 1, DegFr
-                READ(IO%UNIT%FileIn,*) DISC%Galerkin%MassMatrix_Tri(k,l,iPoly)
+                iLine = iLine + 1
+                READ(InputLines(iLine),*) DISC%Galerkin%MassMatrix_Tri(k,l,iPoly)
             ENDDO
         ENDDO
     ENDDO
-    CLOSE(IO%UNIT%FileIn)
+    DEALLOCATE(InputLines)
 
     DISC%Galerkin%NonZeroCPoly_Tri(:,:)          = 0
     DISC%Galerkin%NonZeroCPolyIndex_Tri(:,:,:,:) = -1
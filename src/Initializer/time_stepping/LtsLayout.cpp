@@ -1534,6 +1534,10 @@ void seissol::initializers::time_stepping::LtsLayout::getMeshStructure( MeshStru
     o_meshStructure[l_cluster].copyRegions                                = new real*[        o_meshStructure[l_cluster].numberOfRegions ];
     o_meshStructure[l_cluster].copyRegionSizes                            = new unsigned int[ o_meshStructure[l_cluster].numberOfRegions ];
 
+    // set by the memory manager if the ghost layer is stored in reduced precision
+    o_meshStructure[l_cluster].reducedGhostRegions                        = NULL;
+    o_meshStructure[l_cluster].reducedCopyRegions                         = NULL;
+
     o_meshStructure[l_cluster].numberOfGhostCells = 0;
     o_meshStructure[l_cluster].numberOfCopyCells = 0;
 
@@ -51,9 +51,16 @@
 
 #include <Initializer/ParameterDB.h>
 #include <Parallel/MPI.h>
+#include <utils/env.h>
 
 #include <generated_code/tensor.h>
 #include <generated_code/init.h>
+#include <yateto.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
 
 class FaceSorter {
 private:
@@ -143,9 +150,55 @@ int seissol::initializers::time_stepping::LtsWeights::ipow(int x, int y) {
   return result;
 }
 
+void seissol::initializers::time_stepping::LtsWeights::readCalibration() {
+  std::string calibrationFile = utils::Env::get<std::string>("SEISSOL_LTS_CALIBRATION", "");
+  if (calibrationFile.empty()) {
+    return;
+  }
+
+  int const rank = seissol::MPI::mpi.rank();
+
+  // local, neighboring and dynamic rupture cost per element
+  double cost[3] = {0.0, 0.0, 0.0};
+  if (rank == 0) {
+    char const* regions[3] = {"computeLocalIntegration", "computeNeighboringIntegration", "computeDynamicRupture"};
+
+    std::ifstream calibration(calibrationFile.c_str());
+    if (!calibration) {
+      logWarning(rank) << "Could not open calibration file" << calibrationFile;
+    }
+
+    std::string region;
+    double constant, perElement;
+    while (calibration >> region >> constant >> perElement) {
+      for (unsigned r = 0; r < 3; ++r) {
+        if (region == regions[r]) {
+          cost[r] = perElement;
+        }
+      }
+    }
+  }
+#ifdef USE_MPI
+  MPI_Bcast(cost, 3, MPI_DOUBLE, 0, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  m_cellCost = cost[0] + cost[1];
+  m_dynamicRuptureCost = std::max(cost[2], 0.0);
+  m_calibrated = m_cellCost > 0.0;
+
+  if (m_calibrated) {
+    logInfo(rank) << "Calibrated LTS weights: cost per cell =" << m_cellCost
+                  << ", cost per dynamic rupture face =" << m_dynamicRuptureCost;
+  } else {
+    logWarning(rank) << "No valid calibration found in" << calibrationFile << "- using the default LTS weights";
+  }
+}
+
 void seissol::initializers::time_stepping::LtsWeights::computeWeights(PUML::TETPUML const& mesh) {
   logInfo(seissol::MPI::mpi.rank()) << "Computing LTS weights.";
 
+  readCalibration();
+
   std::vector<PUML::TETPUML::cell_t> const& cells = mesh.cells();
   int const* boundaryCond = mesh.cellData(1);
 
@@ -189,20 +242,79 @@ void seissol::initializers::time_stepping::LtsWeights::computeWeights(PUML::TETP
   
   int totalNumberOfReductions = enforceMaximumDifference(mesh, cluster);
 
+  // Only add a constraint for dynamic rupture if there is dynamic rupture
+  // (METIS cannot handle constraints with a total weight of 0)
+  int hasDynamicRupture = 0;
+  for (unsigned cell = 0; cell < cells.size() && !hasDynamicRupture; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      if (getBoundaryCondition(boundaryCond, cell, face) == 3) {
+        hasDynamicRupture = 1;
+      }
+    }
+  }
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &hasDynamicRupture, 1, MPI_INT, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  m_constraintNames.clear();
+  if (m_calibrated) {
+    // The measured costs already weight volume against dynamic rupture,
+    // a single constraint gives METIS more freedom
+    m_constraintNames.push_back("measured cost");
+  } else {
+    m_constraintNames.push_back("volume");
+    if (hasDynamicRupture) {
+      m_constraintNames.push_back("dynamic rupture");
+    }
+  }
+  m_constraintNames.push_back("memory");
+
   delete[] m_vertexWeights;
-  //m_ncon = 2;
-  m_ncon = 1;
+  m_ncon = m_constraintNames.size();
+  m_numCells = cells.size();
   m_vertexWeights = new int[cells.size() * m_ncon];
   int maxCluster = getCluster(globalMaxTimestep, globalMinTimestep, m_rate);
-  int drToCellRatio = 1;
+
+  // Memory is measured in multiples of the degrees of freedom of one cell.
+  // Each cell stores its dofs and buffers, cells at a cluster boundary or
+  // at the fault additionally store their time derivatives.
+  int const memoryBase = 2;
+  int const memoryDerivatives = (yateto::computeFamilySize<tensor::dQ>() + tensor::Q::size() - 1) / tensor::Q::size();
+
+  std::vector<PUML::TETPUML::face_t> const& faces = mesh.faces();
   for (unsigned cell = 0; cell < cells.size(); ++cell) {    
     int dynamicRupture = 0;
+    bool clusterBoundary = false;
+
+    unsigned int faceids[4];
+    PUML::Downward::faces(mesh, cells[cell], faceids);
     for (unsigned face = 0; face < 4; ++face) {
-      dynamicRupture += ( getBoundaryCondition(boundaryCond, cell, face) == 3) ? 1 : 0;
+      int boundary = getBoundaryCondition(boundaryCond, cell, face);
+      if (boundary == 3) {
+        ++dynamicRupture;
+      } else if ((boundary == 0 || boundary == 6) && !faces[ faceids[face] ].isShared()) {
+        // Neighbours on other ranks are ignored, the distribution of the
+        // cells changes with the partitioning anyway
+        int cellIds[2];
+        PUML::Upward::cells(mesh, faces[ faceids[face] ], cellIds);
+        int neighbourCell = (cellIds[0] == static_cast<int>(cell)) ? cellIds[1] : cellIds[0];
+        clusterBoundary |= (cluster[neighbourCell] != cluster[cell]);
+      }
     }
-    
-    m_vertexWeights[m_ncon * cell] = (1 + drToCellRatio*dynamicRupture) * ipow(m_rate, maxCluster - cluster[cell]);
-    //m_vertexWeights[m_ncon * cell + 1] = (dynamicRupture > 0) ? 1 : 0;
+
+    int updates = ipow(m_rate, maxCluster - cluster[cell]);
+    int* weights = &m_vertexWeights[m_ncon * cell];
+    if (m_calibrated) {
+      // Cost relative to a cell without dynamic rupture faces
+      double cost = 1.0 + dynamicRupture * m_dynamicRuptureCost / m_cellCost;
+      *weights++ = std::max(1, static_cast<int>(std::round(CALIBRATION_SCALE * cost))) * updates;
+    } else {
+      *weights++ = updates;
+      if (hasDynamicRupture) {
+        *weights++ = dynamicRupture * updates;
+      }
+    }
+    *weights++ = memoryBase + ((dynamicRupture > 0 || clusterBoundary) ? memoryDerivatives : 0);
   }
 
   delete[] cluster;
@@ -210,6 +322,46 @@ void seissol::initializers::time_stepping::LtsWeights::computeWeights(PUML::TETP
   logInfo(seissol::MPI::mpi.rank()) << "Computing LTS weights. Done. " << utils::nospace << '(' << totalNumberOfReductions << " reductions.)";
 }
 
+void seissol::initializers::time_stepping::LtsWeights::printImbalance(int const* partition, double const* nodeWeights) {
+  int const rank = seissol::MPI::mpi.rank();
+  int const nparts = seissol::MPI::mpi.size();
+
+  // Load of each partition (for every constraint)
+  std::vector<double> load(nparts * m_ncon, 0.0);
+  for (unsigned cell = 0; cell < m_numCells; ++cell) {
+    for (int c = 0; c < m_ncon; ++c) {
+      load[partition[cell] * m_ncon + c] += m_vertexWeights[m_ncon * cell + c];
+    }
+  }
+#ifdef USE_MPI
+  MPI_Reduce((rank == 0) ? MPI_IN_PLACE : load.data(), load.data(), load.size(), MPI_DOUBLE, MPI_SUM, 0, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  if (rank != 0) {
+    return;
+  }
+
+  for (int c = 0; c < m_ncon; ++c) {
+    double total = 0.0;
+    for (int p = 0; p < nparts; ++p) {
+      total += load[p * m_ncon + c];
+    }
+
+    // Maximum load relative to the target load of the partition
+    double maxRelativeLoad = 0.0;
+    for (int p = 0; p < nparts; ++p) {
+      maxRelativeLoad = std::max(maxRelativeLoad, load[p * m_ncon + c] / (nodeWeights[p] * total));
+    }
+
+    double imbalance = 1.0 - 1.0 / maxRelativeLoad;
+    if (c == 0) {
+      m_predictedImbalance = imbalance;
+    }
+
+    logInfo(rank) << "Load imbalance of" << m_constraintNames[c] << "constraint:" << 100.0 * imbalance << "%";
+  }
+}
+
 int seissol::initializers::time_stepping::LtsWeights::enforceMaximumDifference(PUML::TETPUML const& mesh, int* cluster) {
   int totalNumberOfReductions = 0;
   int globalNumberOfReductions;
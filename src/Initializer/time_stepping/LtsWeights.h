@@ -43,6 +43,7 @@
 #define INITIALIZER_TIMESTEPPING_LTSWEIGHTS_H_
 
 #include <string>
+#include <vector>
 
 #ifndef PUML_PUML_H
 namespace PUML { class TETPUML; }
@@ -64,12 +65,38 @@ public:
     delete[] m_vertexWeights;
   }
   
+  /**
+   * Computes one weight per constraint for each cell: The volume cost, the
+   * dynamic rupture cost (only if the mesh contains dynamic rupture faces)
+   * and the memory.
+   */
   void computeWeights(PUML::TETPUML const& mesh);
   
   int* vertexWeights() const { return m_vertexWeights; }
   int nWeightsPerVertex() const { return m_ncon; }
+  std::string const& constraintName(int constraint) const { return m_constraintNames[constraint]; }
+
+  /**
+   * Prints the load imbalance of each constraint for a partitioning
+   *
+   * @param partition The target partition of each cell
+   * @param nodeWeights The relative weight of each partition (sums up to 1)
+   */
+  void printImbalance(int const* partition, double const* nodeWeights);
+
+  /**
+   * @return The imbalance of the first constraint of the last partitioning
+   *  (only valid on rank 0, negative if unknown)
+   */
+  double predictedImbalance() const { return m_predictedImbalance; }
 
 private:
+  /**
+   * Reads the cost per cell and per dynamic rupture face from the file
+   * given by SEISSOL_LTS_CALIBRATION (written by LoopStatistics)
+   */
+  void readCalibration();
+
   void computeMaxTimesteps( PUML::TETPUML const&  mesh,
                             std::vector<double> const& pWaveVel,
                             std::vector<double>& timestep );
@@ -91,10 +118,19 @@ private:
                                       int* cluster,
                                       int maxDifference = 1 );
 
+  /** Weight of a cell without dynamic rupture faces in the calibrated mode */
+  static constexpr int CALIBRATION_SCALE = 4;
+
   std::string m_velocityModel;
   unsigned m_rate;
   int* m_vertexWeights = nullptr;
   int m_ncon = 1;
+  unsigned m_numCells = 0;
+  std::vector<std::string> m_constraintNames;
+  bool m_calibrated = false;
+  double m_cellCost = 0.0;
+  double m_dynamicRuptureCost = 0.0;
+  double m_predictedImbalance = -1.0;
 };
 
 #endif
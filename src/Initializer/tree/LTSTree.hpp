@@ -58,6 +58,8 @@ private:
   void** m_buckets;
   std::vector<MemoryInfo> varInfo;
   std::vector<MemoryInfo> bucketInfo;
+  std::vector<size_t> m_variableSizes;
+  std::vector<size_t> m_bucketSizes;
   seissol::memory::ManagedAllocator m_allocator;
 
 public:
@@ -98,9 +100,39 @@ public:
   inline unsigned getNumberOfVariables() const {
     return varInfo.size();
   }
+
+  /// Memory of a variable over all layers (after allocateVariables)
+  void* varMemory(unsigned index) const {
+    return m_vars[index];
+  }
+
+  size_t varSize(unsigned index) const {
+    return m_variableSizes[index];
+  }
+
+  MemoryInfo const& bucketMemoryInfo(unsigned index) const {
+    return bucketInfo[index];
+  }
+
+  inline unsigned getNumberOfBuckets() const {
+    return bucketInfo.size();
+  }
+
+  /// Memory of a bucket over all layers (after allocateBuckets)
+  void* bucketMemory(unsigned index) const {
+    return m_buckets[index];
+  }
+
+  size_t bucketSize(unsigned index) const {
+    return m_bucketSizes[index];
+  }
+
+  seissol::memory::ManagedAllocator const& allocator() const {
+    return m_allocator;
+  }
   
   template<typename T>
-  void addVar(Variable<T>& handle, LayerMask mask, size_t alignment, seissol::memory::Memkind memkind) {
+  void addVar(Variable<T>& handle, LayerMask mask, size_t alignment, seissol::memory::Memkind memkind, char const* name = "") {
     handle.index = varInfo.size();
     handle.mask = mask;
     MemoryInfo m;
@@ -108,30 +140,39 @@ public:
     m.alignment = alignment;
     m.mask = mask;
     m.memkind = memkind;
+    m.name = name;
     varInfo.push_back(m);
   }
   
-  void addBucket(Bucket& handle, size_t alignment, seissol::memory::Memkind memkind) {
+  void addBucket(Bucket& handle, size_t alignment, seissol::memory::Memkind memkind, char const* name = "") {
     handle.index = bucketInfo.size();
     MemoryInfo m;
     m.alignment = alignment;
     m.memkind = memkind;
+    m.name = name;
     bucketInfo.push_back(m);
   }
   
   void allocateVariables() {
     m_vars = new void*[varInfo.size()];
-    std::vector<size_t> variableSizes(varInfo.size(), 0);
+    m_variableSizes.assign(varInfo.size(), 0);
 
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
-      it->addVariableSizes(varInfo, variableSizes);
+      it->addVariableSizes(varInfo, m_variableSizes);
     }
 
+    // all variables share one region per memkind
+    seissol::memory::Arena arena;
+    std::vector<unsigned> chunks(varInfo.size());
+    for (unsigned var = 0; var < varInfo.size(); ++var) {
+      chunks[var] = arena.add(m_variableSizes[var], varInfo[var].alignment, varInfo[var].memkind);
+    }
+    arena.allocate(m_allocator, "variables");
     for (unsigned var = 0; var < varInfo.size(); ++var) {
-      m_vars[var] = m_allocator.allocateMemory(variableSizes[var], varInfo[var].alignment, varInfo[var].memkind);
+      m_vars[var] = arena.pointer(chunks[var]);
     }
     
-    std::fill(variableSizes.begin(), variableSizes.end(), 0);
+    std::vector<size_t> variableSizes(varInfo.size(), 0);
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
       it->setMemoryRegionsForVariables(varInfo, m_vars, variableSizes);
       it->addVariableSizes(varInfo, variableSizes);
@@ -140,17 +181,23 @@ public:
   
   void allocateBuckets() {
     m_buckets = new void*[bucketInfo.size()];
-    std::vector<size_t> bucketSizes(bucketInfo.size(), 0);
+    m_bucketSizes.assign(bucketInfo.size(), 0);
     
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
-      it->addBucketSizes(bucketSizes);
+      it->addBucketSizes(m_bucketSizes);
     }
     
+    seissol::memory::Arena arena;
+    std::vector<unsigned> chunks(bucketInfo.size());
     for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
-      m_buckets[bucket] = m_allocator.allocateMemory(bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].memkind);
+      chunks[bucket] = arena.add(m_bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].memkind);
+    }
+    arena.allocate(m_allocator, "buckets");
+    for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
+      m_buckets[bucket] = arena.pointer(chunks[bucket]);
     }
     
-    std::fill(bucketSizes.begin(), bucketSizes.end(), 0);
+    std::vector<size_t> bucketSizes(bucketInfo.size(), 0);
       for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
       it->setMemoryRegionsForBuckets(m_buckets, bucketSizes);
       it->addBucketSizes(bucketSizes);
@@ -42,6 +42,7 @@
 
 #include "Node.hpp"
 #include <Initializer/MemoryAllocator.h>
+#include <Parallel/LoopSchedule.h>
 #include <bitset>
 #include <limits>
 #include <cstring>
@@ -83,6 +84,7 @@ struct seissol::initializers::MemoryInfo {
   size_t alignment;
   LayerMask mask;
   seissol::memory::Memkind memkind;
+  char const* name;
 };
 
 class seissol::initializers::Layer : public seissol::initializers::Node {
@@ -181,17 +183,15 @@ public:
     }
   }
   
+  /// First touch: each thread zeroes the cells it is assigned to in the (static) cell loops.
   void touchVariables(std::vector<MemoryInfo> const& vars) {
-    for (unsigned var = 0; var < vars.size(); ++var) {
-      if (!isMasked(vars[var].mask)) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (unsigned cell = 0; cell < m_numberOfCells; ++cell) {
-          memset(static_cast<char*>(m_vars[var]) + cell * vars[var].bytes, 0, vars[var].bytes);
+    seissol::parallel::forStatic(m_numberOfCells, [&](unsigned begin, unsigned end) {
+      for (unsigned var = 0; var < vars.size(); ++var) {
+        if (!isMasked(vars[var].mask)) {
+          memset(static_cast<char*>(m_vars[var]) + begin * vars[var].bytes, 0, (end - begin) * vars[var].bytes);
         }
       }
-    }
+    });
   }
 };
 
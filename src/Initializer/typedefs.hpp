@@ -146,7 +146,7 @@ struct CellLocalInformation {
   // ids of the face neighbors
   unsigned int faceNeighborIds[4];
 
-  // LTS setup
+  // LTS setup (bits 12-15: face neighbor is stored in reduced precision)
   unsigned short ltsSetup;
 
   // unique global id of the time cluster
@@ -187,6 +187,11 @@ struct MeshStructure {
    */
   real** ghostRegions;
 
+  /*
+   * Pointers to the ghost regions if the ghost layer is stored in reduced precision, NULL otherwise.
+   */
+  reduced_real** reducedGhostRegions;
+
   /*
    * Sizes of the ghost regions (in reals).
    */
@@ -214,6 +219,11 @@ struct MeshStructure {
    */
   real** copyRegions;
 
+  /*
+   * Send buffers of the copy regions if the ghost layer is stored in reduced precision, NULL otherwise.
+   */
+  reduced_real** reducedCopyRegions;
+
   /*
    * Sizes of the copy regions (in reals).
    */
@@ -384,6 +394,23 @@ struct LocalIntegrationData {
 #endif
 };
 
+#ifdef LOCAL_BATCH_SIZE
+// cells whose local integration is computed together; the cell is the fastest dimension of the matrices
+struct LocalIntegrationBatch {
+  // star matrices of the cells
+  alignas(ALIGNMENT) real starMatrices[3][seissol::tensor::batchedStar::size(0)];
+
+  // flux solvers for the element local contribution, zero for dynamic rupture faces
+  alignas(ALIGNMENT) real nApNm1[4][seissol::tensor::batchedAplusT::size()];
+
+  // cells (index in the layer) of the batch
+  unsigned cells[LOCAL_BATCH_SIZE];
+
+  // number of cells in the batch, the remaining lanes are idle
+  unsigned numberOfCells;
+};
+#endif
+
 // data for the neighboring boundary integration
 struct NeighboringIntegrationData {
   // flux solver for the contribution of the neighboring elements
@@ -460,6 +487,9 @@ struct DRFaceInformation {
   unsigned plusSide;
   unsigned minusSide;
   unsigned faceRelation;
+  // time derivatives of the plus/minus side are stored in reduced precision (ghost layer)
+  bool plusSideReduced;
+  bool minusSideReduced;
 };
 
 struct DRGodunovData {
@@ -53,6 +53,13 @@
 #include <Numerical_aux/Quadrature.h>
 #include <yateto.h>
 
+seissol::kernels::DynamicRupture::DynamicRupture() {
+  m_derivativesOffsets[0] = 0;
+  for (unsigned order = 1; order < CONVERGENCE_ORDER; ++order) {
+    m_derivativesOffsets[order] = m_derivativesOffsets[order-1] + tensor::dQ::size(order-1);
+  }
+}
+
 void seissol::kernels::DynamicRupture::setGlobalData(GlobalData const* global) {
 #ifndef NDEBUG
   for (unsigned face = 0; face < 4; ++face) {
@@ -63,8 +70,6 @@ void seissol::kernels::DynamicRupture::setGlobalData(GlobalData const* global) {
 #endif
 
   m_krnlPrototype.V3mTo2n = global->faceToNodalMatrices;
-
-  m_timeKernel.setGlobalData(global);
 }
 
 
@@ -96,6 +101,15 @@ void seissol::kernels::DynamicRupture::setTimeStepWidth(double timestep)
     timeWeights[point] = 0.5 * timestep * timeWeights[point];
   }
 #endif
+
+  // powers in the taylor-series expansion
+  for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+    real power = 1.0;
+    for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+      m_timeBasis[derivative][point] = power;
+      power *= timePoints[point] / real(derivative+1);
+    }
+  }
 }
 
 void seissol::kernels::DynamicRupture::spaceTimeInterpolation(  DRFaceInformation const&    faceInfo,
@@ -104,9 +118,9 @@ void seissol::kernels::DynamicRupture::spaceTimeInterpolation(  DRFaceInformatio
                                                                 real const*                 timeDerivativePlus,
                                                                 real const*                 timeDerivativeMinus,
                                                                 real                        QInterpolatedPlus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
-                                                                real                        QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
-                                                                real const*                 timeDerivativePlus_prefetch,
-                                                                real const*                 timeDerivativeMinus_prefetch ) {
+                                                                real                        QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()] ) {
+  static_assert(tensor::QInterpolatedTime::size() == CONVERGENCE_ORDER * tensor::QInterpolated::size(), "QInterpolatedTime must match the time points of QInterpolated");
+
   // assert alignments
 #ifndef NDEBUG
   assert( timeDerivativePlus != nullptr );
@@ -115,51 +129,34 @@ void seissol::kernels::DynamicRupture::spaceTimeInterpolation(  DRFaceInformatio
   assert( ((uintptr_t)timeDerivativeMinus) % ALIGNMENT == 0 );
   assert( ((uintptr_t)&QInterpolatedPlus[0]) % ALIGNMENT == 0 );
   assert( ((uintptr_t)&QInterpolatedMinus[0]) % ALIGNMENT == 0 );
-  assert( tensor::Q::size() == tensor::I::size() );
 #endif
 
-  real degreesOfFreedomPlus[tensor::Q::size()] __attribute__((aligned(PAGESIZE_STACK)));
-  real degreesOfFreedomMinus[tensor::Q::size()] __attribute__((aligned(PAGESIZE_STACK)));
+  dynamicRupture::kernel::evaluateAndRotateQAtTimeInterpolationPoints krnl = m_krnlPrototype;
+  krnl.TinvT = godunovData->TinvT;
+  for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+    krnl.timeBasis(derivative) = m_timeBasis[derivative];
+  }
 
-  dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints krnl = m_krnlPrototype;
+  for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+    krnl.dQ(derivative) = timeDerivativePlus + m_derivativesOffsets[derivative];
+  }
+  krnl.QInterpolatedTime = &QInterpolatedPlus[0][0];
+  krnl.execute(faceInfo.plusSide, 0);
 
-  for (unsigned timeInterval = 0; timeInterval < CONVERGENCE_ORDER; ++timeInterval) {
-    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], 0.0, timeDerivativePlus, degreesOfFreedomPlus);
-    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], 0.0, timeDerivativeMinus, degreesOfFreedomMinus);
-
-    real const* plusPrefetch = (timeInterval < CONVERGENCE_ORDER-1) ? &QInterpolatedPlus[timeInterval+1][0] : timeDerivativePlus_prefetch;
-    real const* minusPrefetch = (timeInterval < CONVERGENCE_ORDER-1) ? &QInterpolatedMinus[timeInterval+1][0] : timeDerivativeMinus_prefetch;
-    
-    krnl.QInterpolated = &QInterpolatedPlus[timeInterval][0];
-    krnl.Q = degreesOfFreedomPlus;
-    krnl.TinvT = godunovData->TinvT;
-    krnl._prefetch.QInterpolated = plusPrefetch;
-    krnl.execute(faceInfo.plusSide, 0);
-    
-    krnl.QInterpolated = &QInterpolatedMinus[timeInterval][0];
-    krnl.Q = degreesOfFreedomMinus;
-    krnl.TinvT = godunovData->TinvT;
-    krnl._prefetch.QInterpolated = minusPrefetch;
-    krnl.execute(faceInfo.minusSide, faceInfo.faceRelation);
+  for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+    krnl.dQ(derivative) = timeDerivativeMinus + m_derivativesOffsets[derivative];
   }
+  krnl.QInterpolatedTime = &QInterpolatedMinus[0][0];
+  krnl.execute(faceInfo.minusSide, faceInfo.faceRelation);
 }
 
 void seissol::kernels::DynamicRupture::flopsGodunovState( DRFaceInformation const&  faceInfo,
                                                           long long&                o_nonZeroFlops,
                                                           long long&                o_hardwareFlops )
 {
-  m_timeKernel.flopsTaylorExpansion(o_nonZeroFlops, o_hardwareFlops);
- 
-  // 2x evaluateTaylorExpansion
-  o_nonZeroFlops *= 2;
-  o_hardwareFlops *= 2;
-  
-  o_nonZeroFlops += dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints::nonZeroFlops(faceInfo.plusSide, 0);
-  o_hardwareFlops += dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints::hardwareFlops(faceInfo.plusSide, 0);
-  
-  o_nonZeroFlops += dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints::nonZeroFlops(faceInfo.minusSide, faceInfo.faceRelation);
-  o_hardwareFlops += dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints::hardwareFlops(faceInfo.minusSide, faceInfo.faceRelation);
-  
-  o_nonZeroFlops *= CONVERGENCE_ORDER;
-  o_hardwareFlops *= CONVERGENCE_ORDER;
+  o_nonZeroFlops = dynamicRupture::kernel::evaluateAndRotateQAtTimeInterpolationPoints::nonZeroFlops(faceInfo.plusSide, 0);
+  o_hardwareFlops = dynamicRupture::kernel::evaluateAndRotateQAtTimeInterpolationPoints::hardwareFlops(faceInfo.plusSide, 0);
+
+  o_nonZeroFlops += dynamicRupture::kernel::evaluateAndRotateQAtTimeInterpolationPoints::nonZeroFlops(faceInfo.minusSide, faceInfo.faceRelation);
+  o_hardwareFlops += dynamicRupture::kernel::evaluateAndRotateQAtTimeInterpolationPoints::hardwareFlops(faceInfo.minusSide, faceInfo.faceRelation);
 }
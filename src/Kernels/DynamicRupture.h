@@ -44,7 +44,6 @@
 #include <Initializer/typedefs.hpp>
 #include <generated_code/tensor.h>
 #include <generated_code/kernel.h>
-#include <Kernels/Time.h>
 
 namespace seissol {
   namespace kernels {
@@ -54,29 +53,35 @@ namespace seissol {
 
 class seissol::kernels::DynamicRupture {
   private:
-    dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints m_krnlPrototype;
-    kernels::Time m_timeKernel;
+    dynamicRupture::kernel::evaluateAndRotateQAtTimeInterpolationPoints m_krnlPrototype;
+
+    //! offsets of the derivatives in the time derivatives buffer
+    unsigned m_derivativesOffsets[CONVERGENCE_ORDER];
+
+    //! Taylor coefficients of the derivatives at the time points, updated once per time step
+    alignas(ALIGNMENT) real m_timeBasis[CONVERGENCE_ORDER][CONVERGENCE_ORDER];
 
   public:
     double timePoints[CONVERGENCE_ORDER];
     double timeSteps[CONVERGENCE_ORDER];
     double timeWeights[CONVERGENCE_ORDER];
 
-    DynamicRupture() {}
+    DynamicRupture();
     
     void setGlobalData(GlobalData const* global);
     
     void setTimeStepWidth(double timestep);
 
+    /**
+     * Evaluates the Taylor expansion of both sides at all time points and at the interpolation points of the face.
+     **/
     void spaceTimeInterpolation(  DRFaceInformation const&    faceInfo,
                                   GlobalData const*           global,
                                   DRGodunovData const*        godunovData,
                                   real const*                 timeDerivativePlus,
                                   real const*                 timeDerivativeMinus,
                                   real                        QInterpolatedPlus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
-                                  real                        QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
-                              real const*                 timeDerivativePlus_prefetch, 
-                              real const*                 timeDerivativeMinus_prefetch);
+                                  real                        QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()] );
 
     void flopsGodunovState( DRFaceInformation const&  faceInfo,
                             long long&                o_nonZeroFlops,
@@ -66,6 +66,15 @@ class seissol::kernels::Local : public LocalBase {
                          double time,
                          double timeStepWidth);
 
+#ifdef LOCAL_BATCH_SIZE
+    /**
+     * Computes the volume and local flux integrals of a batch of cells.
+     **/
+    void computeBatchedIntegral(real const*                  i_batchedTimeIntegrated,
+                                LocalIntegrationBatch const& i_batch,
+                                real*                        io_batchedDofs);
+#endif
+
     void flopsIntegral(FaceType const i_faceTypes[4],
                        unsigned int &o_nonZeroFlops,
                        unsigned int &o_hardwareFlops );
@@ -0,0 +1,84 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Gather and scatter of the degrees of freedom of batches of cells.
+ **/
+
+#ifndef KERNELS_LOCALBATCH_H_
+#define KERNELS_LOCALBATCH_H_
+
+#ifdef LOCAL_BATCH_SIZE
+
+#include <Initializer/typedefs.hpp>
+#include <generated_code/init.h>
+#include <generated_code/tensor.h>
+
+namespace seissol {
+  namespace kernels {
+    /**
+     * Copies the degrees of freedom of a cell into a lane of a batch.
+     **/
+    inline void gatherToBatch(real const* i_cellDofs,
+                              unsigned    i_lane,
+                              real*       o_batchedDofs) {
+      auto cellView = init::Q::view::create(const_cast<real*>(i_cellDofs));
+      auto batchedView = init::batchedQ::view::create(o_batchedDofs);
+      for (unsigned quantity = 0; quantity < cellView.shape(1); ++quantity) {
+        for (unsigned basisFunction = 0; basisFunction < cellView.shape(0); ++basisFunction) {
+          batchedView(i_lane, basisFunction, quantity) = cellView(basisFunction, quantity);
+        }
+      }
+    }
+
+    /**
+     * Copies a lane of a batch into the degrees of freedom of a cell.
+     **/
+    inline void scatterFromBatch(real const* i_batchedDofs,
+                                 unsigned    i_lane,
+                                 real*       o_cellDofs) {
+      auto cellView = init::Q::view::create(o_cellDofs);
+      auto batchedView = init::batchedQ::view::create(const_cast<real*>(i_batchedDofs));
+      for (unsigned quantity = 0; quantity < cellView.shape(1); ++quantity) {
+        for (unsigned basisFunction = 0; basisFunction < cellView.shape(0); ++basisFunction) {
+          cellView(basisFunction, quantity) = batchedView(i_lane, basisFunction, quantity);
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
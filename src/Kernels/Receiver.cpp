@@ -42,7 +42,6 @@
 #include <Initializer/PointMapper.h>
 #include <Numerical_aux/Transformation.h>
 #include <Parallel/MPI.h>
-#include <Monitoring/FlopCounter.hpp>
 #include <generated_code/kernel.h>
 
 void seissol::kernels::ReceiverCluster::addReceiver(  unsigned                          meshId,
@@ -62,64 +61,124 @@ void seissol::kernels::ReceiverCluster::addReceiver(  unsigned
 
   // (time + number of quantities) * number of samples until sync point
   size_t reserved = ncols() * (m_syncPointInterval / m_samplingInterval + 1);
+  real* derivatives = ltsLut.lookup(lts.derivatives, meshId);
+  m_receiverIds[derivatives != nullptr].push_back(m_receivers.size());
   m_receivers.emplace_back( pointId,
                             xiEtaZeta[0],
                             xiEtaZeta[1],
                             xiEtaZeta[2],
                             kernels::LocalData::lookup(lts, ltsLut, meshId),
+                            derivatives,
                             reserved);
 }
 
-double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
+double seissol::kernels::ReceiverCluster::prepareSamples( double time,
                                                           double expansionPoint,
                                                           double timeStepWidth ) {
-  real timeEvaluated[tensor::Q::size()] __attribute__((aligned(ALIGNMENT)));
-  real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()] __attribute__((aligned(ALIGNMENT)));
-  real timeEvaluatedAtPoint[tensor::QAtPoint::size()] __attribute__((aligned(ALIGNMENT)));
+  m_timeStepWidth = timeStepWidth;
+  m_sampleTimes.clear();
+  m_timeVandermonde.clear();
+
+  double receiverTime = time;
+  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
+    while (receiverTime < expansionPoint + timeStepWidth) {
+      m_sampleTimes.push_back(receiverTime);
+
+      // powers in the taylor-series expansion
+      real deltaT = receiverTime - expansionPoint;
+      real power = 1.0;
+      for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+        m_timeVandermonde.push_back(power);
+        power *= deltaT / real(derivative+1);
+      }
+
+      receiverTime += m_samplingInterval;
+    }
+  }
+  return receiverTime;
+}
+
+void seissol::kernels::ReceiverCluster::calcReceivers(  bool     storedDerivatives,
+                                                        unsigned begin,
+                                                        unsigned end ) {
+  alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
+  alignas(ALIGNMENT) real recomputedDerivatives[yateto::computeFamilySize<tensor::dQ>()];
+  alignas(ALIGNMENT) real derivativesAtPoint[CONVERGENCE_ORDER][tensor::QAtPoint::size()];
+  alignas(ALIGNMENT) real timeEvaluatedAtPoint[tensor::QAtPoint::size()];
 
   kernels::LocalTmp tmp;
 
-  kernel::evaluateDOFSAtPoint krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.Q = timeEvaluated;
+  kernel::evaluateDerivativesAtPoint krnl;
+  for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+    krnl.dQAtPoint(derivative) = derivativesAtPoint[derivative];
+  }
 
   auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
 
-  double receiverTime = time;
-  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (auto& receiver : m_receivers) {
-      krnl.basisFunctions = receiver.basisFunctions.m_data.data();
+  for (unsigned r = begin; r < end; ++r) {
+    auto& receiver = m_receivers[ m_receiverIds[storedDerivatives][r] ];
 
-      m_timeKernel.computeAder( timeStepWidth,
+    real const* timeDerivatives = receiver.derivatives;
+    if (!storedDerivatives) {
+      m_timeKernel.computeAder( m_timeStepWidth,
                                 receiver.data,
                                 tmp,
                                 timeEvaluated, // useless but the interface requires it
-                                timeDerivatives );
-      g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
-      g_SeisSolHardwareFlopsOther += m_hardwareFlops;
+                                recomputedDerivatives );
+      timeDerivatives = recomputedDerivatives;
+    }
+
+    krnl.basisFunctions = receiver.basisFunctions.m_data.data();
+    for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+      krnl.dQ(derivative) = timeDerivatives + m_derivativesOffsets[derivative];
+      krnl.execute(derivative);
+    }
 
-      receiverTime = time;
-      while (receiverTime < expansionPoint + timeStepWidth) {
-        m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, timeDerivatives, timeEvaluated);
-        krnl.execute();
+    for (unsigned sample = 0; sample < m_sampleTimes.size(); ++sample) {
+      real const* vandermonde = &m_timeVandermonde[sample * CONVERGENCE_ORDER];
+      for (unsigned i = 0; i < tensor::QAtPoint::size(); ++i) {
+        timeEvaluatedAtPoint[i] = vandermonde[0] * derivativesAtPoint[0][i];
+      }
+      for (unsigned derivative = 1; derivative < CONVERGENCE_ORDER; ++derivative) {
+        for (unsigned i = 0; i < tensor::QAtPoint::size(); ++i) {
+          timeEvaluatedAtPoint[i] += vandermonde[derivative] * derivativesAtPoint[derivative][i];
+        }
+      }
 
-        receiver.output.push_back(receiverTime);
+      receiver.output.push_back(m_sampleTimes[sample]);
 #ifdef MULTIPLE_SIMULATIONS
-        for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-          for (auto quantity : m_quantities) {
-            receiver.output.push_back(qAtPoint(sim, quantity));
-          }
-        }
-#else
+      for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
         for (auto quantity : m_quantities) {
-          receiver.output.push_back(qAtPoint(quantity));
+          receiver.output.push_back(qAtPoint(sim, quantity));
         }
-#endif
-
-        receiverTime += m_samplingInterval;
       }
+#else
+      for (auto quantity : m_quantities) {
+        receiver.output.push_back(qAtPoint(quantity));
+      }
+#endif
     }
   }
-  return receiverTime;
 }
 
+void seissol::kernels::ReceiverCluster::flopsReceivers( bool       storedDerivatives,
+                                                        long long& nonZeroFlops,
+                                                        long long& hardwareFlops ) const {
+  long long receiverNonZeroFlops = 0;
+  long long receiverHardwareFlops = 0;
+  if (!storedDerivatives) {
+    receiverNonZeroFlops += m_nonZeroFlops;
+    receiverHardwareFlops += m_hardwareFlops;
+  }
+  for (unsigned derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+    receiverNonZeroFlops += kernel::evaluateDerivativesAtPoint::nonZeroFlops(derivative);
+    receiverHardwareFlops += kernel::evaluateDerivativesAtPoint::hardwareFlops(derivative);
+  }
+  // Vandermonde matrix times derivatives at the point
+  long long sampleFlops = (2 * CONVERGENCE_ORDER - 1) * tensor::QAtPoint::size();
+  receiverNonZeroFlops += m_sampleTimes.size() * sampleFlops;
+  receiverHardwareFlops += m_sampleTimes.size() * sampleFlops;
+
+  nonZeroFlops = numberOfReceivers(storedDerivatives) * receiverNonZeroFlops;
+  hardwareFlops = numberOfReceivers(storedDerivatives) * receiverHardwareFlops;
+}
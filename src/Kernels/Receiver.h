@@ -55,16 +55,19 @@ class GlobalData;
 namespace seissol {
   namespace kernels {
     struct Receiver {
-      Receiver(unsigned pointId, double xi, double eta, double zeta, kernels::LocalData data, size_t reserved)
+      Receiver(unsigned pointId, double xi, double eta, double zeta, kernels::LocalData data, real* derivatives, size_t reserved)
         : pointId(pointId),
           basisFunctions(CONVERGENCE_ORDER, xi, eta, zeta),
-          data(data)
+          data(data),
+          derivatives(derivatives)
       {
         output.reserve(reserved);
       }
       unsigned pointId;
       basisFunction::SampledBasisFunctions<real> basisFunctions;
       kernels::LocalData data;
+      //! time derivatives stored by the local integration, nullptr if the cell does not store them
+      real* derivatives;
       std::vector<real> output;
     };
 
@@ -80,9 +83,15 @@ namespace seissol {
                         double                        samplingInterval,
                         double                        syncPointInterval )
         : m_quantities(quantities),
-          m_samplingInterval(samplingInterval), m_syncPointInterval(syncPointInterval) {
+          m_samplingInterval(samplingInterval), m_syncPointInterval(syncPointInterval),
+          m_timeStepWidth(0.0) {
         m_timeKernel.setGlobalData(global);
         m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+
+        m_derivativesOffsets[0] = 0;
+        for (unsigned order = 1; order < CONVERGENCE_ORDER; ++order) {
+          m_derivativesOffsets[order] = m_derivativesOffsets[order-1] + tensor::dQ::size(order-1);
+        }
       }
 
       void addReceiver( unsigned          meshId,
@@ -92,10 +101,43 @@ namespace seissol {
                         seissol::initializers::Lut const& ltsLut,
                         seissol::initializers::LTS const& lts );
 
-      //! Returns new receiver time
-      double calcReceivers( double time,
-                            double expansionPoint,
-                            double timeStepWidth );
+      /**
+       * Computes the sample times in [time, expansionPoint + timeStepWidth) and the
+       * Vandermonde matrix of the Taylor expansion at the sample times.
+       *
+       * @return new receiver time
+       **/
+      double prepareSamples( double time,
+                             double expansionPoint,
+                             double timeStepWidth );
+
+      //! Number of samples of the current time step
+      unsigned numberOfSamples() const {
+        return m_sampleTimes.size();
+      }
+
+      /**
+       * Number of receivers whose cells store the time derivatives (storedDerivatives = true)
+       * or whose time derivatives are recomputed (storedDerivatives = false).
+       **/
+      unsigned numberOfReceivers( bool storedDerivatives ) const {
+        return m_receiverIds[storedDerivatives].size();
+      }
+
+      /**
+       * Evaluates the receivers [begin, end) of the given kind at all samples of the current time step.
+       * Receivers with recomputed derivatives must be evaluated before the local integration,
+       * receivers with stored derivatives after the local integration.
+       * Disjoint ranges may be evaluated concurrently.
+       **/
+      void calcReceivers( bool     storedDerivatives,
+                          unsigned begin,
+                          unsigned end );
+
+      //! Flops of calcReceivers for all receivers of the given kind in the current time step
+      void flopsReceivers( bool       storedDerivatives,
+                           long long& nonZeroFlops,
+                           long long& hardwareFlops ) const;
 
       std::vector<Receiver>::iterator begin() {
         return m_receivers.begin();
@@ -115,12 +157,19 @@ namespace seissol {
 
     private:
       std::vector<Receiver>   m_receivers;
+      //! indices of the receivers with recomputed [0] and stored [1] time derivatives
+      std::vector<unsigned>   m_receiverIds[2];
       seissol::kernels::Time  m_timeKernel;
       std::vector<unsigned>   m_quantities;
       unsigned                m_nonZeroFlops;
       unsigned                m_hardwareFlops;
       double                  m_samplingInterval;
       double                  m_syncPointInterval;
+      double                  m_timeStepWidth;
+      unsigned                m_derivativesOffsets[CONVERGENCE_ORDER];
+      std::vector<double>     m_sampleTimes;
+      //! (t_j - t_0)^d / d! for sample j and derivative d
+      std::vector<real>       m_timeVandermonde;
     };
   }
 }
@@ -95,6 +95,17 @@ class seissol::kernels::Time : public TimeBase {
                       real                        o_timeIntegrated[tensor::I::size()],
                       real*                       o_timeDerivatives = NULL );
 
+#ifdef LOCAL_BATCH_SIZE
+    /**
+     * Computes the time integrated degrees of freedom of a batch of cells.
+     * The time derivatives are not stored.
+     **/
+    void computeBatchedAder( double                       i_timeStepWidth,
+                             LocalIntegrationBatch const& i_batch,
+                             real const*                  i_batchedDofs,
+                             real*                        o_batchedTimeIntegrated );
+#endif
+
     void flopsAder( unsigned int &o_nonZeroFlops,
                     unsigned int &o_hardwareFlops );
 
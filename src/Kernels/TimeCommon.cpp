@@ -39,7 +39,9 @@
  **/
 
 #include "TimeCommon.h"
+#include <Numerical_aux/ReducedPrecision.h>
 #include <stdint.h>
+#include <yateto.h>
 
 void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
                                                     unsigned short i_ltsSetup,
@@ -53,13 +55,13 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
   /*
    * assert valid input.
    */
-  // only lower 10 bits are used for lts encoding
-  assert (i_ltsSetup < 2048 );
+  // only lower 11 bits are used for lts encoding, bits 12-15 mark neighbors in reduced precision
+  assert ( (i_ltsSetup & 0x0fff) < 2048 );
 
 #ifndef NDEBUG
   // alignment of the time derivatives/integrated dofs and the buffer
   for( int l_dofeighbor = 0; l_dofeighbor < 4; l_dofeighbor++ ) {
-    assert( ((uintptr_t)i_timeDofs[l_dofeighbor])          % ALIGNMENT == 0 );
+    assert( (i_ltsSetup >> (l_dofeighbor + 12)) % 2 == 1 || ((uintptr_t)i_timeDofs[l_dofeighbor]) % ALIGNMENT == 0 );
     assert( ((uintptr_t)o_integrationBuffer[l_dofeighbor]) % ALIGNMENT == 0 );
   }
 #endif
@@ -71,16 +73,32 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
     // collect information only in the case that neighboring element contributions are required
     if (i_faceTypes[l_dofeighbor] != FaceType::outflow &&
 	i_faceTypes[l_dofeighbor] != FaceType::dynamicRupture) {
+      // neighbor in the ghost layer stored in reduced precision
+      bool l_reduced = (i_ltsSetup >> (l_dofeighbor + 12) ) % 2 == 1;
+      reduced_real const* l_reducedDofs = reinterpret_cast<reduced_real const*>(i_timeDofs[l_dofeighbor]);
+
       // check if the time integration is already done (-> copy pointer)
       if( (i_ltsSetup >> l_dofeighbor ) % 2 == 0 ) {
-        o_timeIntegrated[l_dofeighbor] = i_timeDofs[l_dofeighbor];
+        if( l_reduced ) {
+          reducedPrecision::decompress( l_reducedDofs, tensor::I::size(), o_integrationBuffer[l_dofeighbor] );
+          o_timeIntegrated[l_dofeighbor] = o_integrationBuffer[ l_dofeighbor];
+        } else {
+          o_timeIntegrated[l_dofeighbor] = i_timeDofs[l_dofeighbor];
+        }
       }
       // integrate the DOFs in time via the derivatives and set pointer to local buffer
       else {
+        real const* l_derivatives = i_timeDofs[l_dofeighbor];
+        alignas(ALIGNMENT) real l_expandedDerivatives[yateto::computeFamilySize<tensor::dQ>()];
+        if( l_reduced ) {
+          reducedPrecision::decompress( l_reducedDofs, yateto::computeFamilySize<tensor::dQ>(), l_expandedDerivatives );
+          l_derivatives = l_expandedDerivatives;
+        }
+
         i_time.computeIntegral( i_currentTime[    l_dofeighbor+1],
                                 i_currentTime[    0           ],
                                 i_currentTime[    0           ] + i_timeStepWidth,
-                                i_timeDofs[       l_dofeighbor],
+                                l_derivatives,
                                 o_integrationBuffer[ l_dofeighbor] );
 
         o_timeIntegrated[l_dofeighbor] = o_integrationBuffer[ l_dofeighbor];
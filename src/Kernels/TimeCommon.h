@@ -64,6 +64,8 @@ namespace seissol {
        *   2 - 1: DOFs of cell 2 are integrated in time via time derivaitves.
        *   3 - 0: time itnegrated DOFs of cell 3 are copied from the buffer.
        *
+       *   Bits 12-15 mark neighbors in the ghost layer stored in reduced precision; those are converted to real.
+       *
        * @param i_ltsSetup bitmask for the LTS setup.
        * @param i_faceTypes face types of the neighboring cells.
        * @param i_currentTime current time of the cell [0] and it's four neighbors [1], [2], [3] and [4].
@@ -5,6 +5,8 @@
   #include <mpi.h>
 #endif
 
+#include <stdint.h>
+
 #if REAL_SIZE == 8
 #  define DOUBLE_PRECISION
 #elif REAL_SIZE == 4
@@ -20,6 +22,17 @@ typedef float real;
 typedef double real;
 #endif
 
+/*
+ * Reduced precision for the storage and communication of the ghost layer:
+ * float for double precision and bfloat16 (stored in an uint16_t) for single precision.
+ */
+#ifdef SINGLE_PRECISION
+typedef uint16_t reduced_real;
+#endif
+#ifdef DOUBLE_PRECISION
+typedef float reduced_real;
+#endif
+
 
 #ifdef USE_MPI
 #ifdef SINGLE_PRECISION
@@ -28,6 +41,13 @@ typedef double real;
 #ifdef DOUBLE_PRECISION
 #define MPI_C_REAL MPI_DOUBLE
 #endif
+
+#ifdef SINGLE_PRECISION
+#define MPI_C_REDUCED_REAL MPI_UINT16_T
+#endif
+#ifdef DOUBLE_PRECISION
+#define MPI_C_REDUCED_REAL MPI_FLOAT
+#endif
 #endif
 
 #endif
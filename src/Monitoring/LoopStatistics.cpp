@@ -40,6 +40,7 @@
 #include "LoopStatistics.h"
 
 #include <cmath>
+#include <limits>
 #ifdef USE_NETCDF
 #include <netcdf.h>
 #include <netcdf_par.h>
@@ -71,7 +72,9 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
     sums[5*region + 2] = xy;
     sums[5*region + 3] = y;
     sums[5*region + 4] = N;
-    totalTimePerRank += y;
+    if (m_includeInSummary[region]) {
+      totalTimePerRank += y;
+    }
   }
 
   int rank;
@@ -86,9 +89,19 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
 
   const auto loadImbalance = 1.0 - summary.mean / summary.max;
   logInfo(rank) << "Load imbalance:" << 100.0 * loadImbalance << "%";
+  if (m_predictedImbalance >= 0.0) {
+    logInfo(rank) << "Load imbalance predicted by the partitioning:" << 100.0 * m_predictedImbalance << "%";
+  }
 
   MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, comm);
 
+  auto flops = std::vector<long long>(2*nRegions);
+  for (unsigned region = 0; region < nRegions; ++region) {
+    flops[2*region + 0] = m_nonZeroFlops[region];
+    flops[2*region + 1] = m_hardwareFlops[region];
+  }
+  MPI_Allreduce(MPI_IN_PLACE, flops.data(), flops.size(), MPI_LONG_LONG, MPI_SUM, comm);
+
   auto regressionCoeffs = std::vector<double>(2*nRegions);
   auto stderror = std::vector<double>(nRegions, 0.0);
   for (unsigned region = 0; region < nRegions; ++region) {
@@ -119,6 +132,16 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
   }
 
   if (rank == 0) {
+    std::string calibrationFile = utils::Env::get<std::string>("SEISSOL_LTS_CALIBRATION_OUTPUT", "");
+    std::ofstream calibration;
+    if (!calibrationFile.empty()) {
+      calibration.open(calibrationFile.c_str());
+      if (!calibration) {
+        logWarning(rank) << "Could not open calibration file" << calibrationFile;
+      }
+      calibration << std::setprecision(std::numeric_limits<double>::max_digits10);
+    }
+
     double totalTime = 0.0;
     logInfo(rank) << "Regression analysis of compute kernels:";
     for (unsigned region = 0; region < nRegions; ++region) {
@@ -127,6 +150,25 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
       double const y = sums[5*region + 3];
       double const N = sums[5*region + 4];
 
+      if (flops[2*region + 1] > 0 && y > 0.0) {
+        logInfo(rank) << m_regions[region]
+                      << "(flops): non-zero GFLOP =" << 1.0e-9 * flops[2*region + 0]
+                      << ", hardware GFLOP =" << 1.0e-9 * flops[2*region + 1]
+                      << ", hardware GFLOPS per rank =" << 1.0e-9 * flops[2*region + 1] / y;
+      }
+
+      // all samples have the same loop length, e.g. idle times of tasks
+      if (N*x2 - x*x <= 0.0) {
+        logInfo(rank) << m_regions[region]
+                      << "(mean):"
+                      << (N > 0.0 ? y / N : 0.0)
+                      << "(sample size:" << N << ")";
+        if (m_includeInSummary[region]) {
+          totalTime += y;
+        }
+        continue;
+      }
+
       double const xm = x / N;
       double const xv = x2 - 2*x*xm + xm*xm;
 
@@ -140,7 +182,19 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
                       << regressionCoeffs[2 * region + c]
                       << "(sample size:" << N << ", standard error:" << se << ")";
       }
-      totalTime += y;
+      if (m_includeInSummary[region]) {
+        totalTime += y;
+      }
+
+      if (calibration.is_open()) {
+        calibration << m_regions[region] << ' '
+                    << regressionCoeffs[2 * region + 0] << ' '
+                    << regressionCoeffs[2 * region + 1] << std::endl;
+      }
+    }
+
+    if (calibration.is_open()) {
+      logInfo(rank) << "Wrote LTS weight calibration to" << calibrationFile;
     }
 
     logInfo(rank) << "Total time spent in compute kernels:" << totalTime;
@@ -50,10 +50,17 @@
 namespace seissol {
 class LoopStatistics {
 public:
-  void addRegion(std::string const& name) {
+  /**
+   * @param includeInSummary false for regions which do not measure compute time,
+   *                         e.g. waiting times; these are excluded from the total time.
+   */
+  void addRegion(std::string const& name, bool includeInSummary = true) {
     m_regions.push_back(name);
+    m_includeInSummary.push_back(includeInSummary);
     m_stopwatch.push_back(Stopwatch());
     m_times.push_back(std::vector<Sample>());
+    m_nonZeroFlops.push_back(0);
+    m_hardwareFlops.push_back(0);
   }
   
   unsigned getRegion(std::string const& name) {
@@ -73,7 +80,47 @@ public:
     m_times[region].push_back(sample);
   }
 
+  /**
+   * Adds a sample which was measured by the caller.
+   * May be called concurrently by multiple threads.
+   */
+  void addSample(unsigned region, unsigned numIterations, double time) {
+    Sample sample;
+    sample.time = time;
+    sample.numIters = numIterations;
+#ifdef _OPENMP
+    #pragma omp critical (LoopStatistics_addSample)
+#endif
+    m_times[region].push_back(sample);
+  }
+
+  /**
+   * Adds flops to a region; the summary reports the flop rate for regions with flops.
+   * May be called concurrently by multiple threads.
+   */
+  void addFlops(unsigned region, long long nonZeroFlops, long long hardwareFlops) {
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    m_nonZeroFlops[region] += nonZeroFlops;
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    m_hardwareFlops[region] += hardwareFlops;
+  }
+
+  /**
+   * Sets the load imbalance predicted by the partitioning (reported in the summary)
+   */
+  void setPredictedImbalance(double imbalance) {
+    m_predictedImbalance = imbalance;
+  }
+
 #ifdef USE_MPI  
+  /**
+   * Prints the regression analysis of all regions. If SEISSOL_LTS_CALIBRATION_OUTPUT is set,
+   * the coefficients are also written to this file and can be used to calibrate the LTS weights.
+   */
   void printSummary(MPI_Comm comm);
 #endif
 
@@ -87,7 +134,11 @@ private:
   
   std::vector<Stopwatch> m_stopwatch;
   std::vector<std::string> m_regions;
+  std::vector<bool> m_includeInSummary;
   std::vector<std::vector<Sample>> m_times;
+  std::vector<long long> m_nonZeroFlops;
+  std::vector<long long> m_hardwareFlops;
+  double m_predictedImbalance = -1.0;
 };
 }
 
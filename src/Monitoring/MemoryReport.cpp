@@ -0,0 +1,213 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Memory footprint of the LTS trees and global data.
+ **/
+
+#include "MemoryReport.h"
+
+#include <Parallel/MPI.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace {
+  char const* memkindName(seissol::memory::Memkind memkind) {
+    return (memkind == seissol::memory::HighBandwidth) ? "HighBandwidth" : "Standard";
+  }
+}
+
+void seissol::MemoryReport::add(std::string const& structure, std::string const& name, std::string const& layer, int cluster, memory::Memkind memkind, unsigned long long bytes) {
+  Entry entry;
+  entry.structure = structure;
+  entry.name = name;
+  entry.layer = layer;
+  entry.cluster = cluster;
+  entry.memkind = memkind;
+  entry.bytes = bytes;
+  m_entries.push_back(entry);
+}
+
+void seissol::MemoryReport::addTree(char const* structure, initializers::LTSTree& tree) {
+  // Ranks may have a different number of clusters; report the maximum everywhere
+  unsigned numberOfClusters = tree.numChildren();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfClusters, 1, MPI_UNSIGNED, MPI_MAX, seissol::MPI::mpi.comm());
+#endif
+
+  const LayerType layers[] = {Ghost, Copy, Interior};
+  const char* layerNames[] = {"Ghost", "Copy", "Interior"};
+
+  unsigned long long used[2] = {0, 0};
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    for (unsigned l = 0; l < 3; ++l) {
+      initializers::Layer* layer = nullptr;
+      if (tc < tree.numChildren()) {
+        layer = (layers[l] == Ghost) ? &tree.child(tc).child<Ghost>()
+              : (layers[l] == Copy)  ? &tree.child(tc).child<Copy>()
+                                     : &tree.child(tc).child<Interior>();
+      }
+
+      for (unsigned var = 0; var < tree.getNumberOfVariables(); ++var) {
+        initializers::MemoryInfo const& info = tree.info(var);
+        if ((initializers::LayerMask(layers[l]) & info.mask).any()) {
+          continue;
+        }
+        unsigned long long bytes = (layer != nullptr) ? static_cast<unsigned long long>(layer->getNumberOfCells()) * info.bytes : 0;
+        used[info.memkind] += bytes;
+        add(structure, info.name, layerNames[l], tc, info.memkind, bytes);
+      }
+
+      for (unsigned bucket = 0; bucket < tree.getNumberOfBuckets(); ++bucket) {
+        initializers::MemoryInfo const& info = tree.bucketMemoryInfo(bucket);
+        initializers::Bucket handle;
+        handle.index = bucket;
+        unsigned long long bytes = (layer != nullptr) ? layer->getBucketSize(handle) : 0;
+        used[info.memkind] += bytes;
+        add(structure, info.name, layerNames[l], tc, info.memkind, bytes);
+      }
+    }
+  }
+
+  unsigned long long allocated[2] = {0, 0};
+  for (auto const& allocation : tree.allocator().allocations()) {
+    allocated[allocation.memkind] += allocation.size;
+  }
+  for (unsigned memkind = 0; memkind < 2; ++memkind) {
+    add(structure, "(padding)", "-", -1, static_cast<memory::Memkind>(memkind), allocated[memkind] - used[memkind]);
+  }
+
+  m_spilledBytes += tree.allocator().spilledBytes();
+}
+
+void seissol::MemoryReport::addAllocator(char const* structure, memory::ManagedAllocator const& allocator) {
+  // Group by label in order of the first allocation
+  std::vector<std::pair<std::string, memory::Memkind>> keys;
+  std::vector<unsigned long long> bytes;
+  for (auto const& allocation : allocator.allocations()) {
+    std::pair<std::string, memory::Memkind> key(allocation.name[0] != '\0' ? allocation.name : "other", allocation.memkind);
+    auto it = std::find(keys.begin(), keys.end(), key);
+    if (it == keys.end()) {
+      keys.push_back(key);
+      bytes.push_back(allocation.size);
+    } else {
+      bytes[it - keys.begin()] += allocation.size;
+    }
+  }
+
+  for (unsigned k = 0; k < keys.size(); ++k) {
+    add(structure, keys[k].first, "-", -1, keys[k].second, bytes[k]);
+  }
+
+  m_spilledBytes += allocator.spilledBytes();
+}
+
+void seissol::MemoryReport::print(std::string const& fileName) {
+  const int rank = seissol::MPI::mpi.rank();
+  const int size = seissol::MPI::mpi.size();
+
+  // Per rank: all entries, the entries summed over layers and clusters and the totals per memkind
+  std::vector<std::string> groups;
+  std::vector<unsigned> groupOfEntry(m_entries.size());
+  for (unsigned e = 0; e < m_entries.size(); ++e) {
+    std::string group = m_entries[e].structure + "." + m_entries[e].name + " (" + memkindName(m_entries[e].memkind) + ")";
+    auto it = std::find(groups.begin(), groups.end(), group);
+    groupOfEntry[e] = it - groups.begin();
+    if (it == groups.end()) {
+      groups.push_back(group);
+    }
+  }
+
+  const unsigned numberOfEntries = m_entries.size();
+  const unsigned numberOfGroups = groups.size();
+  std::vector<unsigned long long> local(numberOfEntries + numberOfGroups + 2, 0);
+  for (unsigned e = 0; e < numberOfEntries; ++e) {
+    local[e] = m_entries[e].bytes;
+    local[numberOfEntries + groupOfEntry[e]] += m_entries[e].bytes;
+    local[numberOfEntries + numberOfGroups + m_entries[e].memkind] += m_entries[e].bytes;
+  }
+
+  std::vector<unsigned long long> minimum(local), maximum(local), sum(local);
+  unsigned long long spilled = m_spilledBytes;
+#ifdef USE_MPI
+  MPI_Comm comm = seissol::MPI::mpi.comm();
+  MPI_Allreduce(local.data(), minimum.data(), local.size(), MPI_UNSIGNED_LONG_LONG, MPI_MIN, comm);
+  MPI_Allreduce(local.data(), maximum.data(), local.size(), MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+  MPI_Allreduce(local.data(), sum.data(), local.size(), MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &spilled, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+#endif
+
+  const double MiB = 1024.0 * 1024.0;
+  auto format = [&](unsigned i) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(1)
+       << minimum[i] / MiB << " / " << maximum[i] / MiB << " / " << sum[i] / (MiB * size);
+    return ss.str();
+  };
+
+  logInfo(rank) << "Memory usage per rank in MiB (min / max / mean):";
+  for (unsigned g = 0; g < numberOfGroups; ++g) {
+    unsigned i = numberOfEntries + g;
+    if (maximum[i] > 0) {
+      logInfo(rank) << " " << groups[g] << ":" << format(i);
+    }
+  }
+  for (unsigned memkind = 0; memkind < 2; ++memkind) {
+    unsigned i = numberOfEntries + numberOfGroups + memkind;
+    if (maximum[i] > 0) {
+      logInfo(rank) << " Total" << memkindName(static_cast<memory::Memkind>(memkind)) << "memory:" << format(i);
+    }
+  }
+
+  if (spilled > 0) {
+    logWarning(rank) << "High-bandwidth memory spilled to standard memory:" << spilled / MiB << "MiB of high-bandwidth allocations (max over ranks) are not placed in high-bandwidth memory.";
+  }
+
+  if (rank == 0 && !fileName.empty()) {
+    std::ofstream file(fileName);
+    file << "structure,name,layer,cluster,memkind,min,max,mean" << std::endl;
+    for (unsigned e = 0; e < numberOfEntries; ++e) {
+      Entry const& entry = m_entries[e];
+      file << entry.structure << "," << entry.name << "," << entry.layer << "," << entry.cluster << ","
+           << memkindName(entry.memkind) << "," << minimum[e] << "," << maximum[e] << ","
+           << std::fixed << std::setprecision(1) << static_cast<double>(sum[e]) / size << std::endl;
+    }
+    logInfo(rank) << "Wrote memory report to" << fileName;
+  }
+}
@@ -0,0 +1,91 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Memory footprint of the LTS trees and global data.
+ **/
+
+#ifndef MONITORING_MEMORYREPORT_H_
+#define MONITORING_MEMORYREPORT_H_
+
+#include <string>
+#include <vector>
+
+#include <Initializer/MemoryAllocator.h>
+#include <Initializer/tree/LTSTree.hpp>
+
+namespace seissol {
+class MemoryReport {
+public:
+  MemoryReport() : m_spilledBytes(0) {}
+
+  /**
+   * Adds all variables and buckets of a tree, split by time cluster and layer.
+   * The difference to the allocated regions is reported as padding.
+   * Collective operation, such that all ranks report the same entries.
+   */
+  void addTree(char const* structure, initializers::LTSTree& tree);
+
+  /**
+   * Adds the allocations of a managed allocator, grouped by their label.
+   */
+  void addAllocator(char const* structure, memory::ManagedAllocator const& allocator);
+
+  /**
+   * Prints min/max/mean over all ranks and writes all entries to a CSV file (if fileName is not empty).
+   * Collective operation.
+   */
+  void print(std::string const& fileName);
+
+private:
+  struct Entry {
+    std::string structure;
+    std::string name;
+    //! Ghost, Copy, Interior or "-" if not associated with a layer
+    std::string layer;
+    //! time cluster or -1
+    int cluster;
+    memory::Memkind memkind;
+    unsigned long long bytes;
+  };
+
+  void add(std::string const& structure, std::string const& name, std::string const& layer, int cluster, memory::Memkind memkind, unsigned long long bytes);
+
+  std::vector<Entry> m_entries;
+
+  unsigned long long m_spilledBytes;
+};
+}
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Conversion between real and the reduced precision of the ghost layer.
+ **/
+
+#ifndef NUMERICAL_AUX_REDUCEDPRECISION_H_
+#define NUMERICAL_AUX_REDUCEDPRECISION_H_
+
+#include <Kernels/precision.hpp>
+
+#include <cstring>
+#include <stdint.h>
+
+namespace seissol {
+  namespace reducedPrecision {
+    /** Converts a float to bfloat16 (round to nearest even).
+     */
+    inline uint16_t toBFloat16(float value) {
+      uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        // keep NaNs quiet
+        return static_cast<uint16_t>((bits >> 16) | 0x0040u);
+      }
+      bits += 0x7fffu + ((bits >> 16) & 1u);
+      return static_cast<uint16_t>(bits >> 16);
+    }
+
+    /** Converts a bfloat16 to float (exact).
+     */
+    inline float fromBFloat16(uint16_t value) {
+      uint32_t bits = static_cast<uint32_t>(value) << 16;
+      float result;
+      std::memcpy(&result, &bits, sizeof(result));
+      return result;
+    }
+
+    inline reduced_real toReduced(real value) {
+#ifdef DOUBLE_PRECISION
+      return static_cast<float>(value);
+#else
+      return toBFloat16(value);
+#endif
+    }
+
+    inline real fromReduced(reduced_real value) {
+#ifdef DOUBLE_PRECISION
+      return static_cast<real>(value);
+#else
+      return fromBFloat16(value);
+#endif
+    }
+
+    /** Relative rounding error of toReduced.
+     */
+    inline double unitRoundoff() {
+#ifdef DOUBLE_PRECISION
+      return 1.0 / (1 << 24);
+#else
+      return 1.0 / (1 << 8);
+#endif
+    }
+
+    /** Converts numberOfValues reals to reduced precision.
+     */
+    inline void compress(real const* values, unsigned numberOfValues, reduced_real* reduced) {
+      for (unsigned i = 0; i < numberOfValues; ++i) {
+        reduced[i] = toReduced(values[i]);
+      }
+    }
+
+    /** Converts numberOfValues values in reduced precision to reals.
+     */
+    inline void decompress(reduced_real const* reduced, unsigned numberOfValues, real* values) {
+      for (unsigned i = 0; i < numberOfValues; ++i) {
+        values[i] = fromReduced(reduced[i]);
+      }
+    }
+  }
+}
+
+#endif
@@ -1245,6 +1245,9 @@ MODULE TypesDef
      INTEGER                                :: Refinement
      integer                                :: SurfaceOutput, SurfaceOutputRefinement
      real                                   :: SurfaceOutputInterval
+     integer                                :: SurfaceGroundMotion              !< In-situ peak ground motions and response spectra
+     real                                   :: SurfaceGroundMotionPeriods(1:10) !< Periods of the response spectra (only periods > 0 are used)
+     real                                   :: SurfaceGroundMotionDamping       !< Damping ratio of the response spectra
      real                                   :: ReceiverOutputInterval
      character(len=64)                      :: xdmfWriterBackend                !< Check point backend
   END TYPE tInputOutput
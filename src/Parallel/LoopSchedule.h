@@ -0,0 +1,117 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Loop schedules shared by the compute loops and the initialization of the memory.
+ **/
+
+#ifndef PARALLEL_LOOPSCHEDULE_H_
+#define PARALLEL_LOOPSCHEDULE_H_
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace seissol {
+  namespace parallel {
+    /**
+     * Computes the iterations [begin, end) which are assigned to a thread
+     * by "#pragma omp for schedule(static)" without chunk size, i.e. the
+     * first (numberOfIterations % numberOfThreads) threads get one additional iteration.
+     **/
+    inline void staticRange( unsigned  numberOfIterations,
+                             unsigned  numberOfThreads,
+                             unsigned  thread,
+                             unsigned& begin,
+                             unsigned& end ) {
+      unsigned chunk = numberOfIterations / numberOfThreads;
+      unsigned remainder = numberOfIterations % numberOfThreads;
+      if (thread < remainder) {
+        ++chunk;
+        begin = thread * chunk;
+      } else {
+        begin = thread * chunk + remainder;
+      }
+      end = begin + chunk;
+    }
+
+    /**
+     * Calls body(begin, end) with the same distribution of iterations to threads
+     * as "#pragma omp parallel for schedule(static)".
+     **/
+    template<typename Body>
+    void forStatic( unsigned numberOfIterations, Body body ) {
+#ifdef _OPENMP
+      #pragma omp parallel
+      {
+        unsigned begin, end;
+        staticRange(numberOfIterations, omp_get_num_threads(), omp_get_thread_num(), begin, end);
+        if (begin < end) {
+          body(begin, end);
+        }
+      }
+#else
+      if (numberOfIterations > 0) {
+        body(0, numberOfIterations);
+      }
+#endif
+    }
+
+    /**
+     * Calls body(begin, end) for chunks of at most chunkSize iterations.
+     * Each chunk is an OpenMP task, which may be executed by any idle thread of the
+     * enclosing team. Returns after all chunks are finished; the calling thread
+     * executes other tasks while waiting.
+     * Must be called from within a parallel region.
+     **/
+    template<typename Body>
+    void forChunks( unsigned numberOfIterations, unsigned chunkSize, Body body ) {
+      // taskgroup instead of taskwait: only wait for the chunks, not for sibling tasks of the caller
+#ifdef _OPENMP
+      #pragma omp taskgroup
+#endif
+      {
+        for (unsigned begin = 0; begin < numberOfIterations; begin += chunkSize) {
+          unsigned end = (begin + chunkSize < numberOfIterations) ? begin + chunkSize : numberOfIterations;
+#ifdef _OPENMP
+          #pragma omp task firstprivate(begin, end) shared(body)
+#endif
+          body(begin, end);
+        }
+      }
+    }
+  }
+}
+
+#endif
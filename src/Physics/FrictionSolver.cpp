@@ -0,0 +1,609 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * C++ friction solver for dynamic rupture.
+ **/
+
+#include "FrictionSolver.h"
+
+#include <Parallel/MPI.h>
+#include <generated_code/init.h>
+#include <utils/env.h>
+#include <utils/logger.h>
+#include <utils/stringutils.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace {
+  //! slip rate is considered as being zero for instantaneous healing
+  constexpr double HealingSlipRate = 10e-14;
+  //! slip rate at which the rupture front arrives
+  constexpr double RuptureFrontSlipRate = 0.001;
+
+  inline void copyFace(double const* from, double* to, unsigned offset, unsigned numberOfPoints) {
+    if (from != nullptr && to != nullptr) {
+      std::memcpy(to + offset, from + offset, numberOfPoints * sizeof(double));
+    }
+  }
+}
+
+seissol::physics::FrictionSolver::Mode seissol::physics::FrictionSolver::requestedMode()
+{
+  std::string frictionSolver = utils::Env::get<const char*>("SEISSOL_FRICTION_SOLVER", "fortran");
+  utils::StringUtils::toLower(frictionSolver);
+  if (frictionSolver == "cpp") {
+    return Cpp;
+  }
+  if (frictionSolver == "check") {
+    return Check;
+  }
+  if (frictionSolver != "fortran") {
+    logError() << "Unknown friction solver" << frictionSolver;
+  }
+  return Fortran;
+}
+
+void seissol::physics::FrictionSolver::init(Mode mode, FrictionState const& state)
+{
+  const int rank = seissol::MPI::mpi.rank();
+
+  m_state = state;
+  m_mode = mode;
+  m_maxDifference = 0.0;
+  m_numberOfChecks = 0;
+
+  if (m_mode == Fortran || m_state.frictionLaw == 0) {
+    m_mode = Fortran;
+    return;
+  }
+
+  if (!supports(m_state.frictionLaw)) {
+    logInfo(rank) << "The C++ friction solver does not support friction law" << m_state.frictionLaw << "; using the Fortran implementation.";
+    m_mode = Fortran;
+    return;
+  }
+
+  if (m_state.numberOfPoints != static_cast<int>(NumberOfPoints)) {
+    logError() << "Number of points per fault face does not match:" << m_state.numberOfPoints << "vs." << NumberOfPoints;
+  }
+
+  if (m_state.frictionLaw == 2 || m_state.frictionLaw == 16) {
+    if (m_state.muS == nullptr || m_state.muD == nullptr || m_state.dC == nullptr || m_state.dynStressFront == nullptr
+        || (m_state.frictionLaw == 16 && m_state.forcedRuptureTime == nullptr)) {
+      logError() << "Linear slip weakening parameters are missing.";
+    }
+  }
+
+  logInfo(rank) << "Evaluating friction law" << m_state.frictionLaw << "with the C++ friction solver"
+    << (m_mode == Check ? "(checked against the Fortran implementation)." : ".");
+}
+
+void seissol::physics::FrictionSolver::evaluate(seissol::initializers::Layer& layer,
+                                                seissol::initializers::DynamicRupture const& dynRup,
+                                                unsigned faceBegin,
+                                                unsigned faceEnd,
+                                                double fullUpdateTime,
+                                                double const timePoints[CONVERGENCE_ORDER],
+                                                double const timeWeights[CONVERGENCE_ORDER])
+{
+  DRFaceInformation const* faceInformation = layer.var(dynRup.faceInformation);
+  real (*QInterpolatedPlus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()] = layer.var(dynRup.QInterpolatedPlus);
+  real (*QInterpolatedMinus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()] = layer.var(dynRup.QInterpolatedMinus);
+  real (*imposedStatePlus)[tensor::QInterpolated::size()] = layer.var(dynRup.imposedStatePlus);
+  real (*imposedStateMinus)[tensor::QInterpolated::size()] = layer.var(dynRup.imposedStateMinus);
+  seissol::model::IsotropicWaveSpeeds const* waveSpeedsPlus = layer.var(dynRup.waveSpeedsPlus);
+  seissol::model::IsotropicWaveSpeeds const* waveSpeedsMinus = layer.var(dynRup.waveSpeedsMinus);
+
+  double deltaT[CONVERGENCE_ORDER];
+  deltaT[0] = timePoints[0];
+  for (unsigned timePoint = 1; timePoint < CONVERGENCE_ORDER; ++timePoint) {
+    deltaT[timePoint] = timePoints[timePoint] - timePoints[timePoint-1];
+  }
+  // to fill last segment of Gaussian integration
+  deltaT[CONVERGENCE_ORDER-1] += deltaT[0];
+
+  for (unsigned face = faceBegin; face < faceEnd; ++face) {
+    unsigned meshFace = faceInformation[face].meshFace;
+
+    // the fault output reads the state before the update
+    unsigned offset = meshFace * NumberOfPoints;
+    copyFace(m_state.mu,            m_state.outputMu,            offset, NumberOfPoints);
+    copyFace(m_state.strength,      m_state.outputStrength,      offset, NumberOfPoints);
+    copyFace(m_state.slip,          m_state.outputSlip,          offset, NumberOfPoints);
+    copyFace(m_state.slip1,         m_state.outputSlip1,         offset, NumberOfPoints);
+    copyFace(m_state.slip2,         m_state.outputSlip2,         offset, NumberOfPoints);
+    copyFace(m_state.ruptureTime,   m_state.outputRuptureTime,   offset, NumberOfPoints);
+    copyFace(m_state.peakSlipRate,  m_state.outputPeakSlipRate,  offset, NumberOfPoints);
+    copyFace(m_state.dynStressTime, m_state.outputDynStressTime, offset, NumberOfPoints);
+    copyFace(m_state.stateVariable, m_state.outputStateVariable, offset, NumberOfPoints);
+
+    evaluateFace(meshFace, QInterpolatedPlus[face], QInterpolatedMinus[face], imposedStatePlus[face], imposedStateMinus[face],
+                 fullUpdateTime, deltaT, timeWeights, waveSpeedsPlus[face], waveSpeedsMinus[face]);
+  }
+}
+
+void seissol::physics::FrictionSolver::evaluateFace(unsigned meshFace,
+                                                    real const QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                                    real const QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                                    real imposedStatePlus[tensor::QInterpolated::size()],
+                                                    real imposedStateMinus[tensor::QInterpolated::size()],
+                                                    double fullUpdateTime,
+                                                    double const deltaT[CONVERGENCE_ORDER],
+                                                    double const timeWeights[CONVERGENCE_ORDER],
+                                                    seissol::model::IsotropicWaveSpeeds const& waveSpeedsPlus,
+                                                    seissol::model::IsotropicWaveSpeeds const& waveSpeedsMinus) const
+{
+  constexpr unsigned ld = init::QInterpolated::Stop[0] - init::QInterpolated::Start[0];
+  static_assert(tensor::QInterpolated::Shape[0] == tensor::resample::Shape[0], "Different number of quadrature points?");
+
+  double zpInv = 1.0 / (waveSpeedsPlus.density * waveSpeedsPlus.pWaveVelocity);
+  double zpNeighInv = 1.0 / (waveSpeedsMinus.density * waveSpeedsMinus.pWaveVelocity);
+  double zsInv = 1.0 / (waveSpeedsPlus.density * waveSpeedsPlus.sWaveVelocity);
+  double zsNeighInv = 1.0 / (waveSpeedsMinus.density * waveSpeedsMinus.sWaveVelocity);
+
+  double etaP = 1.0 / (zpInv + zpNeighInv);
+  double etaS = 1.0 / (zsInv + zsNeighInv);
+
+  // Godunov state
+  alignas(ALIGNMENT) double normalStress[CONVERGENCE_ORDER][NumberOfPoints];
+  alignas(ALIGNMENT) double stressXY[CONVERGENCE_ORDER][NumberOfPoints];
+  alignas(ALIGNMENT) double stressXZ[CONVERGENCE_ORDER][NumberOfPoints];
+  alignas(ALIGNMENT) double tractionXY[CONVERGENCE_ORDER][NumberOfPoints];
+  alignas(ALIGNMENT) double tractionXZ[CONVERGENCE_ORDER][NumberOfPoints];
+
+  for (unsigned timePoint = 0; timePoint < CONVERGENCE_ORDER; ++timePoint) {
+    real const* qP = QInterpolatedPlus[timePoint];
+    real const* qM = QInterpolatedMinus[timePoint];
+#pragma omp simd
+    for (unsigned point = 0; point < NumberOfPoints; ++point) {
+      normalStress[timePoint][point] = etaP * (qM[6*ld + point] - qP[6*ld + point] + qP[0*ld + point] * zpInv + qM[0*ld + point] * zpNeighInv);
+      stressXY[timePoint][point]     = etaS * (qM[7*ld + point] - qP[7*ld + point] + qP[3*ld + point] * zsInv + qM[3*ld + point] * zsNeighInv);
+      stressXZ[timePoint][point]     = etaS * (qM[8*ld + point] - qP[8*ld + point] + qP[5*ld + point] * zsInv + qM[5*ld + point] * zsNeighInv);
+    }
+  }
+
+  switch (m_state.frictionLaw) {
+    case 2:
+    case 16: {
+      double z = waveSpeedsPlus.density * waveSpeedsPlus.sWaveVelocity;
+      double zNeigh = waveSpeedsMinus.density * waveSpeedsMinus.sWaveVelocity;
+      linearSlipWeakening(meshFace, fullUpdateTime, deltaT, z * zNeigh / (z + zNeigh), init::resample::Values,
+                          normalStress, stressXY, stressXZ, tractionXY, tractionXZ);
+      break;
+    }
+    case 3:
+    case 4:
+      rateAndState(meshFace, fullUpdateTime, deltaT,
+                   1.0 / (waveSpeedsPlus.sWaveVelocity * waveSpeedsPlus.density) + 1.0 / (waveSpeedsMinus.sWaveVelocity * waveSpeedsMinus.density),
+                   normalStress, stressXY, stressXZ, tractionXY, tractionXZ);
+      break;
+    default:
+      logError() << "Friction law" << m_state.frictionLaw << "is not supported by the C++ friction solver.";
+  }
+
+  std::fill(imposedStatePlus, imposedStatePlus + tensor::QInterpolated::size(), static_cast<real>(0.0));
+  std::fill(imposedStateMinus, imposedStateMinus + tensor::QInterpolated::size(), static_cast<real>(0.0));
+
+  for (unsigned timePoint = 0; timePoint < CONVERGENCE_ORDER; ++timePoint) {
+    real const* qP = QInterpolatedPlus[timePoint];
+    real const* qM = QInterpolatedMinus[timePoint];
+    double weight = timeWeights[timePoint];
+#pragma omp simd
+    for (unsigned point = 0; point < NumberOfPoints; ++point) {
+      imposedStateMinus[0*ld + point] += weight * normalStress[timePoint][point];
+      imposedStateMinus[3*ld + point] += weight * tractionXY[timePoint][point];
+      imposedStateMinus[5*ld + point] += weight * tractionXZ[timePoint][point];
+      imposedStateMinus[6*ld + point] += weight * (qM[6*ld + point] - zpNeighInv * (normalStress[timePoint][point] - qM[0*ld + point]));
+      imposedStateMinus[7*ld + point] += weight * (qM[7*ld + point] - zsNeighInv * (tractionXY[timePoint][point] - qM[3*ld + point]));
+      imposedStateMinus[8*ld + point] += weight * (qM[8*ld + point] - zsNeighInv * (tractionXZ[timePoint][point] - qM[5*ld + point]));
+
+      imposedStatePlus[0*ld + point] += weight * normalStress[timePoint][point];
+      imposedStatePlus[3*ld + point] += weight * tractionXY[timePoint][point];
+      imposedStatePlus[5*ld + point] += weight * tractionXZ[timePoint][point];
+      imposedStatePlus[6*ld + point] += weight * (qP[6*ld + point] + zpInv * (normalStress[timePoint][point] - qP[0*ld + point]));
+      imposedStatePlus[7*ld + point] += weight * (qP[7*ld + point] + zsInv * (tractionXY[timePoint][point] - qP[3*ld + point]));
+      imposedStatePlus[8*ld + point] += weight * (qP[8*ld + point] + zsInv * (tractionXZ[timePoint][point] - qP[5*ld + point]));
+    }
+  }
+}
+
+void seissol::physics::FrictionSolver::linearSlipWeakening(unsigned meshFace,
+                                                           double fullUpdateTime,
+                                                           double const deltaT[CONVERGENCE_ORDER],
+                                                           double impedance,
+                                                           real const* resampleMatrix,
+                                                           double const normalStress[CONVERGENCE_ORDER][NumberOfPoints],
+                                                           double const stressXY[CONVERGENCE_ORDER][NumberOfPoints],
+                                                           double const stressXZ[CONVERGENCE_ORDER][NumberOfPoints],
+                                                           double tractionXY[CONVERGENCE_ORDER][NumberOfPoints],
+                                                           double tractionXZ[CONVERGENCE_ORDER][NumberOfPoints]) const
+{
+  unsigned offset = meshFace * NumberOfPoints;
+  double* mu = m_state.mu + offset;
+  double const* muS = m_state.muS + offset;
+  double const* muD = m_state.muD + offset;
+  double const* dC = m_state.dC + offset;
+  double const* cohesion = m_state.cohesion + offset;
+  double* slip = m_state.slip + offset;
+  double* slip1 = m_state.slip1 + offset;
+  double* slip2 = m_state.slip2 + offset;
+  double const* initialNormalStress = m_state.initialStress + (6*meshFace + 0) * NumberOfPoints;
+  double const* initialStressXY = m_state.initialStress + (6*meshFace + 3) * NumberOfPoints;
+  double const* initialStressXZ = m_state.initialStress + (6*meshFace + 5) * NumberOfPoints;
+  double const* forcedRuptureTime = (m_state.frictionLaw == 16) ? m_state.forcedRuptureTime + offset : nullptr;
+
+  alignas(ALIGNMENT) double slipRate[NumberOfPoints];
+  alignas(ALIGNMENT) double slipRate1[NumberOfPoints];
+  alignas(ALIGNMENT) double slipRate2[NumberOfPoints];
+  alignas(ALIGNMENT) double timeIntegratedSlipRate[NumberOfPoints] = {};
+  alignas(ALIGNMENT) double resampledSlipRate[NumberOfPoints];
+
+  double time = fullUpdateTime;
+  for (unsigned timePoint = 0; timePoint < CONVERGENCE_ORDER; ++timePoint) {
+    double timeIncrement = deltaT[timePoint];
+    time += timeIncrement;
+
+#pragma omp simd
+    for (unsigned point = 0; point < NumberOfPoints; ++point) {
+      double pressure = initialNormalStress[point] + normalStress[timePoint][point];
+      double strength = -cohesion[point] - mu[point] * std::min(pressure, 0.0);
+      double totalStressXY = initialStressXY[point] + stressXY[timePoint][point];
+      double totalStressXZ = initialStressXZ[point] + stressXZ[timePoint][point];
+      double shearStress = std::sqrt(totalStressXY * totalStressXY + totalStressXZ * totalStressXZ);
+
+      slipRate[point] = std::max(0.0, (shearStress - strength) / impedance);
+      slipRate1[point] = slipRate[point] * totalStressXY / (strength + impedance * slipRate[point]);
+      slipRate2[point] = slipRate[point] * totalStressXZ / (strength + impedance * slipRate[point]);
+      tractionXY[timePoint][point] = stressXY[timePoint][point] - impedance * slipRate1[point];
+      tractionXZ[timePoint][point] = stressXZ[timePoint][point] - impedance * slipRate2[point];
+
+      slip1[point] += slipRate1[point] * timeIncrement;
+      slip2[point] += slipRate2[point] * timeIncrement;
+      timeIntegratedSlipRate[point] += slipRate[point] * timeIncrement;
+    }
+
+    // Resample slip-rate, such that the state (Slip) lies in the same polynomial space as the degrees of freedom
+    std::fill(resampledSlipRate, resampledSlipRate + NumberOfPoints, 0.0);
+    for (unsigned column = 0; column < NumberOfPoints; ++column) {
+#pragma omp simd
+      for (unsigned point = 0; point < NumberOfPoints; ++point) {
+        resampledSlipRate[point] += static_cast<double>(resampleMatrix[column * NumberOfPoints + point]) * slipRate[column];
+      }
+    }
+
+#pragma omp simd
+    for (unsigned point = 0; point < NumberOfPoints; ++point) {
+      slip[point] += resampledSlipRate[point] * timeIncrement;
+
+      double f1 = std::min(std::abs(slip[point]) / dC[point], 1.0);
+      double f2 = 0.0;
+      if (forcedRuptureTime != nullptr) {
+        if (m_state.t0 == 0.0) {
+          f2 = (time >= forcedRuptureTime[point]) ? 1.0 : 0.0;
+        } else {
+          f2 = std::max(0.0, std::min((fullUpdateTime - forcedRuptureTime[point]) / m_state.t0, 1.0));
+        }
+      }
+      mu[point] = muS[point] - (muS[point] - muD[point]) * std::max(f1, f2);
+
+      if (m_state.instantaneousHealing == 1 && slipRate[point] < HealingSlipRate) {
+        mu[point] = muS[point];
+        slip[point] = 0.0;
+      }
+    }
+  }
+
+  // rupture front and dynamic stress time have no sub time step resolution
+  int* ruptureFront = m_state.ruptureFront + offset;
+  int* dynStressFront = m_state.dynStressFront + offset;
+  double* ruptureTime = m_state.ruptureTime + offset;
+  double* dynStressTime = m_state.dynStressTime + offset;
+  double* peakSlipRate = m_state.peakSlipRate + offset;
+  for (unsigned point = 0; point < NumberOfPoints; ++point) {
+    if (ruptureFront[point] != 0 && slipRate[point] > RuptureFrontSlipRate) {
+      ruptureTime[point] = fullUpdateTime;
+      ruptureFront[point] = 0;
+    }
+    if (ruptureTime[point] > 0.0 && ruptureTime[point] <= fullUpdateTime && dynStressFront[point] != 0 && std::abs(slip[point]) >= dC[point]) {
+      dynStressTime[point] = fullUpdateTime;
+      dynStressFront[point] = 0;
+    }
+    peakSlipRate[point] = std::max(peakSlipRate[point], slipRate[point]);
+  }
+
+  std::copy(tractionXY[CONVERGENCE_ORDER-1], tractionXY[CONVERGENCE_ORDER-1] + NumberOfPoints, m_state.tractionXY + offset);
+  std::copy(tractionXZ[CONVERGENCE_ORDER-1], tractionXZ[CONVERGENCE_ORDER-1] + NumberOfPoints, m_state.tractionXZ + offset);
+  std::copy(slipRate1, slipRate1 + NumberOfPoints, m_state.slipRate1 + offset);
+  std::copy(slipRate2, slipRate2 + NumberOfPoints, m_state.slipRate2 + offset);
+
+  // slip averaged per element for the moment magnitude
+  if (m_state.magnitudeOutput != nullptr && m_state.magnitudeOutput[meshFace] != 0) {
+    double sum = 0.0;
+    for (unsigned point = 0; point < NumberOfPoints; ++point) {
+      sum += timeIntegratedSlipRate[point];
+    }
+    m_state.averagedSlip[meshFace] += sum / NumberOfPoints;
+  }
+}
+
+void seissol::physics::FrictionSolver::rateAndState(unsigned meshFace,
+                                                    double fullUpdateTime,
+                                                    double const deltaT[CONVERGENCE_ORDER],
+                                                    double impedanceFactor,
+                                                    double const normalStress[CONVERGENCE_ORDER][NumberOfPoints],
+                                                    double const stressXY[CONVERGENCE_ORDER][NumberOfPoints],
+                                                    double const stressXZ[CONVERGENCE_ORDER][NumberOfPoints],
+                                                    double tractionXY[CONVERGENCE_ORDER][NumberOfPoints],
+                                                    double tractionXZ[CONVERGENCE_ORDER][NumberOfPoints]) const
+{
+  // The following process is adapted from that described by Kaneko et al. (2008)
+  constexpr unsigned numberOfSlipRateUpdates = 5;
+  constexpr unsigned numberOfStateVariableUpdates = 2;
+
+  unsigned offset = meshFace * NumberOfPoints;
+  double const* initialNormalStress = m_state.initialStress + (6*meshFace + 0) * NumberOfPoints;
+  double const* initialStressXY = m_state.initialStress + (6*meshFace + 3) * NumberOfPoints;
+  double const* initialStressXZ = m_state.initialStress + (6*meshFace + 5) * NumberOfPoints;
+
+  double const f0 = m_state.rsF0;
+  double const a = m_state.rsA;
+  double const b = m_state.rsB;
+  double const sl0 = m_state.rsSl0;
+  double const sr0 = m_state.rsSr0;
+  bool const agingLaw = (m_state.frictionLaw == 3);
+
+  double* muOut = m_state.mu + offset;
+  double* slipOut = m_state.slip + offset;
+  double* slip1Out = m_state.slip1 + offset;
+  double* slip2Out = m_state.slip2 + offset;
+  double* slipRate1Out = m_state.slipRate1 + offset;
+  double* slipRate2Out = m_state.slipRate2 + offset;
+  double* stateVariableOut = m_state.stateVariable + offset;
+  double* tractionXYOut = m_state.tractionXY + offset;
+  double* tractionXZOut = m_state.tractionXZ + offset;
+  double* peakSlipRate = m_state.peakSlipRate + offset;
+  double* ruptureTime = m_state.ruptureTime + offset;
+  int* ruptureFront = m_state.ruptureFront + offset;
+  double const* cohesion = m_state.cohesion + offset;
+
+#pragma omp simd
+  for (unsigned point = 0; point < NumberOfPoints; ++point) {
+    double slip = slipOut[point];
+    double slip1 = slip1Out[point];
+    double slip2 = slip2Out[point];
+    double slipRate1 = slipRate1Out[point];
+    double slipRate2 = slipRate2Out[point];
+    double stateVariable = stateVariableOut[point];
+    double mu = 0.0;
+    double slipRate = 0.0;
+    double localTractionXY = 0.0;
+    double localTractionXZ = 0.0;
+
+    for (unsigned timePoint = 0; timePoint < CONVERGENCE_ORDER; ++timePoint) {
+      double timeIncrement = deltaT[timePoint];
+      double pressure = normalStress[timePoint][point] + initialNormalStress[point];
+      double totalStressXY = initialStressXY[point] + stressXY[timePoint][point];
+      double totalStressXZ = initialStressXZ[point] + stressXZ[timePoint][point];
+      double shearStress = std::sqrt(totalStressXY * totalStressXY + totalStressXZ * totalStressXZ);
+
+      // We use the regularized rate-and-state friction, after Rice & Ben-Zion (1996)
+      // The state variable must always be corrected using stateVariable0
+      double stateVariable0 = stateVariable;
+
+      slipRate = std::sqrt(slipRate1 * slipRate1 + slipRate2 * slipRate2);
+      double meanSlipRate = std::abs(slipRate);
+
+      for (unsigned svUpdate = 0; svUpdate < numberOfStateVariableUpdates; ++svUpdate) {
+        slipRate = std::abs(slipRate);
+        if (agingLaw) {
+          stateVariable = stateVariable0 * std::exp(-meanSlipRate * timeIncrement / sl0) + sl0 / meanSlipRate * (1.0 - std::exp(-meanSlipRate * timeIncrement / sl0));
+        } else {
+          stateVariable = sl0 / meanSlipRate * std::pow(meanSlipRate * stateVariable0 / sl0, std::exp(-meanSlipRate * timeIncrement / sl0));
+        }
+
+        // Newton-Raphson algorithm to determine the slip rate, which equalizes the traction
+        // of the Godunov state (de la Puente et al. (2009)) and of the friction law (Lapusta and Rice (2003))
+        double slipRateTest = slipRate;
+        for (unsigned srUpdate = 0; srUpdate < numberOfSlipRateUpdates; ++srUpdate) {
+          double factor = 0.5 / sr0 * std::exp((f0 + b * std::log(sr0 * stateVariable / sl0)) / a);
+          double x = factor * slipRateTest;
+          double residual = -impedanceFactor * (std::abs(pressure) * a * std::log(x + std::sqrt(x * x + 1.0)) - shearStress) - slipRateTest;
+          double derivative = -impedanceFactor * (std::abs(pressure) * a / std::sqrt(1.0 + x * x) * factor) - 1.0;
+          slipRateTest = std::abs(slipRateTest - residual / derivative);
+        }
+        // For the next state variable update, use the mean slip rate between the initial guess and the one found (Kaneko 2008, step 6)
+        meanSlipRate = 0.5 * (slipRate + std::abs(slipRateTest));
+        slipRate = std::abs(slipRateTest);
+      }
+
+      if (agingLaw) {
+        stateVariable = stateVariable0 * std::exp(-meanSlipRate * timeIncrement / sl0) + sl0 / meanSlipRate * (1.0 - std::exp(-meanSlipRate * timeIncrement / sl0));
+      } else {
+        stateVariable = sl0 / meanSlipRate * std::pow(meanSlipRate * stateVariable0 / sl0, std::exp(-meanSlipRate * timeIncrement / sl0));
+      }
+
+      double x = 0.5 * slipRate / sr0 * std::exp((f0 + b * std::log(sr0 * stateVariable / sl0)) / a);
+      mu = a * std::log(x + std::sqrt(x * x + 1.0));
+
+      localTractionXY = -(totalStressXY / shearStress) * (mu * pressure + std::abs(cohesion[point])) - initialStressXY[point];
+      localTractionXZ = -(totalStressXZ / shearStress) * (mu * pressure + std::abs(cohesion[point])) - initialStressXZ[point];
+
+      slip += slipRate * timeIncrement;
+
+      // notice that slipRate(t=0) = -2c_s/mu*s_xy^{Godunov} is the slip rate caused by a free surface
+      slipRate1 = -impedanceFactor * (localTractionXY - stressXY[timePoint][point]);
+      slipRate2 = -impedanceFactor * (localTractionXZ - stressXZ[timePoint][point]);
+
+      slip1 += slipRate1 * timeIncrement;
+      slip2 += slipRate2 * timeIncrement;
+
+      tractionXY[timePoint][point] = localTractionXY;
+      tractionXZ[timePoint][point] = localTractionXZ;
+    }
+
+    // rupture front has no sub time step resolution
+    if (ruptureFront[point] != 0 && slipRate > RuptureFrontSlipRate) {
+      ruptureTime[point] = fullUpdateTime;
+      ruptureFront[point] = 0;
+    }
+    peakSlipRate[point] = std::max(peakSlipRate[point], slipRate);
+
+    muOut[point] = mu;
+    slipRate1Out[point] = slipRate1;
+    slipRate2Out[point] = slipRate2;
+    slipOut[point] = slip;
+    slip1Out[point] = slip1;
+    slip2Out[point] = slip2;
+    stateVariableOut[point] = stateVariable;
+    tractionXYOut[point] = localTractionXY;
+    tractionXZOut[point] = localTractionXZ;
+  }
+}
+
+std::vector<double*> seissol::physics::FrictionSolver::stateArrays() const
+{
+  std::vector<double*> arrays = {
+    m_state.mu, m_state.slip, m_state.slip1, m_state.slip2, m_state.slipRate1, m_state.slipRate2,
+    m_state.stateVariable, m_state.peakSlipRate, m_state.tractionXY, m_state.tractionXZ,
+    m_state.ruptureTime, m_state.dynStressTime,
+    m_state.outputMu, m_state.outputStrength, m_state.outputSlip, m_state.outputSlip1, m_state.outputSlip2,
+    m_state.outputRuptureTime, m_state.outputPeakSlipRate, m_state.outputDynStressTime, m_state.outputStateVariable
+  };
+  arrays.erase(std::remove(arrays.begin(), arrays.end(), nullptr), arrays.end());
+  return arrays;
+}
+
+std::vector<int*> seissol::physics::FrictionSolver::flagArrays() const
+{
+  std::vector<int*> arrays = { m_state.ruptureFront, m_state.dynStressFront };
+  arrays.erase(std::remove(arrays.begin(), arrays.end(), nullptr), arrays.end());
+  return arrays;
+}
+
+void seissol::physics::FrictionSolver::saveState(unsigned meshFace, std::vector<double>& state) const
+{
+  unsigned offset = meshFace * NumberOfPoints;
+
+  state.clear();
+  for (double* array : stateArrays()) {
+    state.insert(state.end(), array + offset, array + offset + NumberOfPoints);
+  }
+  for (int* array : flagArrays()) {
+    for (unsigned point = 0; point < NumberOfPoints; ++point) {
+      state.push_back(array[offset + point]);
+    }
+  }
+  if (m_state.averagedSlip != nullptr) {
+    state.push_back(m_state.averagedSlip[meshFace]);
+  }
+}
+
+void seissol::physics::FrictionSolver::restoreState(unsigned meshFace, std::vector<double> const& state)
+{
+  unsigned offset = meshFace * NumberOfPoints;
+
+  std::vector<double>::const_iterator value = state.begin();
+  for (double* array : stateArrays()) {
+    std::copy(value, value + NumberOfPoints, array + offset);
+    value += NumberOfPoints;
+  }
+  for (int* array : flagArrays()) {
+    for (unsigned point = 0; point < NumberOfPoints; ++point, ++value) {
+      array[offset + point] = static_cast<int>(*value);
+    }
+  }
+  if (m_state.averagedSlip != nullptr) {
+    m_state.averagedSlip[meshFace] = *value;
+  }
+}
+
+void seissol::physics::FrictionSolver::updateDifference(double difference)
+{
+  double maxDifference = m_maxDifference.load();
+  while (difference > maxDifference && !m_maxDifference.compare_exchange_weak(maxDifference, difference)) {}
+}
+
+void seissol::physics::FrictionSolver::compare(unsigned size, real const* reference, real const* result)
+{
+  double norm = 0.0;
+  double difference = 0.0;
+  for (unsigned i = 0; i < size; ++i) {
+    norm = std::max(norm, std::abs(static_cast<double>(reference[i])));
+    difference = std::max(difference, std::abs(static_cast<double>(reference[i]) - static_cast<double>(result[i])));
+  }
+  updateDifference(norm > 0.0 ? difference / norm : difference);
+  ++m_numberOfChecks;
+}
+
+void seissol::physics::FrictionSolver::compareState(std::vector<double> const& reference, std::vector<double> const& result)
+{
+  assert(reference.size() == result.size());
+
+  // every variable is compared relative to its own magnitude
+  double maxDifference = 0.0;
+  for (unsigned begin = 0; begin < reference.size(); begin += NumberOfPoints) {
+    unsigned end = std::min(begin + NumberOfPoints, static_cast<unsigned>(reference.size()));
+    double norm = 0.0;
+    double difference = 0.0;
+    for (unsigned i = begin; i < end; ++i) {
+      norm = std::max(norm, std::abs(reference[i]));
+      difference = std::max(difference, std::abs(reference[i] - result[i]));
+    }
+    maxDifference = std::max(maxDifference, norm > 0.0 ? difference / norm : difference);
+  }
+  updateDifference(maxDifference);
+}
+
+void seissol::physics::FrictionSolver::printCheck() const
+{
+  if (m_mode != Check) {
+    return;
+  }
+
+  double maxDifference = m_maxDifference.load();
+  unsigned long numberOfChecks = m_numberOfChecks.load();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &maxDifference, 1, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfChecks, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+#endif
+
+  logInfo(seissol::MPI::mpi.rank()) << "Friction solver check: maximum relative difference between the C++ and the Fortran solver is"
+    << maxDifference << "in" << numberOfChecks << "fault face evaluations.";
+}
@@ -0,0 +1,244 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * C++ friction solver for dynamic rupture.
+ **/
+
+#ifndef PHYSICS_FRICTIONSOLVER_H_
+#define PHYSICS_FRICTIONSOLVER_H_
+
+#include <Initializer/typedefs.hpp>
+#include <Initializer/DynamicRupture.h>
+#include <Initializer/tree/Layer.hpp>
+#include <Model/common_datastructures.hpp>
+#include <generated_code/tensor.h>
+
+#include <atomic>
+#include <vector>
+
+namespace seissol {
+  namespace physics {
+    struct FrictionState;
+    class FrictionSolver;
+  }
+}
+
+/**
+ * Fault state and parameters of the friction law (owned by Fortran, filled by f_interoperability_getFrictionState).
+ *
+ * All arrays are stored as [meshFace][point], i.e. every variable is a separate array and
+ * the points of a face are contiguous. initialStress is stored as [meshFace][component][point].
+ * The logical arrays use the default Fortran LOGICAL (4 bytes, non-zero is true).
+ * The layout must match tFrictionState in f_ctof_bind_interoperability.f90.
+ **/
+struct seissol::physics::FrictionState {
+  int frictionLaw;
+  int numberOfPoints;
+  int numberOfFaces;
+  int instantaneousHealing;
+
+  double t0;
+  double rsF0;
+  double rsA;
+  double rsB;
+  double rsSl0;
+  double rsSr0;
+
+  double* mu;
+  double* muS;
+  double* muD;
+  double* dC;
+  double* cohesion;
+  double* forcedRuptureTime;
+  double* strength;
+  double* slip;
+  double* slip1;
+  double* slip2;
+  double* slipRate1;
+  double* slipRate2;
+  double* stateVariable;
+  double* peakSlipRate;
+  double* tractionXY;
+  double* tractionXZ;
+  double* ruptureTime;
+  double* dynStressTime;
+  int*    ruptureFront;
+  int*    dynStressFront;
+  int*    magnitudeOutput;
+  double* averagedSlip;
+  double* initialStress;
+
+  double* outputMu;
+  double* outputStrength;
+  double* outputSlip;
+  double* outputSlip1;
+  double* outputSlip2;
+  double* outputRuptureTime;
+  double* outputPeakSlipRate;
+  double* outputDynStressTime;
+  double* outputStateVariable;
+};
+
+/**
+ * Friction solver in C++ for linear slip weakening (FL=2,16) and rate-and-state friction (FL=3,4).
+ *
+ * The friction law is evaluated on the faces of a layer and updates the fault state of the Fortran
+ * solver in place, such that fault output and checkpoints are unchanged.
+ * The loops over the points of a face are vectorized.
+ **/
+class seissol::physics::FrictionSolver {
+public:
+  enum Mode {
+    //! friction law is evaluated by Eval_friction_law
+    Fortran,
+    //! friction law is evaluated by the C++ solver
+    Cpp,
+    //! both are evaluated and compared; the Fortran result is used
+    Check
+  };
+
+  FrictionSolver() : m_mode(Fortran), m_maxDifference(0.0), m_numberOfChecks(0) {}
+
+  /**
+   * Mode selected with SEISSOL_FRICTION_SOLVER (fortran, cpp or check); the default is fortran.
+   **/
+  static Mode requestedMode();
+
+  /**
+   * Initializes the solver; falls back to the Fortran solver if the friction law is not supported.
+   *
+   * @param mode requested mode.
+   * @param state fault state of the Fortran solver.
+   **/
+  void init(Mode mode, FrictionState const& state);
+
+  Mode mode() const {
+    return m_mode;
+  }
+
+  static bool supports(int frictionLaw) {
+    return frictionLaw == 2 || frictionLaw == 16 || frictionLaw == 3 || frictionLaw == 4;
+  }
+
+  /**
+   * Evaluates the friction law at all points of the faces [faceBegin, faceEnd) of a layer
+   * and computes the imposed states from QInterpolatedPlus and QInterpolatedMinus of the layer.
+   **/
+  void evaluate(seissol::initializers::Layer& layer,
+                seissol::initializers::DynamicRupture const& dynRup,
+                unsigned faceBegin,
+                unsigned faceEnd,
+                double fullUpdateTime,
+                double const timePoints[CONVERGENCE_ORDER],
+                double const timeWeights[CONVERGENCE_ORDER]);
+
+  /**
+   * Saves the state of a face, such that the Fortran solver can be compared to the C++ solver.
+   **/
+  void saveState(unsigned meshFace, std::vector<double>& state) const;
+
+  /**
+   * Restores the state of a face.
+   **/
+  void restoreState(unsigned meshFace, std::vector<double> const& state);
+
+  /**
+   * Records the maximum relative difference between the imposed states of both solvers.
+   **/
+  void compare(unsigned size, real const* reference, real const* result);
+
+  /**
+   * Records the maximum relative difference between the states (see saveState) of both solvers.
+   **/
+  void compareState(std::vector<double> const& reference, std::vector<double> const& result);
+
+  /**
+   * Prints the maximum deviation between the Fortran and C++ solver (check mode, collective).
+   **/
+  void printCheck() const;
+
+private:
+  constexpr static unsigned NumberOfPoints = tensor::resample::Shape[0];
+
+  void evaluateFace(unsigned meshFace,
+                    real const QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                    real const QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                    real imposedStatePlus[tensor::QInterpolated::size()],
+                    real imposedStateMinus[tensor::QInterpolated::size()],
+                    double fullUpdateTime,
+                    double const deltaT[CONVERGENCE_ORDER],
+                    double const timeWeights[CONVERGENCE_ORDER],
+                    seissol::model::IsotropicWaveSpeeds const& waveSpeedsPlus,
+                    seissol::model::IsotropicWaveSpeeds const& waveSpeedsMinus) const;
+
+  void linearSlipWeakening(unsigned meshFace,
+                           double fullUpdateTime,
+                           double const deltaT[CONVERGENCE_ORDER],
+                           double impedance,
+                           real const* resampleMatrix,
+                           double const normalStress[CONVERGENCE_ORDER][NumberOfPoints],
+                           double const stressXY[CONVERGENCE_ORDER][NumberOfPoints],
+                           double const stressXZ[CONVERGENCE_ORDER][NumberOfPoints],
+                           double tractionXY[CONVERGENCE_ORDER][NumberOfPoints],
+                           double tractionXZ[CONVERGENCE_ORDER][NumberOfPoints]) const;
+
+  void rateAndState(unsigned meshFace,
+                    double fullUpdateTime,
+                    double const deltaT[CONVERGENCE_ORDER],
+                    double impedanceFactor,
+                    double const normalStress[CONVERGENCE_ORDER][NumberOfPoints],
+                    double const stressXY[CONVERGENCE_ORDER][NumberOfPoints],
+                    double const stressXZ[CONVERGENCE_ORDER][NumberOfPoints],
+                    double tractionXY[CONVERGENCE_ORDER][NumberOfPoints],
+                    double tractionXZ[CONVERGENCE_ORDER][NumberOfPoints]) const;
+
+  void updateDifference(double difference);
+
+  //! arrays of the state which are modified by the friction law
+  std::vector<double*> stateArrays() const;
+
+  //! logical arrays of the state which are modified by the friction law
+  std::vector<int*> flagArrays() const;
+
+  Mode m_mode;
+
+  FrictionState m_state;
+
+  std::atomic<double> m_maxDifference;
+
+  std::atomic<unsigned long> m_numberOfChecks;
+};
+
+#endif
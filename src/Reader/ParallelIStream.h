@@ -38,68 +38,56 @@
 #ifndef PARALLEL_ISTREAM_H
 #define PARALLEL_ISTREAM_H
 
-#include "Parallel/MPI.h"
+#include "ParallelInputFile.h"
 
-#include "utils/logger.h"
+#include <istream>
+#include <streambuf>
 
-#include <fstream>
-#include <sstream>
-#include <vector>
+#include "utils/logger.h"
 
-class ParallelIStream : public std::wistringstream
+/**
+ * Input stream for small files that are read by all ranks.
+ *
+ * The file is read only once, see seissol::reader::ParallelInputFile.
+ * Opening the stream is a collective operation.
+ */
+class ParallelIStream : public std::istream
 {
 private:
-	/** Contains the content of the file */
-	std::vector<wchar_t> m_buffer;
+	/** Read-only stream buffer on the shared content */
+	class Buffer : public std::streambuf
+	{
+	public:
+		void set(const char* data, std::size_t size)
+		{
+			char* begin = const_cast<char*>(data);
+			setg(begin, begin, begin + size);
+		}
+	};
+
+	seissol::reader::ParallelInputFile m_file;
+
+	Buffer m_buffer;
 
 public:
 	ParallelIStream()
+		: std::istream(&m_buffer)
 	{
 	}
 
 	ParallelIStream(const char* filename)
+		: std::istream(&m_buffer)
 	{
 		open(filename);
 	}
 
 	void open(const char* filename)
 	{
-#ifdef USE_MPI
-		MPI_Comm comm = seissol::MPI::mpi.comm();
-		const int rank = seissol::MPI::mpi.rank();
+		if (!m_file.open(filename))
+			logError() << "Could not open file" << filename;
 
-		if (rank == 0) {
-#endif // USE_MPI
-
-			// Open the file and set the buffer
-			// This only done on rank 0 when running in parallel
-			std::wifstream file(filename);
-			if (!file)
-				logError() << "Could not open file" << filename;
-
-			file.seekg(0, std::ios::end);
-			m_buffer.resize(file.tellg());
-			file.seekg(0, std::ios::beg);
-
-			file.read(&m_buffer[0], m_buffer.size());
-
-			rdbuf()->pubsetbuf(&m_buffer[0], m_buffer.size());
-
-#ifdef USE_MPI
-			// Broadcast the size and the content of the file
-			unsigned long size = m_buffer.size();
-			MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG, 0, comm);
-			MPI_Bcast(&m_buffer[0], size, MPI_WCHAR, 0, comm);
-		} else {
-			unsigned long size;
-			MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG, 0, comm);
-
-			m_buffer.resize(size);
-			MPI_Bcast(&m_buffer[0], size, MPI_WCHAR, 0, comm);
-
-			rdbuf()->pubsetbuf(&m_buffer[0], size);
-		}
-#endif // USE_MPI
+		m_buffer.set(m_file.data(), m_file.size());
+		clear();
 	}
 };
 
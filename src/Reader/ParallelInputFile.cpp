@@ -0,0 +1,227 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Reads small input files once and shares them between all ranks
+ **/
+
+#include "ParallelInputFile.h"
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <string>
+
+#include "utils/env.h"
+#include "utils/logger.h"
+
+#include "Monitoring/Stopwatch.h"
+
+seissol::reader::ParallelInputFile::ParallelInputFile()
+  : m_data(0L), m_size(0)
+#ifdef USE_MPI
+    , m_window(MPI_WIN_NULL)
+#endif // USE_MPI
+{
+}
+
+seissol::reader::ParallelInputFile::ParallelInputFile(char const* filename)
+  : m_data(0L), m_size(0)
+#ifdef USE_MPI
+    , m_window(MPI_WIN_NULL)
+#endif // USE_MPI
+{
+  if (!open(filename)) {
+    logError() << "Could not read file" << filename;
+  }
+}
+
+bool seissol::reader::ParallelInputFile::open(char const* filename)
+{
+  close();
+
+  const int rank = seissol::MPI::mpi.rank();
+
+  Stopwatch stopwatch;
+  stopwatch.start();
+
+  // Size of the file, -1 if the file could not be read
+  long long size = -1;
+
+  if (rank == 0) {
+    std::ifstream file(filename, std::ios::binary);
+    if (file) {
+      file.seekg(0, std::ios::end);
+      std::streamoff const end = file.tellg();
+      file.seekg(0, std::ios::beg);
+
+      if (end >= 0) {
+        m_buffer.resize(end);
+        if (file.read(m_buffer.data(), end)) {
+          size = end;
+        }
+      }
+    }
+  }
+
+#ifdef USE_MPI
+  MPI_Comm nodeComm;
+  MPI_Comm leaderComm;
+  communicators(nodeComm, leaderComm);
+
+  if (leaderComm != MPI_COMM_NULL) {
+    MPI_Bcast(&size, 1, MPI_LONG_LONG, 0, leaderComm);
+  }
+  MPI_Bcast(&size, 1, MPI_LONG_LONG, 0, nodeComm);
+#endif // USE_MPI
+
+  if (size < 0) {
+    m_buffer.clear();
+    return false;
+  }
+
+#ifdef USE_MPI
+  if (utils::Env::get<int>("SEISSOL_INPUT_SHARED", 1)) {
+    int nodeRank;
+    MPI_Comm_rank(nodeComm, &nodeRank);
+
+    // Only the first rank of the node holds the content
+    char* base;
+    MPI_Win_allocate_shared(nodeRank == 0 ? size : 0, 1, MPI_INFO_NULL, nodeComm, &base, &m_window);
+    if (nodeRank != 0) {
+      MPI_Aint windowSize;
+      int dispUnit;
+      MPI_Win_shared_query(m_window, 0, &windowSize, &dispUnit, &base);
+    }
+
+    MPI_Win_fence(0, m_window);
+    if (nodeRank == 0) {
+      std::copy(m_buffer.begin(), m_buffer.end(), base);
+      broadcast(base, size, leaderComm);
+    }
+    MPI_Win_fence(0, m_window);
+
+    std::vector<char>().swap(m_buffer);
+    m_data = base;
+  } else {
+    m_buffer.resize(size);
+    if (leaderComm != MPI_COMM_NULL) {
+      broadcast(m_buffer.data(), size, leaderComm);
+    }
+    broadcast(m_buffer.data(), size, nodeComm);
+
+    m_data = m_buffer.data();
+  }
+#else // USE_MPI
+  m_data = m_buffer.data();
+#endif // USE_MPI
+
+  m_size = size;
+
+  stopwatch.pause();
+  std::string const text = std::string("Time required to read ") + filename + ":";
+  stopwatch.printTime(text.c_str());
+
+  return true;
+}
+
+void seissol::reader::ParallelInputFile::close()
+{
+#ifdef USE_MPI
+  if (m_window != MPI_WIN_NULL) {
+    MPI_Win_free(&m_window);
+  }
+#endif // USE_MPI
+
+  std::vector<char>().swap(m_buffer);
+  m_data = 0L;
+  m_size = 0;
+}
+
+void seissol::reader::ParallelInputFile::lines(std::vector<std::size_t>& offsets, std::vector<std::size_t>& lengths) const
+{
+  offsets.clear();
+  lengths.clear();
+
+  std::size_t begin = 0;
+  while (begin < m_size) {
+    char const* newline = std::find(m_data + begin, m_data + m_size, '\n');
+    std::size_t end = newline - m_data;
+
+    offsets.push_back(begin);
+    lengths.push_back((end > begin && m_data[end-1] == '\r') ? end - begin - 1 : end - begin);
+
+    begin = end + 1;
+  }
+}
+
+#ifdef USE_MPI
+void seissol::reader::ParallelInputFile::communicators(MPI_Comm& nodeComm, MPI_Comm& leaderComm)
+{
+  // The main communicator may change during the initialization
+  static MPI_Comm s_comm = MPI_COMM_NULL;
+  static MPI_Comm s_nodeComm = MPI_COMM_NULL;
+  static MPI_Comm s_leaderComm = MPI_COMM_NULL;
+
+  MPI_Comm const comm = seissol::MPI::mpi.comm();
+  if (comm != s_comm) {
+    if (s_nodeComm != MPI_COMM_NULL) {
+      MPI_Comm_free(&s_nodeComm);
+    }
+    if (s_leaderComm != MPI_COMM_NULL) {
+      MPI_Comm_free(&s_leaderComm);
+    }
+
+    const int rank = seissol::MPI::mpi.rank();
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &s_nodeComm);
+
+    int nodeRank;
+    MPI_Comm_rank(s_nodeComm, &nodeRank);
+    MPI_Comm_split(comm, nodeRank == 0 ? 0 : MPI_UNDEFINED, rank, &s_leaderComm);
+
+    s_comm = comm;
+  }
+
+  nodeComm = s_nodeComm;
+  leaderComm = s_leaderComm;
+}
+
+void seissol::reader::ParallelInputFile::broadcast(char* data, std::size_t size, MPI_Comm comm)
+{
+  for (std::size_t offset = 0; offset < size; offset += INT_MAX) {
+    int const count = std::min<std::size_t>(size - offset, INT_MAX);
+    MPI_Bcast(data + offset, count, MPI_CHAR, 0, comm);
+  }
+}
+#endif // USE_MPI
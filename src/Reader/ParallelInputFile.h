@@ -0,0 +1,130 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Reads small input files once and shares them between all ranks
+ **/
+
+#ifndef PARALLEL_INPUT_FILE_H
+#define PARALLEL_INPUT_FILE_H
+
+#include "Parallel/MPI.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace seissol
+{
+  namespace reader
+  {
+    class ParallelInputFile;
+  }
+}
+
+/**
+ * Content of a small input file that is read only once.
+ *
+ * Rank 0 reads the file and broadcasts the bytes (unmodified) to one rank per node.
+ * The ranks of a node share this copy through an MPI-3 shared memory window. Set
+ * SEISSOL_INPUT_SHARED=0 to broadcast a private copy to every rank instead.
+ *
+ * Opening and closing are collective operations.
+ */
+class seissol::reader::ParallelInputFile {
+private:
+  /** Content of the file (points to the shared window or to m_buffer) */
+  char const* m_data;
+
+  std::size_t m_size;
+
+  /** Private copy of the content */
+  std::vector<char> m_buffer;
+
+#ifdef USE_MPI
+  MPI_Win m_window;
+#endif // USE_MPI
+
+public:
+  ParallelInputFile();
+
+  ParallelInputFile(char const* filename);
+
+  ~ParallelInputFile() {
+    close();
+  }
+
+  /**
+   * @return False if the file could not be read (on all ranks)
+   */
+  bool open(char const* filename);
+
+  void close();
+
+  char const* data() const {
+    return m_data;
+  }
+
+  std::size_t size() const {
+    return m_size;
+  }
+
+  /**
+   * Splits the content into lines. Line terminators ("\n" or "\r\n") are not
+   * part of the lines.
+   *
+   * @param offsets Offset of each line
+   * @param lengths Length of each line
+   */
+  void lines(std::vector<std::size_t>& offsets, std::vector<std::size_t>& lengths) const;
+
+private:
+  // Not copyable, the content may be shared
+  ParallelInputFile(ParallelInputFile const&);
+  ParallelInputFile& operator=(ParallelInputFile const&);
+
+#ifdef USE_MPI
+  /**
+   * Communicators of the ranks of this node and of the first rank of each node.
+   * Rank 0 is always the first rank of its node.
+   */
+  static void communicators(MPI_Comm& nodeComm, MPI_Comm& leaderComm);
+
+  /**
+   * Broadcasts in chunks that fit into an int
+   */
+  static void broadcast(char* data, std::size_t size, MPI_Comm comm);
+#endif // USE_MPI
+};
+
+#endif // PARALLEL_INPUT_FILE_H
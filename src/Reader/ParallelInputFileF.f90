@@ -0,0 +1,89 @@
+!>
+!! @file
+!! This file is part of SeisSol.
+!!
+!! @section LICENSE
+!! Copyright (c) 2020, SeisSol Group
+!! All rights reserved.
+!!
+!! Redistribution and use in source and binary forms, with or without
+!! modification, are permitted provided that the following conditions are met:
+!!
+!! 1. Redistributions of source code must retain the above copyright notice,
+!!    this list of conditions and the following disclaimer.
+!!
+!! 2. Redistributions in binary form must reproduce the above copyright notice,
+!!    this list of conditions and the following disclaimer in the documentation
+!!    and/or other materials provided with the distribution.
+!!
+!! 3. Neither the name of the copyright holder nor the names of its
+!!    contributors may be used to endorse or promote products derived from this
+!!    software without specific prior written permission.
+!!
+!! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+!! AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+!! IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+!! ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+!! LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+!! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+!! SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+!! INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+!! CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+!! ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+!! POSSIBILITY OF SUCH DAMAGE.
+!!
+!! @section DESCRIPTION
+!! Reads small input files once and shares them between all ranks
+
+#include "Initializer/preProcessorMacros.fpp"
+
+module ParallelInputFile_mod
+  use iso_c_binding
+
+  implicit none
+  private
+
+  interface
+    function openInputFileC( i_file, o_numLines, o_maxLineLength ) bind( C, name='openInputFile' )
+        use iso_c_binding
+        implicit none
+        character(kind=c_char), dimension(*), intent(in)  :: i_file
+        integer(kind=c_int), intent(out)                  :: o_numLines
+        integer(kind=c_int), intent(out)                  :: o_maxLineLength
+        integer(kind=c_int)                               :: openInputFileC
+    end function
+
+    subroutine getInputFileLinesC( i_lineLength, o_lines ) bind( C, name='getInputFileLines' )
+        use iso_c_binding
+        implicit none
+        integer(kind=c_int), value                        :: i_lineLength
+        character(kind=c_char), dimension(*), intent(out) :: o_lines
+    end subroutine
+
+    subroutine closeInputFileC() bind( C, name='closeInputFile' )
+    end subroutine
+  end interface
+
+  public :: readInputFile
+
+contains
+
+  !> Reads a small input file once and shares it with all ranks (collective)
+  !! @param lines The lines of the file, padded with blanks
+  !! @return .FALSE. if the file could not be read
+  logical function readInputFile(filename, lines)
+    character(*), intent(in)                               :: filename
+    character(len=:), allocatable, intent(out)             :: lines(:)
+    integer(c_int) :: numLines, maxLineLength
+
+    readInputFile = (openInputFileC(trim(filename)//c_null_char, numLines, maxLineLength) .ne. 0)
+    if (.not. readInputFile) return
+
+    allocate(character(len=max(maxLineLength,1)) :: lines(numLines))
+    if (numLines .gt. 0) then
+      call getInputFileLinesC(len(lines), lines)
+    endif
+    call closeInputFileC()
+  end function readInputFile
+
+end module ParallelInputFile_mod
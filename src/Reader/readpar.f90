@@ -45,6 +45,7 @@ MODULE COMMON_readpar_mod
   !----------------------------------------------------------------------------
   USE TypesDef
   USE COMMON_operators_mod
+  USE ParallelInputFile_mod
   !----------------------------------------------------------------------------
   IMPLICIT NONE
   PRIVATE
@@ -63,6 +64,11 @@ MODULE COMMON_readpar_mod
 
   LOGICAL :: CalledFromStructCode !
 
+  !> Lines of the parameter file, the namelists are read from this internal file
+  CHARACTER(LEN=:), ALLOCATABLE :: ParameterLines(:)
+  !> Error message of the last namelist read
+  CHARACTER(LEN=600)            :: ParameterMsg
+
 CONTAINS
 
   subroutine getParameterFile(parafile)
@@ -79,6 +85,39 @@ CONTAINS
     end do
   end subroutine getParameterFile
 
+  !> Reads nPoints coordinates (one point per line) from a small input file
+  subroutine readPointFile(filename, nPoints, X, Y, Z)
+    character(*), intent(in) :: filename
+    integer, intent(in)      :: nPoints
+    real, intent(out)        :: X(nPoints), Y(nPoints), Z(nPoints)
+    character(len=:), allocatable :: lines(:)
+    integer :: i, iLine, readStat
+
+    if (.not. readInputFile(filename, lines)) then
+      logError(*) 'Could not read ', trim(filename)
+      stop
+    endif
+
+    iLine = 0
+    do i = 1, nPoints
+      ! Skip empty lines
+      do
+        iLine = iLine + 1
+        if (iLine .gt. size(lines)) then
+          logError(*) 'Only ', i-1, ' points found in ', trim(filename)
+          stop
+        endif
+        if (len_trim(lines(iLine)) .gt. 0) exit
+      end do
+
+      read(lines(iLine), *, iostat=readStat) X(i), Y(i), Z(i)
+      if (readStat .ne. 0) then
+        logError(*) 'invalid point in ', trim(filename), ': ', trim(lines(iLine))
+        stop
+      endif
+    end do
+  end subroutine readPointFile
+
   SUBROUTINE readpar(EQN,IC,usMESH,DISC,SOURCE,BND,IO, &
                      programTitle,MPI)
     !--------------------------------------------------------------------------
@@ -97,7 +136,6 @@ CONTAINS
     INTEGER                         :: actual_version_of_readpar
     CHARACTER(LEN=600)              :: Name
     CHARACTER(LEN=801)              :: Name1
-    logical :: existence
     !--------------------------------------------------------------------------
     INTENT(IN)                      :: programTitle
     INTENT(OUT)                     :: IC, BND, DISC, SOURCE
@@ -119,10 +157,8 @@ CONTAINS
     !                                                                        !
     call getParameterFile(IO%ParameterFile)
 
-    ! Check if the parameter file exists
-    inquire(file=IO%ParameterFile,EXIST=existence)
-    if(existence)then
-    else
+    ! Read the parameter file once, all namelists are read from its lines
+    if (.not. readInputFile(IO%ParameterFile, ParameterLines)) then
        logError(*) 'You did not specify a valid parameter-file'
        stop
     endif
@@ -130,8 +166,6 @@ CONTAINS
     logInfo0(*) '<  Parameters read from file: ', TRIM(IO%ParameterFile) ,'              >'
     logInfo0(*) '<                                                         >'
     !                                                                        !
-    CALL OpenFile(UnitNr=IO%UNIT%FileIn, name=trim(IO%ParameterFile), create=.FALSE.)
-    !                                                                        !
     CALL readpar_header(IO,IC,actual_version_of_readpar,programTitle) !
     !                                                                        !
     CALL readpar_equations(EQN,DISC,SOURCE,IC,IO)                  !
@@ -152,7 +186,7 @@ CONTAINS
     !                                                                        !
     CALL readpar_abort(DISC,IO)                                    !
     !                                                                        !
-    CLOSE(IO%UNIT%FileIn,status='keep')                                      !
+    DEALLOCATE(ParameterLines)                                               !
     !                                                                        !
     CALL analyse_readpar(EQN,DISC,usMESH,IC,SOURCE,IO,MPI)                   ! Check parameterfile...
     !                                                                        ! and write restart.par
@@ -160,15 +194,11 @@ CONTAINS
     !                                                                        !
   END SUBROUTINE readpar                                                     !
 
-  SUBROUTINE RaiseErrorNml(FID, NMLname)
-    INTEGER                    :: FID
+  SUBROUTINE RaiseErrorNml(NMLname)
     CHARACTER(LEN=*)         :: NMLname
-    CHARACTER(LEN=600)         :: line
-    INTENT(IN)                 :: FID, NMLname
+    INTENT(IN)                 :: NMLname
 
-    backspace(FID)
-    read(FID,fmt='(A)') line
-    logError(*) 'invalid line in namelist '//trim(NMLname)//': '//trim(line)
+    logError(*) 'invalid namelist '//trim(NMLname)//': '//trim(ParameterMsg)
     stop
     RETURN
 
@@ -281,9 +311,9 @@ CONTAINS
     BoundaryFileName    = ''
 
     !
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Equations)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Equations)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Equations")
+        CALL RaiseErrorNml("Equations")
     ENDIF
     !
 
@@ -449,10 +479,10 @@ CONTAINS
     NAMELIST                                         /RFFile/ RF_Files
     !------------------------------------------------------------------------
     ALLOCATE(RF_Files(number))
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = RFFile)      ! Write in namelistfile RF_File(1) = ... and in the next line RF_Files(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = RFFile)      ! Write in namelistfile RF_File(1) = ... and in the next line RF_Files(2) = ...
                                             ! according to the number of Random Fields
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "RFFile")
+        CALL RaiseErrorNml("RFFile")
     ENDIF
   END SUBROUTINE
     !------------------------------------------------------------------------
@@ -576,9 +606,9 @@ CONTAINS
     amplitude = 0.0
     hwidth(:) = 5.0e3           ! in inputfile you can choose different values for x,y,z
     !
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = IniCondition)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = IniCondition)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "IniCondition")
+        CALL RaiseErrorNml("IniCondition")
     ENDIF
 
     ! Renaming all variables in the beginning
@@ -628,6 +658,7 @@ CONTAINS
     ! localVariables
     INTEGER                    :: allocStat, OutputMask(12), i
     INTEGER                    :: printtimeinterval
+    REAL                       :: printtimeinterval_sec
     INTEGER                    :: nOutPoints
     INTEGER                    :: readStat
     REAL, DIMENSION(:), ALLOCATABLE ::X, Y, Z
@@ -636,38 +667,40 @@ CONTAINS
     INTENT(INOUT)              :: EQN, IO, DISC
     INTENT(INOUT)              :: BND
     !------------------------------------------------------------------------
-    NAMELIST                   /Pickpoint/ printtimeinterval, OutputMask, nOutPoints, PPFileName
+    NAMELIST                   /Pickpoint/ printtimeinterval, printtimeinterval_sec, OutputMask, nOutPoints, PPFileName
     !------------------------------------------------------------------------
     !
     !Setting default values
     printtimeinterval = 1
+    printtimeinterval_sec = 0d0                                                  ! 0: iteration based output
     OutputMask(1:3) = 1
     OutputMask(4:12) = 0
     !
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Pickpoint)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Pickpoint)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Pickpoint")
+        CALL RaiseErrorNml("Pickpoint")
     ENDIF
     !
      DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval = printtimeinterval   ! read time interval at which output will be written
      DISC%DynRup%DynRup_out_atPickpoint%OutputMask(1:12) =  OutputMask(1:12)      ! read info of desired output 1/ yes, 0/ no
                                                                                 ! position: 1/ slip rate 2/ stress 3/ normal velocity
      DISC%DynRup%DynRup_out_atPickpoint%nOutPoints = nOutPoints                 ! 4/ in case of rate and state output friction and state variable
+     DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval_sec = printtimeinterval_sec ! if > 0, time interval at which output will be written
      logInfo(*) '| '
      logInfo(*) 'Record points for DR are allocated'
-     logInfo(*) 'Output interval:',DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval,'.'
+     IF (printtimeinterval_sec.GT.0.0d0) THEN
+       logInfo(*) 'Output interval:',DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval_sec,'seconds.'
+     ELSE
+       logInfo(*) 'Output interval:',DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval,'.'
+     ENDIF
 
      ALLOCATE(X(DISC%DynRup%DynRup_out_atPickpoint%nOutPoints))
      ALLOCATE(Y(DISC%DynRup%DynRup_out_atPickpoint%nOutPoints))
      ALLOCATE(Z(DISC%DynRup%DynRup_out_atPickpoint%nOutPoints))
 
       logInfo(*) ' Pickpoints read from ', TRIM(PPFileName)
-      CALL OpenFile(                                 &
-            UnitNr       = IO%UNIT%other01         , &
-            Name         = PPFileName            , &
-            create       = .FALSE.                          )
+      CALL readPointFile(PPFileName, nOutPoints, X, Y, Z)
         DO i = 1, nOutPoints
-          READ(IO%UNIT%other01,*) X(i), Y(i), Z(i)
 
             logInfo(*) 'Read in point :'
             logInfo(*) 'x = ', X(i)
@@ -675,7 +708,6 @@ CONTAINS
             logInfo(*) 'z = ', Z(i)
 
        END DO
-       CLOSE(IO%UNIT%other01)
       ALLOCATE ( DISC%DynRup%DynRup_out_atPickpoint%RecPoint(DISC%DynRup%DynRup_out_atPickpoint%nOutPoints),     &
                 STAT = allocStat                             )
 
@@ -727,9 +759,9 @@ CONTAINS
     refinement_strategy = 2
     refinement = 2
     !
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Elementwise)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Elementwise)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Elementwise")
+        CALL RaiseErrorNml("Elementwise")
     ENDIF
     !
     DISC%DynRup%DynRup_out_elementwise%printIntervalCriterion = printIntervalCriterion
@@ -829,9 +861,9 @@ CONTAINS
     BC_of = 0
     BC_pe = 0
     !
-    READ (IO%UNIT%FileIn, IOSTAT=readStat, nml = Boundaries)
+    READ (ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Boundaries)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Boundaries")
+        CALL RaiseErrorNml("Boundaries")
     ENDIF
     !
       !
@@ -1013,9 +1045,9 @@ CONTAINS
     !FileName_BackgroundStress = 'tpv16_input_file.txt'
 
     ! Read-in dynamic rupture parameters
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = DynamicRupture)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = DynamicRupture)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "DynamicRupture")
+        CALL RaiseErrorNml("DynamicRupture")
     ENDIF
            logInfo(*) 'Beginning dynamic rupture initialization. '
            
@@ -1126,6 +1158,12 @@ CONTAINS
            ! moment rate and frictional energy rate output on=1, off=0
            DISC%DynRup%energy_rate_output_on = energy_rate_output_on
            DISC%DynRup%energy_rate_printtimeinterval = energy_rate_printtimeinterval
+           IF (magnitude_output_on.EQ.1 .OR. energy_rate_output_on.EQ.1) THEN
+              logInfo0(*) 'Magnitude and energy rate are written to the energy output (see pickdt_energy)'
+           ENDIF
+           IF (energy_rate_output_on.EQ.1 .AND. energy_rate_printtimeinterval.NE.1) THEN
+              logWarning0(*) 'energy_rate_printtimeinterval is ignored, the energy rate is written every pickdt_energy seconds'
+           ENDIF
 
            !
            DISC%DynRup%OutputPointType = OutputPointType
@@ -1172,9 +1210,9 @@ CONTAINS
     NAMELIST                               /InflowBound/ setvar, char_option, &
                                                          PWFileName
     !------------------------------------------------------------------------
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = InflowBound)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = InflowBound)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "InflowBound")
+        CALL RaiseErrorNml("InflowBound")
     ENDIF
 
       DO i=1,n4
@@ -1312,10 +1350,10 @@ CONTAINS
     NAMELIST                               /InflowBoundPWFile/ varfield
     !-----------------------------------------------------------------------
     ALLOCATE(varfield(number))
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = InflowBoundPWFile) ! Write in namelistfile varfield(1) = ... and in the next line varfield(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = InflowBoundPWFile) ! Write in namelistfile varfield(1) = ... and in the next line varfield(2) = ...
                                                   ! and the same for u0_in
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "InflowBoundPWFile")
+        CALL RaiseErrorNml("InflowBoundPWFile")
     ENDIF
   END SUBROUTINE
     !------------------------------------------------------------------------
@@ -1332,9 +1370,9 @@ CONTAINS
     !-----------------------------------------------------------------------
     ALLOCATE(u0_in(EQN%nVar))
 
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = InflowBounduin) ! Write in namelistfile u0_in(1) = ... and in the next line u0_in(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = InflowBounduin) ! Write in namelistfile u0_in(1) = ... and in the next line u0_in(2) = ...
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "InflowBounduin")
+        CALL RaiseErrorNml("InflowBounduin")
     ENDIF
 
   END SUBROUTINE
@@ -1386,9 +1424,9 @@ CONTAINS
     ! Setting default values
     Type = 0
     !
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = SourceType)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = SourceType)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "SourceType")
+        CALL RaiseErrorNml("SourceType")
     ENDIF
     SOURCE%Type = Type
    SELECT CASE(SOURCE%Type)                                                 !
@@ -1999,10 +2037,10 @@ CONTAINS
     NAMELIST                               /Source110/ U0, l1
     !-----------------------------------------------------------------------
 
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Source110) ! Write in namelistfile U0(1) = ... and in the next line U0(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Source110) ! Write in namelistfile U0(1) = ... and in the next line U0(2) = ...
                                                   ! and the same for l1
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Source110")
+        CALL RaiseErrorNml("Source110")
     ENDIF
   END SUBROUTINE
 
@@ -2024,10 +2062,10 @@ ALLOCATE( SpacePositionx(nDirac), &
           Intensity(nDirac),       &
           EqnNr(nDirac))
 
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Source15) ! Write in namelistfile SpacePositionx(1) = ... and in the next line SpacePositionx(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Source15) ! Write in namelistfile SpacePositionx(1) = ... and in the next line SpacePositionx(2) = ...
                                                   ! and the same for SpacePositiony, SpacePositionz,...
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Source15")
+        CALL RaiseErrorNml("Source15")
     ENDIF
   END SUBROUTINE
 
@@ -2050,10 +2088,10 @@ ALLOCATE( SpacePositionx(nDirac), &
                f(nRicker),               &
                EqnNr(nRicker))
 
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Source1618) ! Write in namelistfile SpacePositionx(1) = ... and in the next line SpacePositionx(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Source1618) ! Write in namelistfile SpacePositionx(1) = ... and in the next line SpacePositionx(2) = ...
                                                   ! and the same for SpacePositiony, ...
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Source1618")
+        CALL RaiseErrorNml("Source1618")
     ENDIF
   END SUBROUTINE
 
@@ -2072,10 +2110,10 @@ ALLOCATE( SpacePositionx(nDirac), &
              l2(EQN%nVar), &
              T(EQN%nVar))
 
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Source17) ! Write in namelistfile U0(1) = ... and in the next line U0(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Source17) ! Write in namelistfile U0(1) = ... and in the next line U0(2) = ...
                                                   ! and the same for l1, l2, ...
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Source17")
+        CALL RaiseErrorNml("Source17")
     ENDIF
   END SUBROUTINE
 
@@ -2096,10 +2134,10 @@ ALLOCATE( SpacePositionx(nDirac), &
              Width(nPulseSource), &
              A0(nPulseSource))
 
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Source19) ! Write in namelistfile EqnNr(1) = ... and in the next line EqnNr(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Source19) ! Write in namelistfile EqnNr(1) = ... and in the next line EqnNr(2) = ...
                                                   ! and the same for Spacepositionx, ...
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Source19")
+        CALL RaiseErrorNml("Source19")
     ENDIF
   END SUBROUTINE
   !
@@ -2140,9 +2178,9 @@ ALLOCATE( SpacePositionx(nDirac), &
     !Setting default values
     enabled = 0
     !
-    READ (IO%UNIT%FileIn, IOSTAT=readStat, nml = SpongeLayer)
+    READ (ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = SpongeLayer)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "SpongeLayer")
+        CALL RaiseErrorNml("SpongeLayer")
     ENDIF
     SOURCE%Sponge%enabled = enabled
 
@@ -2203,10 +2241,10 @@ ALLOCATE( SpacePositionx(nDirac), &
                 SpongePower(nDGSponge), &
                 SigmaMax(nDGSponge))
 
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Sponges) ! Write in namelistfile SpongeDelta(1) = ... and in the next line SpongeDelta(2) = ...
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Sponges) ! Write in namelistfile SpongeDelta(1) = ... and in the next line SpongeDelta(2) = ...
                                                   ! and the same for SpongePower, ...
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Sponges")
+        CALL RaiseErrorNml("Sponges")
     ENDIF
    END SUBROUTINE
   !
@@ -2268,9 +2306,9 @@ ALLOCATE( SpacePositionx(nDirac), &
     periodic = 0
     periodic_direction(:) = 0
     !
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = MeshNml)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = MeshNml)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "MeshNml")
+        CALL RaiseErrorNml("MeshNml")
     ENDIF
 
     IO%MeshFile = MeshFile                               ! mesh input (mesh file name, no_file)
@@ -2436,9 +2474,9 @@ ALLOCATE( SpacePositionx(nDirac), &
     Material = 1
     FixTimeStep = 5000
     !                                                              ! DGM :
-    READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Discretization)
+    READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Discretization)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Discretization")
+        CALL RaiseErrorNml("Discretization")
     ENDIF
     DISC%Galerkin%DGFineOut1D = DGFineOut1D                        ! No. of red-refinements
     !                                                              ! for 2-D fine output
@@ -2533,17 +2571,6 @@ ALLOCATE( SpacePositionx(nDirac), &
              STOP
            ENDIF
 
-           IF(MESH%GlobalElemType.EQ.6) THEN
-                  READ(IO%UNIT%FileIn,*) DISC%Galerkin%nPolyMatOrig
-                  READ(IO%UNIT%FileIn,*) DISC%Galerkin%nPolyMap
-                  DISC%Galerkin%nPolyMat  = DISC%Galerkin%nPolyMatOrig + DISC%Galerkin%nPolyMap
-                  DISC%Galerkin%nDegFrMat = (DISC%Galerkin%nPolyMat+1)*(DISC%Galerkin%nPolyMat+2)*(DISC%Galerkin%nPolyMat+3)/6
-                    IF(DISC%Galerkin%nPolyMat.GT.DISC%Galerkin%nPoly) THEN
-                         logError(*) 'nPolyMat larger than nPoly. '
-                         STOP
-                    ENDIF
-           ENDIF
-
     END SELECT
     !
     DISC%CFL = CFL                               ! minimum Courant number
@@ -2580,10 +2607,12 @@ ALLOCATE( SpacePositionx(nDirac), &
       !------------------------------------------------------------------------
       INTEGER                          :: Rotation, Format, printIntervalCriterion, &
                                           pickDtType, nRecordPoint, PGMFlag, FaultOutputFlag, &
-                                          iOutputMaskMaterial(1:3), nRecordPoints, Refinement, energy_output_on, IntegrationMask(1:9), SurfaceOutput, SurfaceOutputRefinement
+                                          iOutputMaskMaterial(1:3), nRecordPoints, Refinement, energy_output_on, IntegrationMask(1:9), SurfaceOutput, SurfaceOutputRefinement, &
+                                          SurfaceGroundMotion
       REAL                             :: TimeInterval, pickdt, pickdt_energy, Interval, checkPointInterval, &
                                           OutputRegionBounds(1:6), SurfaceOutputInterval, &
-                                          ReceiverOutputInterval
+                                          ReceiverOutputInterval, SurfaceGroundMotionPeriods(1:10), &
+                                          SurfaceGroundMotionDamping
       CHARACTER(LEN=600)               :: OutputFile, RFileName, PGMFile, checkPointFile
       !> The checkpoint back-end is specified via a string.
       !!
@@ -2603,7 +2632,8 @@ ALLOCATE( SpacePositionx(nDirac), &
                                                 PGMFile, FaultOutputFlag, nRecordPoints, &
                                                 checkPointInterval, checkPointFile, checkPointBackend, energy_output_on, pickdt_energy, OutputRegionBounds, IntegrationMask, &
                                                 SurfaceOutput, SurfaceOutputRefinement, SurfaceOutputInterval, xdmfWriterBackend, &
-                                                ReceiverOutputInterval
+                                                ReceiverOutputInterval, SurfaceGroundMotion, SurfaceGroundMotionPeriods, &
+                                                SurfaceGroundMotionDamping
     !------------------------------------------------------------------------
     !
       logInfo(*) '<--------------------------------------------------------->'
@@ -2638,10 +2668,13 @@ ALLOCATE( SpacePositionx(nDirac), &
       SurfaceOutputRefinement = 0
       SurfaceOutputInterval = 1.0e99
       ReceiverOutputInterval = 1.0e99
+      SurfaceGroundMotion = 0
+      SurfaceGroundMotionPeriods(:) = 0.0
+      SurfaceGroundMotionDamping = 0.05
       !
-      READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = Output)
+      READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = Output)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "Output")
+        CALL RaiseErrorNml("Output")
     ENDIF
       IO%OutputFile = OutputFile                                                   ! read output field file
 
@@ -2651,6 +2684,9 @@ ALLOCATE( SpacePositionx(nDirac), &
       IO%SurfaceOutputRefinement = SurfaceOutputRefinement
       IO%SurfaceOutputInterval = SurfaceOutputInterval
       IO%ReceiverOutputInterval = ReceiverOutputInterval
+      IO%SurfaceGroundMotion = SurfaceGroundMotion
+      IO%SurfaceGroundMotionPeriods(:) = SurfaceGroundMotionPeriods(:)
+      IO%SurfaceGroundMotionDamping = SurfaceGroundMotionDamping
 
       logInfo(*) 'Data OUTPUT is written to files '
       logInfo(*) '  ' ,IO%OutputFile
@@ -2912,9 +2948,9 @@ ALLOCATE( SpacePositionx(nDirac), &
        ! energy output on = 1, off =0
        IO%energy_output_on = energy_output_on
 
+       IO%pickdt_energy = pickdt_energy
        IF(IO%energy_output_on .EQ. 1) THEN
-            logWarning0(*) 'Energy output currently only working with classic version. Turning it off.'
-            IO%energy_output_on = 0
+            logInfo0(*) 'Energies and seismic moment are written every ', IO%pickdt_energy, ' seconds'
        ENDIF
 
      IO%nRecordPoint = nRecordPoints  ! number of points to pick temporal signal
@@ -2923,13 +2959,9 @@ ALLOCATE( SpacePositionx(nDirac), &
       ! Read the single record points
       IF (nRecordPoints .GT. 0) THEN
          logInfo(*) 'Record Points read from ', TRIM(RFileName)
-         CALL OpenFile(                                 &
-               UnitNr       = IO%UNIT%other01         , &
-               Name         = RFileName            , &
-               create       = .FALSE.                          )
+         CALL readPointFile(RFileName, nRecordPoints, X, Y, Z)
 
          DO i = 1,nRecordPoints
-            READ(IO%UNIT%other01,*) X(i), Y(i), Z(i)
 
                logInfo0(*) 'in point :'                             !
                logInfo0(*) 'x = ', X(i)         !
@@ -2937,8 +2969,6 @@ ALLOCATE( SpacePositionx(nDirac), &
                logInfo0(*) 'z = ', Z(i)         !
 
          ENDDO
-         !
-         CLOSE(IO%UNIT%other01)
       ELSE
          logInfo(*) 'No single record points required. '
       END IF
@@ -3171,9 +3201,9 @@ ALLOCATE( SpacePositionx(nDirac), &
     WallTime_h = 1e20
     Delay_h = 0.
 
-   READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = AbortCriteria)
+   READ(ParameterLines, IOSTAT=readStat, IOMSG=ParameterMsg, nml = AbortCriteria)
     IF (readStat.NE.0) THEN
-        CALL RaiseErrorNml(IO%UNIT%FileIn, "AbortCriteria")
+        CALL RaiseErrorNml("AbortCriteria")
     ENDIF
 
     DISC%EndTime =  EndTime                                         ! time required
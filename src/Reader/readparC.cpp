@@ -38,8 +38,14 @@
  **/
 
 #include "SeisSol.h"
+#include "ParallelInputFile.h"
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
+
+/** The input file that is currently read from Fortran */
+static seissol::reader::ParallelInputFile s_inputFile;
 
 extern "C" {
 
@@ -48,4 +54,39 @@ void getParameterFile(int i_maxlen, char* o_file)
 	strncpy(o_file, seissol::SeisSol::main.parameterFile(), i_maxlen);
 }
 
+int openInputFile(const char* i_file, int* o_numLines, int* o_maxLineLength)
+{
+	if (!s_inputFile.open(i_file))
+		return 0;
+
+	std::vector<size_t> offsets;
+	std::vector<size_t> lengths;
+	s_inputFile.lines(offsets, lengths);
+
+	*o_numLines = lengths.size();
+	*o_maxLineLength = lengths.empty() ? 0 : *std::max_element(lengths.begin(), lengths.end());
+
+	return 1;
+}
+
+void getInputFileLines(int i_lineLength, char* o_lines)
+{
+	std::vector<size_t> offsets;
+	std::vector<size_t> lengths;
+	s_inputFile.lines(offsets, lengths);
+
+	// Fortran strings are padded with blanks
+	for (size_t i = 0; i < offsets.size(); i++) {
+		char* line = o_lines + i * i_lineLength;
+		size_t length = std::min<size_t>(lengths[i], i_lineLength);
+		std::copy(s_inputFile.data() + offsets[i], s_inputFile.data() + offsets[i] + length, line);
+		std::fill(line + length, line + i_lineLength, ' ');
+	}
+}
+
+void closeInputFile()
+{
+	s_inputFile.close();
+}
+
 } // extern "C"
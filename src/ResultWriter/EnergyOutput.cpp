@@ -0,0 +1,295 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Parallel in-situ output of the energies and the seismic moment
+ **/
+
+#include "Parallel/MPI.h"
+#include "EnergyOutput.h"
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+#include <Geometry/MeshTools.h>
+#include <Monitoring/instrumentation.fpp>
+#include <Modules/Modules.h>
+#include <Numerical_aux/Quadrature.h>
+#include <generated_code/kernel.h>
+#include <generated_code/init.h>
+#include <generated_code/tensor.h>
+#include "utils/logger.h"
+
+void seissol::writer::EnergyOutput::enable(double interval, bool magnitudeMask)
+{
+	m_enabled = true;
+	m_interval = interval;
+	m_magnitudeMask = magnitudeMask;
+}
+
+void seissol::writer::EnergyOutput::init( const char*                      outputPrefix,
+                                          MeshReader const&                meshReader,
+                                          initializers::LTS*               lts,
+                                          initializers::Lut*               ltsLut,
+                                          GlobalData*                      globalData,
+                                          physics::FrictionState const&    faultState )
+{
+	if (!m_enabled)
+		return;
+
+	const int rank = seissol::MPI::mpi.rank();
+
+	logInfo(rank) << "Initializing energy output with an interval of" << m_interval << "seconds.";
+
+	m_outputPrefix = outputPrefix;
+	m_globalData = globalData;
+
+	// The mesh reader may be freed after the initialization, keep what is required
+	const std::vector<Element>& elements = meshReader.getElements();
+	const std::vector<Vertex>& vertices = meshReader.getVertices();
+	m_cells.resize(elements.size());
+	for (unsigned int meshId = 0; meshId < elements.size(); meshId++) {
+		const CellMaterialData& material = ltsLut->lookup(lts->material, meshId);
+		const double rho = material.local.rho;
+		const double cp = material.local.getPWaveSpeed();
+		const double cs = material.local.getSWaveSpeed();
+
+		Cell& cell = m_cells[meshId];
+		cell.dofs = ltsLut->lookup(lts->dofs, meshId);
+		cell.jacobiDet = 6.0 * MeshTools::volume(elements[meshId], vertices);
+		cell.rho = rho;
+		cell.mu = rho * cs * cs;
+		cell.lambda = rho * cp * cp - 2.0 * cell.mu;
+	}
+
+	m_slip = faultState.slip;
+	m_slipRate1 = faultState.slipRate1;
+	m_slipRate2 = faultState.slipRate2;
+	m_tractionXY = faultState.tractionXY;
+	m_tractionXZ = faultState.tractionXZ;
+	m_numBndGP = faultState.numberOfPoints;
+	const std::vector<Fault>& fault = meshReader.getFault();
+	for (int i = 0; i < faultState.numberOfFaces; i++) {
+		// Faces are only counted on the rank of the "+" element
+		if (fault[i].element < 0)
+			continue;
+
+		const CellMaterialData& material = ltsLut->lookup(lts->material, fault[i].element);
+		const double cs = material.local.getSWaveSpeed();
+
+		FaultFace face;
+		face.face = i;
+		face.area = MeshTools::surface(elements[fault[i].element], fault[i].side, vertices);
+		face.muArea = material.local.rho * cs * cs * face.area;
+		face.magnitude = !m_magnitudeMask
+			|| (faultState.magnitudeOutput != 0L && faultState.magnitudeOutput[i] != 0);
+		m_faultFaces.push_back(face);
+	}
+
+	if (rank == 0) {
+		const std::string fileName = m_outputPrefix + "-energy.csv";
+		m_file.open(fileName.c_str(), std::ios::out | std::ios::app);
+		if (!m_file)
+			logError() << "Could not open energy output file" << fileName;
+
+		// Append after a restart
+		if (m_file.tellp() == 0)
+			m_file << "time,kinetic_energy,elastic_strain_energy,seismic_moment,moment_rate,frictional_energy_rate,moment_magnitude" << std::endl;
+		m_file << std::scientific << std::setprecision(std::numeric_limits<double>::max_digits10);
+	}
+
+	Modules::registerHook(*this, SIMULATION_START);
+	Modules::registerHook(*this, SYNCHRONIZATION_POINT);
+	setSyncInterval(m_interval);
+}
+
+void seissol::writer::EnergyOutput::simulationStart()
+{
+	syncPoint(0.0);
+}
+
+void seissol::writer::EnergyOutput::syncPoint(double currentTime)
+{
+	SCOREP_USER_REGION("energyoutput", SCOREP_USER_REGION_TYPE_FUNCTION)
+
+	m_stopwatch.start();
+
+	// The reduction of the last output time has overlapped with the time steps since then
+	complete();
+
+	computeVolumeEnergies();
+	computeFaultValues();
+
+	m_pendingTime = currentTime;
+	m_pending = true;
+#ifdef USE_MPI
+	MPI_Ireduce(m_localValues.data(), m_globalValues.data(), NUMBER_OF_VALUES, MPI_DOUBLE, MPI_SUM,
+		0, seissol::MPI::mpi.comm(), &m_request);
+#else // USE_MPI
+	m_globalValues = m_localValues;
+#endif // USE_MPI
+
+	m_stopwatch.pause();
+}
+
+void seissol::writer::EnergyOutput::close()
+{
+	if (!m_enabled)
+		return;
+
+	complete();
+
+	if (m_file.is_open())
+		m_file.close();
+
+	m_stopwatch.printTime("Time energy output:");
+}
+
+void seissol::writer::EnergyOutput::computeVolumeEnergies()
+{
+	constexpr auto quadPolyDegree = CONVERGENCE_ORDER+1;
+	constexpr auto numQuadPoints = quadPolyDegree * quadPolyDegree * quadPolyDegree;
+
+	double quadraturePoints[numQuadPoints][3];
+	double quadratureWeights[numQuadPoints];
+	seissol::quadrature::TetrahedronQuadrature(quadraturePoints, quadratureWeights, quadPolyDegree);
+
+	double kineticEnergy = 0.0;
+	double strainEnergy = 0.0;
+
+	alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(numericalSolutionData) reduction(+:kineticEnergy,strainEnergy)
+#endif // _OPENMP
+	for (unsigned int meshId = 0; meshId < m_cells.size(); meshId++) {
+		const Cell& cell = m_cells[meshId];
+
+		kernel::evalAtQP krnl;
+		krnl.evalAtQP = m_globalData->evalAtQPMatrix;
+		krnl.dofsQP = numericalSolutionData;
+		krnl.Q = cell.dofs;
+		krnl.execute();
+
+		auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
+#ifdef MULTIPLE_SIMULATIONS
+		// Only the first simulation is reported
+		auto numSub = numericalSolution.subtensor(0, yateto::slice<>(), yateto::slice<>());
+#else
+		auto numSub = numericalSolution;
+#endif
+
+		// Compliance of the isotropic material (anisotropic materials are averaged)
+		const double strainFactor = 1.0 / (4.0 * cell.mu);
+		const double volumetricFactor = cell.lambda / (3.0 * cell.lambda + 2.0 * cell.mu);
+
+		for (unsigned int i = 0; i < numQuadPoints; i++) {
+			const double weight = cell.jacobiDet * quadratureWeights[i];
+
+			const double sxx = numSub(i,0), syy = numSub(i,1), szz = numSub(i,2);
+			const double sxy = numSub(i,3), syz = numSub(i,4), sxz = numSub(i,5);
+			const double u = numSub(i,6), v = numSub(i,7), w = numSub(i,8);
+
+			kineticEnergy += weight * 0.5 * cell.rho * (u*u + v*v + w*w);
+
+			const double trace = sxx + syy + szz;
+			const double stressSquared = sxx*sxx + syy*syy + szz*szz + 2.0 * (sxy*sxy + syz*syz + sxz*sxz);
+			strainEnergy += weight * strainFactor * (stressSquared - volumetricFactor * trace * trace);
+		}
+	}
+
+	m_localValues[KINETIC_ENERGY] = kineticEnergy;
+	m_localValues[ELASTIC_STRAIN_ENERGY] = strainEnergy;
+}
+
+void seissol::writer::EnergyOutput::computeFaultValues()
+{
+	double moment = 0.0;
+	double momentRate = 0.0;
+	double frictionalEnergyRate = 0.0;
+
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) reduction(+:moment,momentRate,frictionalEnergyRate)
+#endif // _OPENMP
+	for (unsigned int i = 0; i < m_faultFaces.size(); i++) {
+		const FaultFace& face = m_faultFaces[i];
+		const unsigned int offset = face.face * m_numBndGP;
+
+		// Average over the boundary points (moment = shear modulus * area * slip)
+		double averageSlip = 0.0;
+		double averageSlipRate = 0.0;
+		double averageEnergyRate = 0.0;
+		for (unsigned int j = offset; j < offset + m_numBndGP; j++) {
+			averageSlip += m_slip[j];
+			averageSlipRate += std::sqrt(m_slipRate1[j]*m_slipRate1[j] + m_slipRate2[j]*m_slipRate2[j]);
+			// Frictional energy rate (Xu et al. 2012, p. 1333)
+			averageEnergyRate += m_tractionXY[j]*m_slipRate1[j] + m_tractionXZ[j]*m_slipRate2[j];
+		}
+
+		if (face.magnitude)
+			moment += face.muArea * averageSlip / m_numBndGP;
+		momentRate += face.muArea * averageSlipRate / m_numBndGP;
+		frictionalEnergyRate += face.area * averageEnergyRate / m_numBndGP;
+	}
+
+	m_localValues[SEISMIC_MOMENT] = moment;
+	m_localValues[MOMENT_RATE] = momentRate;
+	m_localValues[FRICTIONAL_ENERGY_RATE] = frictionalEnergyRate;
+}
+
+void seissol::writer::EnergyOutput::complete()
+{
+	if (!m_pending)
+		return;
+
+#ifdef USE_MPI
+	MPI_Wait(&m_request, MPI_STATUS_IGNORE);
+#endif // USE_MPI
+	m_pending = false;
+
+	if (seissol::MPI::mpi.rank() != 0)
+		return;
+
+	const double moment = m_globalValues[SEISMIC_MOMENT];
+	// Moment magnitude (Hanks and Kanamori) with the moment in Nm
+	const double magnitude = (moment > 0.0) ? 2.0 / 3.0 * std::log10(moment) - 6.07 : 0.0;
+
+	m_file << m_pendingTime << ','
+		<< m_globalValues[KINETIC_ENERGY] << ','
+		<< m_globalValues[ELASTIC_STRAIN_ENERGY] << ','
+		<< moment << ','
+		<< m_globalValues[MOMENT_RATE] << ','
+		<< m_globalValues[FRICTIONAL_ENERGY_RATE] << ','
+		<< magnitude << std::endl;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Parallel in-situ output of the energies and the seismic moment
+ **/
+
+#ifndef ENERGYOUTPUT_H
+#define ENERGYOUTPUT_H
+
+#include "Parallel/MPI.h"
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Geometry/MeshReader.h>
+#include <Initializer/LTS.h>
+#include <Initializer/tree/Lut.hpp>
+#include <Initializer/typedefs.hpp>
+#include <Modules/Module.h>
+#include <Physics/FrictionSolver.h>
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol
+{
+namespace writer
+{
+
+/**
+ * Time series of the total energies and the seismic moment, reduced over all ranks.
+ *
+ * The reduction of an output time is started with a non-blocking MPI call and completed
+ * at the next output time, it overlaps with the time steps in between.
+ */
+class EnergyOutput : public seissol::Module
+{
+private:
+	/** Output values that are summed over all ranks */
+	enum Values {
+		KINETIC_ENERGY = 0,
+		ELASTIC_STRAIN_ENERGY,
+		SEISMIC_MOMENT,
+		MOMENT_RATE,
+		FRICTIONAL_ENERGY_RATE,
+		NUMBER_OF_VALUES
+	};
+
+	/** Cell of this rank (duplicates of the copy layer are only stored once) */
+	struct Cell {
+		const real* dofs;
+		/** Determinant of the Jacobian of the reference element mapping */
+		double jacobiDet;
+		double rho;
+		double mu;
+		double lambda;
+	};
+
+	/** Fault face owned by this rank (the "+" element is local) */
+	struct FaultFace {
+		unsigned int face;
+		double area;
+		/** Shear modulus times face area */
+		double muArea;
+		/** Contributes to the seismic moment (DISC%DynRup%magnitude_out) */
+		bool magnitude;
+	};
+
+	/** Is enabled? */
+	bool m_enabled;
+
+	std::string m_outputPrefix;
+
+	double m_interval;
+
+	/** Restrict the seismic moment to the faces selected for the magnitude output */
+	bool m_magnitudeMask;
+
+	std::vector<Cell> m_cells;
+
+	GlobalData* m_globalData;
+
+	/** Slip path, slip rates and shear tractions of the fault faces [face][boundary point] */
+	const double* m_slip;
+	const double* m_slipRate1;
+	const double* m_slipRate2;
+	const double* m_tractionXY;
+	const double* m_tractionXZ;
+	unsigned int m_numBndGP;
+	std::vector<FaultFace> m_faultFaces;
+
+	std::array<double, NUMBER_OF_VALUES> m_localValues;
+	std::array<double, NUMBER_OF_VALUES> m_globalValues;
+
+	/** Time of the reduction in flight */
+	double m_pendingTime;
+	bool m_pending;
+#ifdef USE_MPI
+	MPI_Request m_request;
+#endif // USE_MPI
+
+	/** The output file (rank 0 only) */
+	std::ofstream m_file;
+
+	Stopwatch m_stopwatch;
+
+public:
+	EnergyOutput()
+		: m_enabled(false), m_interval(0), m_magnitudeMask(false), m_globalData(0L),
+		  m_slip(0L), m_slipRate1(0L), m_slipRate2(0L), m_tractionXY(0L), m_tractionXZ(0L), m_numBndGP(0),
+		  m_pendingTime(0), m_pending(false)
+#ifdef USE_MPI
+		  , m_request(MPI_REQUEST_NULL)
+#endif // USE_MPI
+	{}
+
+	/**
+	 * @param interval Time between two outputs
+	 * @param magnitudeMask Only faces with magnitude output contribute to the seismic moment
+	 */
+	void enable(double interval, bool magnitudeMask);
+
+	/**
+	 * @param faultState Slip, slip rates, tractions and the magnitude output mask of the fault faces
+	 */
+	void init(  const char*                      outputPrefix,
+	            MeshReader const&                meshReader,
+	            initializers::LTS*               lts,
+	            initializers::Lut*               ltsLut,
+	            GlobalData*                      globalData,
+	            physics::FrictionState const&    faultState );
+
+	void close();
+
+	//
+	// Hooks
+	//
+	void simulationStart();
+
+	void syncPoint(double currentTime);
+
+private:
+	void computeVolumeEnergies();
+
+	void computeFaultValues();
+
+	/**
+	 * Waits for the reduction in flight and writes its values
+	 */
+	void complete();
+};
+
+}
+
+}
+
+#endif // ENERGYOUTPUT_H
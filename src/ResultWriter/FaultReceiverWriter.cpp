@@ -0,0 +1,230 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Time-based output of the fault receivers
+ **/
+
+#include "Parallel/MPI.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "utils/env.h"
+
+#include "FaultReceiverWriter.h"
+#include "Modules/Modules.h"
+#include "Solver/Interoperability.h"
+
+extern seissol::Interoperability e_interoperability;
+
+void seissol::writer::FaultReceiverWriter::init(const char* outputPrefix,
+	unsigned int numReceivers, const int* receivers,
+	unsigned int numVariables, const double* const* outputValues,
+	double interval)
+{
+	const int rank = seissol::MPI::mpi.rank();
+
+	m_enabled = true;
+
+	m_numReceivers = numReceivers;
+	m_numVariables = numVariables;
+	m_outputValues.assign(outputValues, outputValues + numVariables);
+	m_interval = interval;
+	m_tolerance = 1e-6 * interval;
+
+	// Has to be the same on all ranks
+	m_maxSamples = std::max(1, utils::Env::get<int>("SEISSOL_FAULT_RECEIVER_SAMPLES", 100));
+
+	logInfo(rank) << "Initializing time based fault receiver output with an interval of" << interval
+		<< "seconds, writing blocks of" << m_maxSamples << "samples";
+
+	// Initialize the asynchronous module
+	async::Module<FaultReceiverWriterExecutor, FaultReceiverInitParam, FaultReceiverParam>::init();
+
+	std::vector<std::uint64_t> globalReceivers(receivers, receivers + numReceivers);
+
+	unsigned int bufferId = addSyncBuffer(outputPrefix, strlen(outputPrefix)+1, true);
+	assert(bufferId == FaultReceiverWriterExecutor::OUTPUT_PREFIX); NDBG_UNUSED(bufferId);
+	bufferId = addSyncBuffer(globalReceivers.data(), numReceivers * sizeof(std::uint64_t));
+	assert(bufferId == FaultReceiverWriterExecutor::RECEIVERS);
+	bufferId = addBuffer(0L, m_maxSamples * sizeof(double));
+	assert(bufferId == FaultReceiverWriterExecutor::TIMES);
+	bufferId = addBuffer(0L, numReceivers * m_maxSamples * numVariables * sizeof(double));
+	assert(bufferId == FaultReceiverWriterExecutor::DATA);
+
+	sendBuffer(FaultReceiverWriterExecutor::OUTPUT_PREFIX);
+	sendBuffer(FaultReceiverWriterExecutor::RECEIVERS);
+
+	FaultReceiverInitParam param;
+	param.numVariables = numVariables;
+	param.maxSamples = m_maxSamples;
+	param.rank = rank;
+	callInit(param);
+
+	removeBuffer(FaultReceiverWriterExecutor::OUTPUT_PREFIX);
+	removeBuffer(FaultReceiverWriterExecutor::RECEIVERS);
+
+	m_snapshot.resize(numReceivers * numVariables);
+	m_nextSnapshot.resize(numReceivers * numVariables);
+	m_times.resize(m_maxSamples);
+	m_data.resize(numReceivers * m_maxSamples * numVariables);
+
+	// Samples are written when the buffer is full, we only need the
+	// synchronization point at the end of the simulation
+	setSyncInterval(std::numeric_limits<double>::max());
+	Modules::registerHook(*this, SYNCHRONIZATION_POINT);
+}
+
+void seissol::writer::FaultReceiverWriter::step(double time, double timeStepWidth)
+{
+	if (!m_enabled)
+		return;
+
+	m_stopwatch.start();
+
+	advance(time, time + timeStepWidth);
+
+	m_stopwatch.pause();
+}
+
+void seissol::writer::FaultReceiverWriter::syncPoint(double currentTime)
+{
+	m_stopwatch.start();
+
+	advance(currentTime, currentTime);
+	flush();
+
+	m_stopwatch.pause();
+}
+
+void seissol::writer::FaultReceiverWriter::takeSnapshot(double time, std::vector<double> &snapshot)
+{
+	if (m_numReceivers == 0)
+		return;
+
+	e_interoperability.calcFaultReceiverOutput(time);
+
+	for (unsigned int i = 0; i < m_numReceivers; i++) {
+		for (unsigned int j = 0; j < m_numVariables; j++)
+			snapshot[i*m_numVariables + j] = m_outputValues[j][i];
+	}
+}
+
+void seissol::writer::FaultReceiverWriter::advance(double time, double endTime)
+{
+	if (!m_started) {
+		// First sample not before the start of the simulation
+		m_nextSample = static_cast<unsigned long>(std::max(0.0, std::ceil((time - m_tolerance) / m_interval)));
+		m_started = true;
+	}
+
+	if (m_pendingTimes.empty()
+			&& sampleTime(m_nextSample) > time + m_tolerance
+			&& sampleTime(m_nextSample) >= endTime - m_tolerance)
+		// Nothing to do in this time step
+		return;
+
+	takeSnapshot(time, m_nextSnapshot);
+
+	// Samples between the last snapshot and this one
+	for (std::vector<double>::const_iterator it = m_pendingTimes.begin();
+			it != m_pendingTimes.end(); ++it) {
+		const double weight = (time > m_snapshotTime) ? (*it - m_snapshotTime) / (time - m_snapshotTime) : 1.0;
+		addSample(*it, m_snapshot.data(), m_nextSnapshot.data(), weight);
+	}
+	m_pendingTimes.clear();
+
+	// Samples at this snapshot
+	while (sampleTime(m_nextSample) <= time + m_tolerance) {
+		addSample(sampleTime(m_nextSample), m_nextSnapshot.data(), m_nextSnapshot.data(), 1.0);
+		m_nextSample++;
+	}
+
+	// Samples that require the next snapshot
+	while (sampleTime(m_nextSample) < endTime - m_tolerance) {
+		m_pendingTimes.push_back(sampleTime(m_nextSample));
+		m_nextSample++;
+	}
+
+	m_snapshot.swap(m_nextSnapshot);
+	m_snapshotTime = time;
+}
+
+void seissol::writer::FaultReceiverWriter::addSample(double time,
+	const double* previous, const double* next, double weight)
+{
+	m_times[m_numSamples] = time;
+
+	const unsigned int sampleSize = m_numVariables;
+	for (unsigned int i = 0; i < m_numReceivers; i++) {
+		double* sample = &m_data[(i*m_maxSamples + m_numSamples) * sampleSize];
+		for (unsigned int j = 0; j < sampleSize; j++)
+			sample[j] = (1.0 - weight) * previous[i*sampleSize + j] + weight * next[i*sampleSize + j];
+	}
+
+	m_numSamples++;
+
+	// The number of samples is the same on all ranks
+	if (m_numSamples == m_maxSamples)
+		flush();
+}
+
+void seissol::writer::FaultReceiverWriter::flush()
+{
+	if (m_numSamples == 0)
+		return;
+
+	typedef async::Module<FaultReceiverWriterExecutor, FaultReceiverInitParam, FaultReceiverParam> AsyncModule;
+
+	// The buffers may still be in use by the last write
+	wait();
+
+	std::copy(m_times.begin(), m_times.begin() + m_numSamples,
+		AsyncModule::managedBuffer<double*>(FaultReceiverWriterExecutor::TIMES));
+	std::copy(m_data.begin(), m_data.end(),
+		AsyncModule::managedBuffer<double*>(FaultReceiverWriterExecutor::DATA));
+
+	sendBuffer(FaultReceiverWriterExecutor::TIMES);
+	sendBuffer(FaultReceiverWriterExecutor::DATA);
+
+	FaultReceiverParam param;
+	param.numSamples = m_numSamples;
+	call(param);
+
+	m_numSamples = 0;
+}
@@ -0,0 +1,234 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Time-based output of the fault receivers
+ **/
+
+#ifndef FAULTRECEIVERWRITER_H
+#define FAULTRECEIVERWRITER_H
+
+#include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
+
+#include <string>
+#include <vector>
+
+#include "utils/logger.h"
+
+#include "async/Module.h"
+
+#include "FaultReceiverWriterExecutor.h"
+#include "Modules/Module.h"
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol
+{
+
+namespace writer
+{
+
+/**
+ * Time-based output of the fault receivers
+ *
+ * The fault receivers are sampled at multiples of the output interval,
+ * independent of the time step of the first cluster. A sample is
+ * interpolated linearly between the fault states at the beginning of the
+ * two time steps of the first cluster around it. The samples are buffered
+ * and appended to the files by the asynchronous executor once the buffer
+ * is full.
+ */
+class FaultReceiverWriter : private async::Module<FaultReceiverWriterExecutor, FaultReceiverInitParam, FaultReceiverParam>,
+	public seissol::Module
+{
+private:
+	/** Is enabled? */
+	bool m_enabled;
+
+	/** The asynchronous executor */
+	FaultReceiverWriterExecutor m_executor;
+
+	/** Number of local fault receivers */
+	unsigned int m_numReceivers;
+
+	/** Number of output variables */
+	unsigned int m_numVariables;
+
+	/** Output values of each variable, filled by the Fortran fault output */
+	std::vector<const double*> m_outputValues;
+
+	/** Time between two samples */
+	double m_interval;
+
+	/** Tolerance when comparing sample times */
+	double m_tolerance;
+
+	/** Index of the next sample */
+	unsigned long m_nextSample;
+
+	/** Set when the first time step is done */
+	bool m_started;
+
+	/** Time of the last fault state snapshot */
+	double m_snapshotTime;
+
+	/** The last fault state snapshot [receiver][variable] */
+	std::vector<double> m_snapshot;
+
+	/** Temporary storage for the next snapshot */
+	std::vector<double> m_nextSnapshot;
+
+	/** Sample times that require the next snapshot */
+	std::vector<double> m_pendingTimes;
+
+	/** Maximum number of samples in the buffer */
+	unsigned int m_maxSamples;
+
+	/** Number of samples in the buffer */
+	unsigned int m_numSamples;
+
+	/** Time of each sample in the buffer */
+	std::vector<double> m_times;
+
+	/** Buffered samples [receiver][sample][variable] */
+	std::vector<double> m_data;
+
+	/** Frontend stopwatch */
+	Stopwatch m_stopwatch;
+
+public:
+	FaultReceiverWriter()
+		: m_enabled(false),
+		m_numReceivers(0), m_numVariables(0),
+		m_interval(0), m_tolerance(0), m_nextSample(0), m_started(false),
+		m_snapshotTime(0),
+		m_maxSamples(0), m_numSamples(0)
+	{
+	}
+
+	/**
+	 * Called by ASYNC on all ranks
+	 */
+	void setUp()
+	{
+		setExecutor(m_executor);
+		if (isAffinityNecessary()) {
+			const auto freeCpus = parallel::getFreeCPUsMask();
+			logInfo(seissol::MPI::mpi.rank()) << "Fault receiver writer thread affinity:" << parallel::maskToString(freeCpus);
+			if (parallel::freeCPUsMaskEmpty(freeCpus)) {
+				logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+			}
+			setAffinityIfNecessary(freeCpus);
+		}
+	}
+
+	/**
+	 * Has to be called on all ranks
+	 *
+	 * @param receivers The global index of each local receiver
+	 * @param outputValues For each variable, a pointer to the values of all local receivers
+	 */
+	void init(const char* outputPrefix,
+		unsigned int numReceivers, const int* receivers,
+		unsigned int numVariables, const double* const* outputValues,
+		double interval);
+
+	/**
+	 * Called by the first cluster before each time step
+	 *
+	 * @param time The start of the time step
+	 */
+	void step(double time, double timeStepWidth);
+
+	void close()
+	{
+		if (m_enabled)
+			wait();
+
+		finalize();
+
+		if (!m_enabled)
+			return;
+
+		m_stopwatch.printTime("Time fault receiver writer frontend:");
+	}
+
+	void tearDown()
+	{
+		m_executor.finalize();
+	}
+
+	//
+	// Hooks
+	//
+	/**
+	 * Only called at forced synchronization points (e.g. at the end of the simulation)
+	 */
+	void syncPoint(double currentTime);
+
+private:
+	/**
+	 * Computes the fault receiver output at <code>time</code>
+	 */
+	void takeSnapshot(double time, std::vector<double> &snapshot);
+
+	/**
+	 * Stores all samples up to <code>time</code> and marks the samples
+	 * before <code>endTime</code> as pending
+	 */
+	void advance(double time, double endTime);
+
+	/**
+	 * Adds a sample interpolated between two snapshots
+	 *
+	 * @param weight The weight of <code>next</code>
+	 */
+	void addSample(double time, const double* previous, const double* next, double weight);
+
+	/**
+	 * Hands the buffered samples to the executor
+	 */
+	void flush();
+
+	double sampleTime(unsigned long sample) const
+	{
+		return sample * m_interval;
+	}
+};
+
+}
+
+}
+
+#endif // FAULTRECEIVERWRITER_H
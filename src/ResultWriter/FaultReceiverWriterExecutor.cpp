@@ -0,0 +1,100 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous backend of the time-based fault receiver output
+ **/
+
+#include "Parallel/MPI.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "utils/logger.h"
+#include "FaultReceiverWriterExecutor.h"
+
+void seissol::writer::FaultReceiverWriterExecutor::execInit(const async::ExecInfo &info,
+	const seissol::writer::FaultReceiverInitParam &param)
+{
+	const std::uint64_t numReceivers = info.bufferSize(RECEIVERS) / sizeof(std::uint64_t);
+	const std::uint64_t* receivers = static_cast<const std::uint64_t*>(info.buffer(RECEIVERS));
+	m_numVariables = param.numVariables;
+	m_maxSamples = param.maxSamples;
+
+#ifdef USE_MPI
+	MPI_Comm_split(seissol::MPI::mpi.comm(), (numReceivers > 0 ? 0 : MPI_UNDEFINED), 0, &m_comm);
+#endif // USE_MPI
+
+	// Same names as in the Fortran initialization (construct_file_name)
+	const char* outputPrefix = static_cast<const char*>(info.buffer(OUTPUT_PREFIX));
+	for (std::uint64_t i = 0; i < numReceivers; i++) {
+		std::ostringstream name;
+		name << outputPrefix << "-faultreceiver-" << std::setfill('0') << std::setw(5) << receivers[i];
+#ifdef PARALLEL
+		name << '-' << std::setw(5) << param.rank;
+#endif // PARALLEL
+		name << ".dat";
+		m_fileNames.push_back(name.str());
+	}
+}
+
+void seissol::writer::FaultReceiverWriterExecutor::exec(const async::ExecInfo &info,
+	const seissol::writer::FaultReceiverParam &param)
+{
+	if (m_fileNames.empty())
+		return;
+
+	m_stopwatch.start();
+
+	const double* times = static_cast<const double*>(info.buffer(TIMES));
+	const double* data = static_cast<const double*>(info.buffer(DATA));
+
+	for (std::uint64_t i = 0; i < m_fileNames.size(); i++) {
+		std::ofstream file(m_fileNames[i].c_str(), std::ios::app);
+		if (!file)
+			logError() << "Could not open fault receiver file" << m_fileNames[i];
+
+		file << std::scientific << std::setprecision(15);
+		for (std::uint64_t s = 0; s < param.numSamples; s++) {
+			file << "  " << times[s];
+			const double* sample = &data[(i * m_maxSamples + s) * m_numVariables];
+			for (std::uint64_t v = 0; v < m_numVariables; v++)
+				file << "  " << sample[v];
+			file << '\n';
+		}
+	}
+
+	m_stopwatch.pause();
+}
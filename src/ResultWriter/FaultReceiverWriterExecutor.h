@@ -0,0 +1,142 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous backend of the time-based fault receiver output
+ **/
+
+#ifndef FAULTRECEIVERWRITEREXECUTOR_H
+#define FAULTRECEIVERWRITEREXECUTOR_H
+
+#include "Parallel/MPI.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "async/ExecInfo.h"
+
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol
+{
+namespace writer
+{
+struct FaultReceiverInitParam
+{
+	/** Number of output variables (without the time) */
+	std::uint64_t numVariables;
+
+	/** Maximum number of samples in one block */
+	std::uint64_t maxSamples;
+
+	/** Rank of the frontend (used in the file names) */
+	int rank;
+};
+
+struct FaultReceiverParam
+{
+	/** Number of samples in this block */
+	std::uint64_t numSamples;
+};
+
+/**
+ * Appends blocks of fault receiver samples to the ASCII files of the
+ * receivers. The headers of the files are written by the Fortran
+ * initialization.
+ */
+class FaultReceiverWriterExecutor
+{
+public:
+	enum BufferIds {
+		OUTPUT_PREFIX = 0,
+		RECEIVERS = 1,
+		TIMES = 2,
+		DATA = 3
+	};
+
+private:
+#ifdef USE_MPI
+	/** The MPI communicator for the writer */
+	MPI_Comm m_comm;
+#endif // USE_MPI
+
+	/** File name of each receiver */
+	std::vector<std::string> m_fileNames;
+
+	std::uint64_t m_numVariables;
+
+	std::uint64_t m_maxSamples;
+
+	/** Backend stopwatch */
+	Stopwatch m_stopwatch;
+
+public:
+	FaultReceiverWriterExecutor()
+		:
+#ifdef USE_MPI
+		m_comm(MPI_COMM_NULL),
+#endif // USE_MPI
+		m_numVariables(0),
+		m_maxSamples(0) {}
+
+	void execInit(const async::ExecInfo &info, const FaultReceiverInitParam &param);
+
+	/**
+	 * Appends one block of samples
+	 */
+	void exec(const async::ExecInfo &info, const FaultReceiverParam &param);
+
+	void finalize()
+	{
+#ifdef USE_MPI
+		if (m_comm != MPI_COMM_NULL) {
+			m_stopwatch.printTime("Time fault receiver writer backend:", m_comm);
+			MPI_Comm_free(&m_comm);
+			m_comm = MPI_COMM_NULL;
+		}
+#else // USE_MPI
+		if (!m_fileNames.empty())
+			m_stopwatch.printTime("Time fault receiver writer backend:");
+#endif // USE_MPI
+
+		m_fileNames.clear();
+	}
+};
+
+}
+
+}
+
+#endif // FAULTRECEIVERWRITEREXECUTOR_H
@@ -64,4 +64,13 @@ void fault_hdf_close()
 	seissol::SeisSol::main.faultWriter().close();
 }
 
+void fault_receiver_init(const char* outputPrefix,
+		int nReceivers, const int* receivers,
+		int nVariables, const double** outputValues,
+		double interval)
+{
+	seissol::SeisSol::main.faultReceiverWriter().init(outputPrefix,
+		nReceivers, receivers, nVariables, outputValues, interval);
+}
+
 }
@@ -71,6 +71,18 @@ module FaultWriter
 
             real( kind=c_double ), value                    :: time
         end subroutine fault_hdf_write
+
+        subroutine fault_receiver_init(outputPrefix, nReceivers, receivers, &
+                nVariables, outputValues, interval) bind(C, name="fault_receiver_init")
+            use, intrinsic :: iso_c_binding
+
+            character( kind=c_char ), dimension(*), intent(in) :: outputPrefix
+            integer( kind=c_int ), value                       :: nReceivers
+            integer( kind=c_int ), dimension(*), intent(in)    :: receivers
+            integer( kind=c_int ), value                       :: nVariables
+            type(c_ptr), dimension(*), intent(in)              :: outputValues
+            real( kind=c_double ), value                       :: interval
+        end subroutine fault_receiver_init
     end interface
 
 contains
@@ -125,6 +137,46 @@ contains
         deallocate(cells, vertices)
     end subroutine initFaultOutput
 
+    subroutine initFaultReceiverOutput(points, nPoints, outputValues, outputPrefix, interval)
+        implicit none
+
+        type(tUnstructPoint), dimension(:)  :: points
+        integer                             :: nPoints
+        real, dimension(:,:,:), pointer     :: outputValues
+        character(len=60)                   :: outputPrefix
+        real                                :: interval
+
+        integer, dimension(:), allocatable :: receivers
+        integer :: nVariables
+        integer :: i
+        real, dimension(:), pointer :: dummyBuffer
+        type(c_ptr), dimension(:), allocatable :: cOutputValues
+
+        if (nPoints .gt. 0) then
+            nVariables = size(outputValues, 3)
+        else
+            nVariables = 0
+        endif
+
+        allocate(receivers(nPoints), cOutputValues(nVariables))
+
+        do i=1,nPoints
+            receivers(i) = points(i)%globalreceiverindex
+        enddo
+
+        do i=1,nVariables
+            dummyBuffer => outputValues(:,1,i)
+            cOutputValues(i) = c_loc(dummyBuffer(1))
+        enddo
+
+        call fault_receiver_init(trim(outputPrefix) // c_null_char, &
+            nPoints, receivers, &
+            nVariables, cOutputValues, &
+            interval)
+
+        deallocate(receivers, cOutputValues)
+    end subroutine initFaultReceiverOutput
+
     subroutine writeFault(time)
         implicit none
 
@@ -51,15 +51,16 @@
 #include <Geometry/MeshTools.h>
 #include <Modules/Modules.h>
 
-void seissol::writer::FreeSurfaceWriter::constructSurfaceMesh(  MeshReader const& meshReader,
-                                                                unsigned*&        cells,
-                                                                double*&          vertices,
-                                                                unsigned&         nCells,
-                                                                unsigned&         nVertices )
+void seissol::writer::FreeSurfaceWriter::constructSurfaceMesh(  MeshReader const&                       meshReader,
+                                                                seissol::solver::FreeSurfaceIntegrator& freeSurfaceIntegrator,
+                                                                unsigned*&                              cells,
+                                                                double*&                                vertices,
+                                                                unsigned&                               nCells,
+                                                                unsigned&                               nVertices )
 {
   // TODO: Vertices could be pre-filtered
-  nCells = m_freeSurfaceIntegrator->totalNumberOfTriangles;
-  nVertices = 3 * m_freeSurfaceIntegrator->totalNumberOfTriangles;
+  nCells = freeSurfaceIntegrator.totalNumberOfTriangles;
+  nVertices = 3 * freeSurfaceIntegrator.totalNumberOfTriangles;
   if (nCells == 0 || nVertices == 0) {
     cells = NULL;
     vertices = NULL;
@@ -72,12 +73,12 @@ void seissol::writer::FreeSurfaceWriter::constructSurfaceMesh(  MeshReader const
   std::vector<Element> const& meshElements = meshReader.getElements();
   std::vector<Vertex> const& meshVertices = meshReader.getVertices();
 
-  unsigned numberOfSubTriangles = m_freeSurfaceIntegrator->triRefiner.subTris.size();
+  unsigned numberOfSubTriangles = freeSurfaceIntegrator.triRefiner.subTris.size();
 
   unsigned idx = 0;
-  unsigned* meshIds = m_freeSurfaceIntegrator->surfaceLtsTree.var(m_freeSurfaceIntegrator->surfaceLts.meshId);
-  unsigned* sides = m_freeSurfaceIntegrator->surfaceLtsTree.var(m_freeSurfaceIntegrator->surfaceLts.side);
-  for (unsigned fs = 0; fs < m_freeSurfaceIntegrator->totalNumberOfFreeSurfaces; ++fs) {
+  unsigned* meshIds = freeSurfaceIntegrator.surfaceLtsTree.var(freeSurfaceIntegrator.surfaceLts.meshId);
+  unsigned* sides = freeSurfaceIntegrator.surfaceLtsTree.var(freeSurfaceIntegrator.surfaceLts.side);
+  for (unsigned fs = 0; fs < freeSurfaceIntegrator.totalNumberOfFreeSurfaces; ++fs) {
     unsigned meshId = meshIds[fs];
     unsigned side = sides[fs];
     Eigen::Vector3d x[3], a, b;
@@ -93,7 +94,7 @@ void seissol::writer::FreeSurfaceWriter::constructSurfaceMesh(  MeshReader const
     b = x[2]-x[0];
 
     for (unsigned tri = 0; tri < numberOfSubTriangles; ++tri) {
-      seissol::refinement::Triangle const& subTri = m_freeSurfaceIntegrator->triRefiner.subTris[tri];
+      seissol::refinement::Triangle const& subTri = freeSurfaceIntegrator.triRefiner.subTris[tri];
       for (unsigned vertex = 0; vertex < 3; ++vertex) {
         Eigen::Vector3d v = x[0] + subTri.x[vertex][0] * a + subTri.x[vertex][1] * b;
         vertices[3*idx + 0] = v(0);
@@ -136,7 +137,7 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
 	double* vertices;
 	unsigned nCells;
 	unsigned nVertices;
-	constructSurfaceMesh(meshReader, cells, vertices, nCells, nVertices);
+	constructSurfaceMesh(meshReader, *m_freeSurfaceIntegrator, cells, vertices, nCells, nVertices);
 
 	AsyncCellIDs<3> cellIds(nCells, nVertices, cells);
 
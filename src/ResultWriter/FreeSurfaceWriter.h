@@ -76,15 +76,19 @@ private:
   /** free surface integration module. */
   seissol::solver::FreeSurfaceIntegrator* m_freeSurfaceIntegrator;
 
-  void constructSurfaceMesh(  MeshReader const& meshReader,
-                              unsigned*&        cells,
-                              double*&          vertices,
-                              unsigned&         nCells,
-                              unsigned&         nVertices );
-
 public:
 	FreeSurfaceWriter() : m_enabled(false), m_freeSurfaceIntegrator(NULL) {}
 
+  /**
+   * Constructs the sub triangles of the free surface (also used by the ground motion output)
+   */
+  static void constructSurfaceMesh( MeshReader const&                       meshReader,
+                                    seissol::solver::FreeSurfaceIntegrator& freeSurfaceIntegrator,
+                                    unsigned*&                              cells,
+                                    double*&                                vertices,
+                                    unsigned&                               nCells,
+                                    unsigned&                               nVertices );
+
 	/**
 	 * Called by ASYNC on all ranks
 	 */
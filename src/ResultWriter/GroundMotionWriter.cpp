@@ -0,0 +1,187 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Output of the in-situ ground motion summary of the free surface
+ **/
+
+#include <Parallel/MPI.h>
+#include "GroundMotionWriter.h"
+
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "AsyncCellIDs.h"
+#include "FreeSurfaceWriter.h"
+#include "SeisSol.h"
+#include <Modules/Modules.h>
+
+void seissol::writer::GroundMotionWriter::enable(std::vector<double> const& periods, double damping)
+{
+	m_enabled = true;
+
+	m_groundMotion.configure(periods, damping);
+}
+
+void seissol::writer::GroundMotionWriter::init( MeshReader const&                       meshReader,
+                                                seissol::solver::FreeSurfaceIntegrator* freeSurfaceIntegrator,
+                                                char const*                             outputPrefix,
+                                                xdmfwriter::BackendType                 backend )
+{
+	if (!m_enabled)
+		return;
+
+	int const rank = seissol::MPI::mpi.rank();
+
+	logInfo(rank) << "Initializing ground motion output with" << m_groundMotion.numberOfPeriods()
+		<< "response spectrum periods.";
+
+	// One summary per time cluster, the triangles are ordered like in the free surface output
+	unsigned const numberOfClusters = freeSurfaceIntegrator->surfaceLtsTree.numChildren();
+	m_clusters.reserve(numberOfClusters);
+	unsigned offset = 0;
+	for (unsigned cluster = 0; cluster < numberOfClusters; ++cluster) {
+		m_clusters.push_back(seissol::solver::GroundMotionCluster(m_groundMotion, *freeSurfaceIntegrator, cluster));
+		m_clusterOffsets.push_back(offset);
+		offset += m_clusters.back().numberOfTriangles();
+	}
+
+	// Initialize the asynchronous module
+	async::Module<GroundMotionWriterExecutor, GroundMotionInitParam, GroundMotionParam>::init();
+
+	unsigned* cells;
+	double* vertices;
+	unsigned nCells;
+	unsigned nVertices;
+	FreeSurfaceWriter::constructSurfaceMesh(meshReader, *freeSurfaceIntegrator, cells, vertices, nCells, nVertices);
+	assert(nCells == offset);
+
+	AsyncCellIDs<3> cellIds(nCells, nVertices, cells);
+
+	std::vector<std::string> const names = m_groundMotion.variableNames();
+	std::string variableNames;
+	for (unsigned i = 0; i < names.size(); i++) {
+		variableNames += names[i];
+		variableNames.push_back('\0');
+	}
+
+	// Create buffer for output prefix
+	unsigned int bufferId = addSyncBuffer(outputPrefix, strlen(outputPrefix)+1, true);
+	assert(bufferId == GroundMotionWriterExecutor::OUTPUT_PREFIX); NDBG_UNUSED(bufferId);
+
+	// Create mesh buffers
+	bufferId = addSyncBuffer(cellIds.cells(), nCells * 3 * sizeof(unsigned));
+	assert(bufferId == GroundMotionWriterExecutor::CELLS);
+	bufferId = addSyncBuffer(vertices, nVertices * 3 * sizeof(double));
+	assert(bufferId == GroundMotionWriterExecutor::VERTICES);
+	bufferId = addSyncBuffer(variableNames.data(), variableNames.size());
+	assert(bufferId == GroundMotionWriterExecutor::VARIABLE_NAMES);
+
+	m_variables.resize(names.size());
+	for (unsigned int i = 0; i < names.size(); i++) {
+		m_variables[i] = new double[nCells];
+		addBuffer(m_variables[i], nCells * sizeof(double));
+	}
+
+	//
+	// Send all buffers for initialization
+	//
+	sendBuffer(GroundMotionWriterExecutor::OUTPUT_PREFIX);
+
+	sendBuffer(GroundMotionWriterExecutor::CELLS);
+	sendBuffer(GroundMotionWriterExecutor::VERTICES);
+	sendBuffer(GroundMotionWriterExecutor::VARIABLE_NAMES);
+
+	// Initialize the executor
+	GroundMotionInitParam param;
+	param.numVariables = names.size();
+	param.backend = backend;
+	callInit(param);
+
+	// Remove unused buffers
+	removeBuffer(GroundMotionWriterExecutor::OUTPUT_PREFIX);
+	removeBuffer(GroundMotionWriterExecutor::CELLS);
+	removeBuffer(GroundMotionWriterExecutor::VERTICES);
+	removeBuffer(GroundMotionWriterExecutor::VARIABLE_NAMES);
+
+	// The summary is written with the checkpoints (if enabled) and at the end of the simulation
+	Modules::registerHook(*this, SYNCHRONIZATION_POINT);
+	setSyncInterval(seissol::SeisSol::main.simulator().checkPointInterval());
+
+	delete[] cells;
+	delete[] vertices;
+}
+
+void seissol::writer::GroundMotionWriter::write(double time)
+{
+	SCOREP_USER_REGION("GroundMotionWriter_write", SCOREP_USER_REGION_TYPE_FUNCTION)
+
+	if (!m_enabled)
+		logError() << "Trying to write ground motion output, but it is disabled.";
+
+	m_stopwatch.start();
+
+	int const rank = seissol::MPI::mpi.rank();
+
+	wait();
+
+	logInfo(rank) << "Writing ground motion at time" << utils::nospace << time << ".";
+
+	std::vector<double*> variables(m_variables.size());
+	for (unsigned int cluster = 0; cluster < m_clusters.size(); cluster++) {
+		for (unsigned int i = 0; i < m_variables.size(); i++)
+			variables[i] = m_variables[i] + m_clusterOffsets[cluster];
+		m_clusters[cluster].output(variables.data());
+	}
+
+	for (unsigned int i = 0; i < m_variables.size(); i++)
+		sendBuffer(GroundMotionWriterExecutor::VARIABLES0 + i);
+
+	GroundMotionParam param;
+	param.time = time;
+	call(param);
+
+	m_stopwatch.pause();
+
+	logInfo(rank) << "Writing ground motion at time" << utils::nospace << time << ". Done.";
+}
+
+void seissol::writer::GroundMotionWriter::syncPoint(double currentTime)
+{
+	SCOREP_USER_REGION("groundmotionoutput", SCOREP_USER_REGION_TYPE_FUNCTION)
+
+	write(currentTime);
+}
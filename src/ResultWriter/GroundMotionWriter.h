@@ -0,0 +1,166 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Output of the in-situ ground motion summary of the free surface
+ **/
+
+#ifndef GROUNDMOTIONWRITER_H
+#define GROUNDMOTIONWRITER_H
+
+#include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
+
+#include <vector>
+
+#include <Geometry/MeshReader.h>
+#include <utils/logger.h>
+#include <async/Module.h>
+#include <Modules/Module.h>
+#include <Solver/FreeSurfaceIntegrator.h>
+#include <Solver/GroundMotion.h>
+#include <Solver/GroundMotionCluster.h>
+#include "Monitoring/Stopwatch.h"
+#include "GroundMotionWriterExecutor.h"
+
+namespace seissol
+{
+namespace writer
+{
+
+/**
+ * Writes the in-situ ground motion summary (peak values and response spectra)
+ * of the free surface at the checkpoints and at the end of the simulation.
+ */
+class GroundMotionWriter : private async::Module<GroundMotionWriterExecutor, GroundMotionInitParam, GroundMotionParam>, public seissol::Module
+{
+private:
+	/** Is enabled? */
+	bool m_enabled;
+
+	/** Peak values and oscillator configuration */
+	seissol::solver::GroundMotion m_groundMotion;
+
+	/** The summary of each time cluster */
+	std::vector<seissol::solver::GroundMotionCluster> m_clusters;
+
+	/** First triangle of each cluster in the output */
+	std::vector<unsigned> m_clusterOffsets;
+
+	/** Output variables [variable][triangle] */
+	std::vector<double*> m_variables;
+
+	/** The asynchronous executor */
+	GroundMotionWriterExecutor m_executor;
+
+	/** Frontend stopwatch */
+	Stopwatch m_stopwatch;
+
+public:
+	GroundMotionWriter() : m_enabled(false) {}
+
+	~GroundMotionWriter()
+	{
+		for (unsigned i = 0; i < m_variables.size(); i++)
+			delete [] m_variables[i];
+	}
+
+	/**
+	 * Called by ASYNC on all ranks
+	 */
+	void setUp()
+	{
+		setExecutor(m_executor);
+		if (isAffinityNecessary()) {
+		  const auto freeCpus = parallel::getFreeCPUsMask();
+		  logInfo(seissol::MPI::mpi.rank()) << "Ground motion writer thread affinity:" << parallel::maskToString(parallel::getFreeCPUsMask());
+		  if (parallel::freeCPUsMaskEmpty(freeCpus)) {
+		    logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+		  }
+		  setAffinityIfNecessary(freeCpus);
+		}
+	}
+
+	/**
+	 * @param periods Periods of the response spectrum
+	 * @param damping Damping ratio of the oscillators
+	 */
+	void enable(std::vector<double> const& periods, double damping);
+
+	void init(  MeshReader const&                       meshReader,
+	            seissol::solver::FreeSurfaceIntegrator* freeSurfaceIntegrator,
+	            char const*                             outputPrefix,
+	            xdmfwriter::BackendType                 backend );
+
+	/**
+	 * @return The summary of a time cluster or NULL if the output is disabled
+	 */
+	seissol::solver::GroundMotionCluster* groundMotionCluster(unsigned cluster)
+	{
+		if (cluster < m_clusters.size())
+			return &m_clusters[cluster];
+		return 0L;
+	}
+
+	void write(double time);
+
+	void close()
+	{
+		if (m_enabled)
+			wait();
+
+		finalize();
+
+		if (!m_enabled)
+			return;
+
+		m_stopwatch.printTime("Time ground motion writer frontend:");
+	}
+
+	void tearDown()
+	{
+		m_executor.finalize();
+	}
+
+	//
+	// Hooks
+	//
+	void syncPoint(double currentTime);
+};
+
+}
+
+}
+
+#endif // GROUNDMOTIONWRITER_H
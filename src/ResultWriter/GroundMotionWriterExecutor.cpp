@@ -0,0 +1,97 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous backend of the ground motion output
+ **/
+
+#include "Parallel/MPI.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "utils/logger.h"
+#include "GroundMotionWriterExecutor.h"
+
+/**
+ * Initialize the XDMF writers
+ */
+void seissol::writer::GroundMotionWriterExecutor::execInit(const async::ExecInfo &info, const seissol::writer::GroundMotionInitParam &param)
+{
+	if (m_xdmfWriter) {
+		logError() << "Ground motion writer already initialized.";
+	}
+
+	unsigned int nCells = info.bufferSize(CELLS) / (3 * sizeof(int));
+	unsigned int nVertices = info.bufferSize(VERTICES) / (3 * sizeof(double));
+
+#ifdef USE_MPI
+	MPI_Comm_split(seissol::MPI::mpi.comm(), (nCells > 0 ? 0 : MPI_UNDEFINED), 0, &m_comm);
+#endif // USE_MPI
+
+	if (nCells > 0) {
+		int rank = 0;
+#ifdef USE_MPI
+		MPI_Comm_rank(m_comm, &rank);
+#endif // USE_MPI
+
+		std::string outputName(static_cast<const char*>(info.buffer(OUTPUT_PREFIX)));
+		outputName += "-surface-groundmotion";
+
+		// The names are separated by '\0'
+		m_numVariables = param.numVariables;
+		const char* name = static_cast<const char*>(info.buffer(VARIABLE_NAMES));
+		for (unsigned int i = 0; i < m_numVariables; i++) {
+			m_variableNames.push_back(name);
+			name += strlen(name) + 1;
+		}
+		std::vector<const char*> variables;
+		for (unsigned int i = 0; i < m_numVariables; i++) {
+			variables.push_back(m_variableNames[i].c_str());
+		}
+
+		// The summary is not part of the checkpoint, always start a new file
+		m_xdmfWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double>(param.backend, outputName.c_str(), 0);
+
+#ifdef USE_MPI
+		m_xdmfWriter->setComm(m_comm);
+#endif // USE_MPI
+
+		m_xdmfWriter->init(variables, std::vector<const char*>());
+		m_xdmfWriter->setMesh(nCells, static_cast<const unsigned int*>(info.buffer(CELLS)), nVertices, static_cast<const double*>(info.buffer(VERTICES)), false);
+
+		logInfo(rank) << "Initializing ground motion output. Done.";
+	}
+}
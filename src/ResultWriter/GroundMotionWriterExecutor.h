@@ -0,0 +1,150 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous backend of the ground motion output
+ **/
+
+#ifndef GROUNDMOTIONWRITEREXECUTOR_H
+#define GROUNDMOTIONWRITEREXECUTOR_H
+
+#include <string>
+#include <vector>
+
+#include "xdmfwriter/XdmfWriter.h"
+#include "async/ExecInfo.h"
+
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol
+{
+namespace writer
+{
+struct GroundMotionInitParam
+{
+	unsigned int numVariables;
+	xdmfwriter::BackendType backend;
+};
+
+struct GroundMotionParam
+{
+	double time;
+};
+
+class GroundMotionWriterExecutor
+{
+public:
+	enum BufferIds {
+		OUTPUT_PREFIX = 0,
+		CELLS = 1,
+		VERTICES = 2,
+		VARIABLE_NAMES = 3,
+		VARIABLES0 = 4
+	};
+
+private:
+#ifdef USE_MPI
+	/** The MPI communicator for the writer */
+	MPI_Comm m_comm;
+#endif // USE_MPI
+
+	xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double>* m_xdmfWriter;
+	unsigned m_numVariables;
+
+	/** Variable names in the output (the name buffer is removed after the initialization) */
+	std::vector<std::string> m_variableNames;
+
+	/** Backend stopwatch */
+	Stopwatch m_stopwatch;
+
+public:
+	GroundMotionWriterExecutor()
+		:
+#ifdef USE_MPI
+		m_comm(MPI_COMM_NULL),
+#endif // USE_MPI
+		m_xdmfWriter(0L),
+		m_numVariables(0) {}
+
+	/**
+	 * Initialize the XDMF writer
+	 */
+	void execInit(const async::ExecInfo &info, const GroundMotionInitParam &param);
+
+	void exec(const async::ExecInfo &info, const GroundMotionParam &param)
+	{
+		if (!m_xdmfWriter) {
+			return;
+		}
+
+		m_stopwatch.start();
+
+		m_xdmfWriter->addTimeStep(param.time);
+
+		for (unsigned int i = 0; i < m_numVariables; i++) {
+			m_xdmfWriter->writeCellData(i, static_cast<const double*>(info.buffer(VARIABLES0 + i)));
+		}
+
+		m_xdmfWriter->flush();
+
+		m_stopwatch.pause();
+	}
+
+	void finalize()
+	{
+		if (m_xdmfWriter) {
+			m_stopwatch.printTime("Time ground motion writer backend:"
+#ifdef USE_MPI
+				, m_comm
+#endif // USE_MPI
+			);
+		}
+
+#ifdef USE_MPI
+		if (m_comm != MPI_COMM_NULL) {
+			MPI_Comm_free(&m_comm);
+			m_comm = MPI_COMM_NULL;
+		}
+#endif // USE_MPI
+
+		delete m_xdmfWriter;
+		m_xdmfWriter = 0L;
+	}
+};
+
+}
+
+}
+
+#endif // GROUNDMOTIONWRITEREXECUTOR_H
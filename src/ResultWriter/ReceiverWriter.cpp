@@ -39,12 +39,17 @@
 
 #include "ReceiverWriter.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <sstream>
 #include <iomanip>
 #include <fstream>
 #include <sys/stat.h>
 #include <Parallel/MPI.h>
 #include <Modules/Modules.h>
+#include <utils/env.h>
+#include <utils/stringutils.h>
 
 std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   std::stringstream fns;
@@ -56,12 +61,29 @@ std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   return fns.str();
 }
 
+std::string seissol::writer::ReceiverWriter::variables() const {
+  std::vector<std::string> names({"xx", "yy", "zz", "xy", "yz", "xz", "u", "v", "w"});
+
+  std::stringstream vars;
+  vars << "VARIABLES = \"Time\"";
+#ifdef MULTIPLE_SIMULATIONS
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto const& name : names) {
+      vars << ",\"" << name << sim << "\"";
+    }
+  }
+#else
+  for (auto const& name : names) {
+    vars << ",\"" << name << "\"";
+  }
+#endif
+  return vars.str();
+}
+
 void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
                                                    Eigen::Vector3d const& point   ) {
   auto name = fileName(pointId);
 
-  std::vector<std::string> names({"xx", "yy", "zz", "xy", "yz", "xz", "u", "v", "w"});
-
   /// \todo Find a nicer solution that is not so hard-coded.
   struct stat fileStat;
   // Write header if file does not exist
@@ -69,19 +91,7 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
     std::ofstream file;
     file.open(name);
     file << "TITLE = \"Temporal Signal for receiver number " << std::setfill('0') << std::setw(5) << (pointId+1) << "\"" << std::endl;
-    file << "VARIABLES = \"Time\"";
-#ifdef MULTIPLE_SIMULATIONS
-    for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-      for (auto const& name : names) {
-        file << ",\"" << name << sim << "\"";
-      }
-    }
-#else
-    for (auto const& name : names) {
-      file << ",\"" << name << "\"";
-    }
-#endif
-    file << std::endl;
+    file << variables() << std::endl;
     for (int d = 0; d < 3; ++d) {
       file << "# x" << (d+1) << "       " << std::scientific << std::setprecision(12) << point[d] << std::endl;
     }
@@ -89,14 +99,28 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
   }
 }
 
-void seissol::writer::ReceiverWriter::syncPoint(double)
+void seissol::writer::ReceiverWriter::syncPoint(double currentTime)
 {
+  if (m_binary) {
+    writeBinary(currentTime);
+    return;
+  }
+
   if (m_receiverClusters.empty()) {
     return;
   }
 
   m_stopwatch.start();
 
+  writeAscii();
+
+  auto time = m_stopwatch.stop();
+  int const rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Wrote receivers in" << time << "seconds.";
+}
+
+void seissol::writer::ReceiverWriter::writeAscii()
+{
   for (auto& cluster : m_receiverClusters) {
     auto ncols = cluster.ncols();
     for (auto& receiver : cluster) {
@@ -116,17 +140,147 @@ void seissol::writer::ReceiverWriter::syncPoint(double)
       receiver.output.clear();
     }
   }
+}
 
-  auto time = m_stopwatch.stop();
-  int const rank = seissol::MPI::mpi.rank();
-  logInfo(rank) << "Wrote receivers in" << time << "seconds.";
+void seissol::writer::ReceiverWriter::initBinary(std::vector<Eigen::Vector3d> const& points)
+{
+  // Initialize the asynchronous module
+  async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>::init();
+
+  std::vector<ReceiverInfo> receivers;
+  size_t ncols = 0;
+  for (auto& cluster : m_receiverClusters) {
+    ncols = cluster.ncols();
+    for (auto& receiver : cluster) {
+      ReceiverInfo info;
+      info.pointId = receiver.pointId;
+#ifdef PARALLEL
+      info.rank = seissol::MPI::mpi.rank();
+#else
+      info.rank = -1;
+#endif
+      for (int d = 0; d < 3; ++d) {
+        info.coordinates[d] = points[receiver.pointId][d];
+      }
+      receivers.push_back(info);
+    }
+  }
+  // Every rank requires the same layout, even if it has no receivers
+  ncols = m_receiverClusters.empty() ? 0 : ncols;
+#ifdef USE_MPI
+  unsigned long localCols = ncols;
+  unsigned long globalCols = 0;
+  MPI_Allreduce(&localCols, &globalCols, 1, MPI_UNSIGNED_LONG, MPI_MAX, seissol::MPI::mpi.comm());
+  ncols = globalCols;
+#endif // USE_MPI
+
+  // Samples of one synchronization interval, larger intervals are written in several blocks
+  m_maxSamples = static_cast<size_t>(std::ceil(syncInterval() / m_samplingInterval)) + 1;
+
+  const std::string outputPrefix = m_fileNamePrefix;
+  const std::string vars = variables();
+
+  unsigned int bufferId = addSyncBuffer(outputPrefix.c_str(), outputPrefix.size()+1, true);
+  assert(bufferId == ReceiverWriterExecutor::OUTPUT_PREFIX); NDBG_UNUSED(bufferId);
+  bufferId = addSyncBuffer(vars.c_str(), vars.size(), true);
+  assert(bufferId == ReceiverWriterExecutor::VARIABLES);
+  bufferId = addSyncBuffer(receivers.data(), receivers.size() * sizeof(ReceiverInfo));
+  assert(bufferId == ReceiverWriterExecutor::RECEIVERS);
+  bufferId = addBuffer(0L, receivers.size() * sizeof(std::uint64_t));
+  assert(bufferId == ReceiverWriterExecutor::SAMPLES);
+  bufferId = addBuffer(0L, receivers.size() * m_maxSamples * ncols * sizeof(double));
+  assert(bufferId == ReceiverWriterExecutor::DATA);
+
+  sendBuffer(ReceiverWriterExecutor::OUTPUT_PREFIX);
+  sendBuffer(ReceiverWriterExecutor::VARIABLES);
+  sendBuffer(ReceiverWriterExecutor::RECEIVERS);
+
+  ReceiverInitParam param;
+  param.ncols = ncols;
+  param.maxSamples = m_maxSamples;
+  callInit(param);
+
+  removeBuffer(ReceiverWriterExecutor::OUTPUT_PREFIX);
+  removeBuffer(ReceiverWriterExecutor::VARIABLES);
+  removeBuffer(ReceiverWriterExecutor::RECEIVERS);
+}
+
+void seissol::writer::ReceiverWriter::writeBinary(double time)
+{
+  SCOREP_USER_REGION("ReceiverWriter_writeBinary", SCOREP_USER_REGION_TYPE_FUNCTION)
+
+  m_stopwatch.start();
+
+  typedef async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam> AsyncModule;
+
+  // All ranks have to participate in the same number of blocks
+  size_t localSamples = 0;
+  for (auto& cluster : m_receiverClusters) {
+    for (auto& receiver : cluster) {
+      localSamples = std::max(localSamples, receiver.output.size() / cluster.ncols());
+    }
+  }
+  unsigned long numberOfSamples = localSamples;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfSamples, 1, MPI_UNSIGNED_LONG, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  const size_t numberOfBlocks = std::max<size_t>(1, (numberOfSamples + m_maxSamples - 1) / m_maxSamples);
+
+  for (size_t block = 0; block < numberOfBlocks; ++block) {
+    // The buffers may still be in use by the last write
+    wait();
+
+    std::uint64_t* samples = AsyncModule::managedBuffer<std::uint64_t*>(ReceiverWriterExecutor::SAMPLES);
+    double* data = AsyncModule::managedBuffer<double*>(ReceiverWriterExecutor::DATA);
+
+    const size_t firstSample = block * m_maxSamples;
+    size_t r = 0;
+    for (auto& cluster : m_receiverClusters) {
+      const size_t ncols = cluster.ncols();
+      for (auto& receiver : cluster) {
+        const size_t nSamples = receiver.output.size() / ncols;
+        // Receivers may have fewer samples than the others
+        const size_t start = std::min(firstSample, nSamples);
+        const size_t blockSamples = std::min(m_maxSamples, nSamples - start);
+        samples[r] = blockSamples;
+        std::copy(receiver.output.begin() + start * ncols,
+                  receiver.output.begin() + (start + blockSamples) * ncols,
+                  data + r * m_maxSamples * ncols);
+        ++r;
+      }
+    }
+
+    sendBuffer(ReceiverWriterExecutor::SAMPLES);
+    sendBuffer(ReceiverWriterExecutor::DATA);
+
+    ReceiverParam param;
+    param.time = time;
+    call(param);
+  }
+
+  for (auto& cluster : m_receiverClusters) {
+    for (auto& receiver : cluster) {
+      receiver.output.clear();
+    }
+  }
+
+  m_stopwatch.pause();
 }
+
 void seissol::writer::ReceiverWriter::init( std::string const&  fileNamePrefix,
                                             double              samplingInterval,
                                             double              syncPointInterval)
 {
   m_fileNamePrefix = fileNamePrefix;
   m_samplingInterval = samplingInterval;
+
+  std::string backend = utils::Env::get<const char*>("SEISSOL_RECEIVER_OUTPUT", "ascii");
+  utils::StringUtils::toLower(backend);
+  if (backend == "binary") {
+    m_binary = true;
+  } else if (backend != "ascii") {
+    logError() << "Unknown receiver output" << backend;
+  }
   setSyncInterval(syncPointInterval);
   Modules::registerHook(*this, SYNCHRONIZATION_POINT);
 }
@@ -161,8 +315,14 @@ void seissol::writer::ReceiverWriter::addPoints(  std::vector<Eigen::Vector3d> c
         m_receiverClusters.emplace_back(global, quantities, m_samplingInterval, syncInterval());
       }
 
-      writeHeader(point, points[point]);
+      if (!m_binary) {
+        writeHeader(point, points[point]);
+      }
       m_receiverClusters[cluster].addReceiver(meshId, point, points[point], mesh, ltsLut, lts);
     }
   }
+
+  if (m_binary) {
+    initBinary(points);
+  }
 }
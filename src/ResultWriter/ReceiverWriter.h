@@ -42,19 +42,41 @@
 
 #include <vector>
 #include <Eigen/Dense>
+#include <async/Module.h>
+#include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
+#include <utils/logger.h>
 #include <Geometry/MeshReader.h>
 #include <Initializer/tree/Lut.hpp>
 #include <Initializer/LTS.h>
 #include <Kernels/Receiver.h>
 #include <Modules/Module.h>
 #include <Monitoring/Stopwatch.h>
+#include "ReceiverWriterExecutor.h"
 
 class LocalIntegrationData;
 class GlobalData;
 namespace seissol {
   namespace writer {
-    class ReceiverWriter : public seissol::Module {
+    class ReceiverWriter : private async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>, public seissol::Module {
     public:
+      ReceiverWriter() : m_binary(false), m_maxSamples(0) {}
+
+      /**
+       * Called by ASYNC on all ranks
+       */
+      void setUp() {
+        setExecutor(m_executor);
+        if (isAffinityNecessary()) {
+          const auto freeCpus = parallel::getFreeCPUsMask();
+          logInfo(seissol::MPI::mpi.rank()) << "Receiver writer thread affinity:" << parallel::maskToString(freeCpus);
+          if (parallel::freeCPUsMaskEmpty(freeCpus)) {
+            logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+          }
+          setAffinityIfNecessary(freeCpus);
+        }
+      }
+
       void init(  std::string const&  fileNamePrefix,
                   double              samplingInterval,
                   double              syncPointInterval);
@@ -71,6 +93,22 @@ namespace seissol {
         }
         return nullptr;
       }
+      void close() {
+        if (m_binary) {
+          wait();
+        }
+
+        finalize();
+
+        if (m_binary) {
+          m_stopwatch.printTime("Time receiver writer frontend:");
+        }
+      }
+
+      void tearDown() {
+        m_executor.finalize();
+      }
+
       //
       // Hooks
       //
@@ -78,12 +116,31 @@ namespace seissol {
 
     private:
       std::string fileName(unsigned pointId) const;
+      std::string variables() const;
       void writeHeader(unsigned pointId, Eigen::Vector3d const& point);
 
+      /** Initializes the asynchronous binary output */
+      void initBinary(std::vector<Eigen::Vector3d> const& points);
+
+      /** Copies the samples into the buffers and hands them to the executor */
+      void writeBinary(double time);
+
+      /** Writes the samples into one ASCII file per receiver */
+      void writeAscii();
+
       std::string m_fileNamePrefix;
       double      m_samplingInterval;
       std::vector<kernels::ReceiverCluster> m_receiverClusters;
       Stopwatch   m_stopwatch;
+
+      /** Use the binary output (SEISSOL_RECEIVER_OUTPUT=binary) */
+      bool        m_binary;
+
+      /** Maximum number of samples per receiver in one binary block */
+      size_t      m_maxSamples;
+
+      /** The asynchronous executor */
+      ReceiverWriterExecutor m_executor;
     };
   }
 }
@@ -0,0 +1,117 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Binary backend of the receiver output.
+ **/
+
+#include "Parallel/MPI.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+
+#include "utils/logger.h"
+#include "ReceiverWriterExecutor.h"
+
+const char seissol::writer::ReceiverWriterExecutor::MAGIC[9] = "SSRECV01";
+
+void seissol::writer::ReceiverWriterExecutor::execInit(const async::ExecInfo &info, const seissol::writer::ReceiverInitParam &param)
+{
+	if (m_file.is_open()) {
+		logError() << "Receiver writer already initialized.";
+	}
+
+	m_numberOfReceivers = info.bufferSize(RECEIVERS) / sizeof(ReceiverInfo);
+	m_ncols = param.ncols;
+	m_maxSamples = param.maxSamples;
+
+	int rank = 0;
+#ifdef USE_MPI
+	rank = seissol::MPI::mpi.rank();
+	MPI_Comm_split(seissol::MPI::mpi.comm(), (m_numberOfReceivers > 0 ? 0 : MPI_UNDEFINED), 0, &m_comm);
+#endif // USE_MPI
+
+	if (m_numberOfReceivers == 0) {
+		return;
+	}
+
+	std::stringstream fns;
+	fns << static_cast<const char*>(info.buffer(OUTPUT_PREFIX)) << "-receivers-"
+		<< std::setfill('0') << std::setw(5) << rank << ".bin";
+	const std::string name = fns.str();
+
+	// Append to existing files (restart), as the ASCII output does
+	struct stat fileStat;
+	const bool exists = (stat(name.c_str(), &fileStat) == 0);
+
+	m_file.open(name, std::ios::binary | std::ios::app);
+	if (!m_file) {
+		logError() << "Could not open receiver file" << name;
+	}
+
+	if (!exists) {
+		const std::uint64_t variablesLength = info.bufferSize(VARIABLES);
+		m_file.write(MAGIC, 8);
+		m_file.write(reinterpret_cast<const char*>(&m_numberOfReceivers), sizeof(std::uint64_t));
+		m_file.write(reinterpret_cast<const char*>(&m_ncols), sizeof(std::uint64_t));
+		m_file.write(reinterpret_cast<const char*>(&variablesLength), sizeof(std::uint64_t));
+		m_file.write(static_cast<const char*>(info.buffer(VARIABLES)), variablesLength);
+		m_file.write(static_cast<const char*>(info.buffer(RECEIVERS)), info.bufferSize(RECEIVERS));
+		m_file.flush();
+	}
+}
+
+void seissol::writer::ReceiverWriterExecutor::exec(const async::ExecInfo &info, const seissol::writer::ReceiverParam &param)
+{
+	if (!m_file.is_open()) {
+		return;
+	}
+
+	m_stopwatch.start();
+
+	const std::uint64_t* samples = static_cast<const std::uint64_t*>(info.buffer(SAMPLES));
+	const double* data = static_cast<const double*>(info.buffer(DATA));
+
+	m_file.write(reinterpret_cast<const char*>(&param.time), sizeof(double));
+	m_file.write(reinterpret_cast<const char*>(samples), m_numberOfReceivers * sizeof(std::uint64_t));
+	for (std::uint64_t receiver = 0; receiver < m_numberOfReceivers; ++receiver) {
+		m_file.write(reinterpret_cast<const char*>(data + receiver * m_maxSamples * m_ncols),
+			samples[receiver] * m_ncols * sizeof(double));
+	}
+	m_file.flush();
+
+	m_stopwatch.pause();
+}
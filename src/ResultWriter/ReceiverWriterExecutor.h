@@ -0,0 +1,168 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Binary backend of the receiver output.
+ **/
+
+#ifndef RECEIVERWRITEREXECUTOR_H
+#define RECEIVERWRITEREXECUTOR_H
+
+#include "Parallel/MPI.h"
+
+#include <cstdint>
+#include <fstream>
+
+#include "async/ExecInfo.h"
+
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol
+{
+namespace writer
+{
+struct ReceiverInitParam
+{
+	/** Number of columns (time + quantities) of a sample */
+	std::uint64_t ncols;
+
+	/** Maximum number of samples of a receiver in one block */
+	std::uint64_t maxSamples;
+};
+
+struct ReceiverParam
+{
+	double time;
+};
+
+/**
+ * Description of a receiver in the binary output
+ */
+struct ReceiverInfo
+{
+	/** Global receiver id (0-based) */
+	std::uint64_t pointId;
+
+	/** Rank that computed the receiver, -1 for non-parallel runs */
+	std::int64_t rank;
+
+	double coordinates[3];
+};
+
+/**
+ * Writes all receivers of a rank into one binary file.
+ *
+ * Layout of the file:
+ *  - "SSRECV01", number of receivers, number of columns, length and content of the variable list
+ *  - ReceiverInfo of all receivers
+ *  - one block per synchronization point: time, number of samples per receiver and
+ *    the samples in [receiver][time][column] order.
+ *
+ * The legacy ASCII files can be recreated with postprocessing/visualization/tools/receiverBinaryToDat.py
+ */
+class ReceiverWriterExecutor
+{
+public:
+	enum BufferIds {
+		OUTPUT_PREFIX = 0,
+		VARIABLES = 1,
+		RECEIVERS = 2,
+		SAMPLES = 3,
+		DATA = 4
+	};
+
+	static const char MAGIC[9];
+
+private:
+#ifdef USE_MPI
+	/** The MPI communicator for the writer */
+	MPI_Comm m_comm;
+#endif // USE_MPI
+
+	std::ofstream m_file;
+
+	std::uint64_t m_numberOfReceivers;
+
+	std::uint64_t m_ncols;
+
+	std::uint64_t m_maxSamples;
+
+	/** Backend stopwatch */
+	Stopwatch m_stopwatch;
+
+public:
+	ReceiverWriterExecutor()
+		:
+#ifdef USE_MPI
+		m_comm(MPI_COMM_NULL),
+#endif // USE_MPI
+		m_numberOfReceivers(0),
+		m_ncols(0),
+		m_maxSamples(0) {}
+
+	/**
+	 * Opens the file and writes the header
+	 */
+	void execInit(const async::ExecInfo &info, const ReceiverInitParam &param);
+
+	/**
+	 * Appends the samples of one synchronization point
+	 */
+	void exec(const async::ExecInfo &info, const ReceiverParam &param);
+
+	void finalize()
+	{
+		if (m_file.is_open()) {
+			m_stopwatch.printTime("Time receiver writer backend:"
+#ifdef USE_MPI
+				, m_comm
+#endif // USE_MPI
+			);
+			m_file.close();
+		}
+
+#ifdef USE_MPI
+		if (m_comm != MPI_COMM_NULL) {
+			MPI_Comm_free(&m_comm);
+			m_comm = MPI_COMM_NULL;
+		}
+#endif // USE_MPI
+	}
+};
+
+}
+
+}
+
+#endif // RECEIVERWRITEREXECUTOR_H
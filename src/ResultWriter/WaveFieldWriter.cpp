@@ -47,6 +47,58 @@
 #include "Monitoring/instrumentation.fpp"
 #include <Modules/Modules.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+/**
+ * Replaces each value by the sum of all previous values
+ *
+ * @return The sum of all values
+ */
+static unsigned int exclusiveScan(std::vector<unsigned int> &values)
+{
+#ifdef _OPENMP
+	std::vector<unsigned int> blockSums(omp_get_max_threads() + 1, 0);
+
+	#pragma omp parallel
+	{
+		const size_t thread = omp_get_thread_num();
+		const size_t numThreads = omp_get_num_threads();
+		const size_t begin = values.size() * thread / numThreads;
+		const size_t end = values.size() * (thread + 1) / numThreads;
+
+		unsigned int sum = 0;
+		for (size_t i = begin; i < end; i++)
+			sum += values[i];
+		blockSums[thread + 1] = sum;
+
+		#pragma omp barrier
+		#pragma omp single
+		for (size_t i = 1; i < blockSums.size(); i++)
+			blockSums[i] += blockSums[i - 1];
+
+		unsigned int offset = blockSums[thread];
+		for (size_t i = begin; i < end; i++) {
+			const unsigned int value = values[i];
+			values[i] = offset;
+			offset += value;
+		}
+	}
+
+	return blockSums.back();
+#else // _OPENMP
+	unsigned int offset = 0;
+	for (size_t i = 0; i < values.size(); i++) {
+		const unsigned int value = values[i];
+		values[i] = offset;
+		offset += value;
+	}
+
+	return offset;
+#endif // _OPENMP
+}
+
 void seissol::writer::WaveFieldWriter::enable()
 {
 	m_enabled = true;
@@ -160,8 +212,9 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 	std::vector<const Element*> subElements;
 	// The oldToNewVertexMap defines a map between old vertex index to
 	// new vertex index. This is used to assign the vertex subset as well as
-	// used in MeshRefiner since the elements would hold old index of vertices
-	std::map<int, int> oldToNewVertexMap;
+	// used in MeshRefiner since the elements would hold old index of vertices.
+	// Only entries of vertices in the region are valid.
+	std::vector<unsigned int> oldToNewVertexMap;
 	// Vertices of the extracted region
 	std::vector<const Vertex*> subVertices;
 	// Mesh refiner
@@ -189,33 +242,44 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 		//    cell index to dof index
 		m_map = new unsigned int[numElems];
 
-		// Extract elements based on the region specified
+		// Mark the elements in the region and their vertices
+		std::vector<unsigned char> elementInRegion(numElems);
+		std::vector<unsigned char> vertexInRegion(numVerts, 0);
+		#pragma omp parallel for schedule(static)
 		for (size_t i = 0; i < numElems; i++) {
-			// Store the current number of elements to check if new was added
-			if (vertexInBox(outputRegionBounds, allVertices[allElements[i].vertices[0]].coords) ||
+			elementInRegion[i] = vertexInBox(outputRegionBounds, allVertices[allElements[i].vertices[0]].coords) ||
 				vertexInBox(outputRegionBounds, allVertices[allElements[i].vertices[1]].coords) ||
 				vertexInBox(outputRegionBounds, allVertices[allElements[i].vertices[2]].coords) ||
-				vertexInBox(outputRegionBounds, allVertices[allElements[i].vertices[3]].coords)) {
+				vertexInBox(outputRegionBounds, allVertices[allElements[i].vertices[3]].coords);
 
-				// Assign the new map
-				m_map[subElements.size()] = map[i];
+			if (elementInRegion[i]) {
+				for (unsigned int j = 0; j < 4; j++) {
+					#pragma omp atomic write
+					vertexInRegion[allElements[i].vertices[j]] = 1;
+				}
+			}
+		}
 
-				// Push the address of the element into the vector
-				subElements.push_back(&(allElements[i]));
+		// The new indices keep the order of the elements and vertices
+		std::vector<unsigned int> newElementIndex(elementInRegion.begin(), elementInRegion.end());
+		subElements.resize(exclusiveScan(newElementIndex));
+		oldToNewVertexMap.assign(vertexInRegion.begin(), vertexInRegion.end());
+		subVertices.resize(exclusiveScan(oldToNewVertexMap));
 
-				// Push the vertices into the map which makes sure that the entries are unique
-				oldToNewVertexMap.insert(std::pair<int,int>(allElements[i].vertices[0], oldToNewVertexMap.size()));
-				oldToNewVertexMap.insert(std::pair<int,int>(allElements[i].vertices[1], oldToNewVertexMap.size()));
-				oldToNewVertexMap.insert(std::pair<int,int>(allElements[i].vertices[2], oldToNewVertexMap.size()));
-				oldToNewVertexMap.insert(std::pair<int,int>(allElements[i].vertices[3], oldToNewVertexMap.size()));
+		#pragma omp parallel for schedule(static)
+		for (size_t i = 0; i < numElems; i++) {
+			if (elementInRegion[i]) {
+				// Assign the new map
+				m_map[newElementIndex[i]] = map[i];
+				subElements[newElementIndex[i]] = &allElements[i];
 			}
 		}
 
-		subVertices.resize(oldToNewVertexMap.size());
-
-		// Loop over the map and assign the vertices
-		for (std::map<int,int>::iterator it=oldToNewVertexMap.begin(); it!=oldToNewVertexMap.end(); ++it)
-			subVertices.at(it->second) = &allVertices[it->first];
+		#pragma omp parallel for schedule(static)
+		for (size_t i = 0; i < numVerts; i++) {
+			if (vertexInRegion[i])
+				subVertices[oldToNewVertexMap[i]] = &allVertices[i];
+		}
 
 		numElems = subElements.size();
 		numVerts = subVertices.size();
@@ -389,20 +453,23 @@ void seissol::writer::WaveFieldWriter::write(double time)
 
 	logInfo(rank) << "Writing wave field at time" << utils::nospace <<  time << '.';
 
+	// Subsample all variables at once, directly into the managed buffers
+	std::vector<double*> managedBuffers(m_numVariables, 0L);
 	unsigned int nextId = m_variableBufferIds[0];
 	for (unsigned int i = 0; i < m_numVariables; i++) {
 		if (!m_outputFlags[i])
 			continue;
 
-		double* managedBuffer = async::Module<WaveFieldWriterExecutor,
+		managedBuffers[i] = async::Module<WaveFieldWriterExecutor,
 				WaveFieldInitParam, WaveFieldParam>::managedBuffer<double*>(nextId);
-		m_variableSubsampler->get(m_dofs, m_map, i, managedBuffer);
-
-		sendBuffer(nextId, m_numCells*sizeof(double));
-
 		nextId++;
 	}
 
+	m_variableSubsampler->getAll(m_dofs, m_map, managedBuffers.data());
+
+	for (unsigned int id = m_variableBufferIds[0]; id < nextId; id++)
+		sendBuffer(id, m_numCells*sizeof(double));
+
 	// nextId is required in a manner similar to above for writing integrated variables
 	nextId = 0;
 	if (m_pstrain) {
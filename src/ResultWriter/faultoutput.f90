@@ -70,7 +70,6 @@ CONTAINS
 
       !-------------------------------------------------------------------------!
       USE JacobiNormal_mod
-      USE magnitude_output_mod
       !-------------------------------------------------------------------------!
       IMPLICIT NONE
       !-------------------------------------------------------------------------!
@@ -99,13 +98,6 @@ CONTAINS
       ! Note that this causes a dt timeshift in the DR output routines
       !
       !
-      IF (DISC%DynRup%energy_rate_output_on.EQ.1) THEN
-         IF ( MOD(DISC%iterationstep,DISC%DynRup%energy_rate_printtimeinterval).EQ.0 &
-         .OR. (DISC%EndTime-time).LE.(dt*1.005d0) ) THEN
-            CALL energy_rate_output(MaterialVal,time,DISC,MESH,MPI,IO)
-         ENDIF
-      ENDIF
-
 
       SELECT CASE(DISC%DynRup%OutputPointType)
        ! For historical reasons fault output DISC%DynRup%OutputPointType= 3 or 4 or 5
@@ -120,6 +112,10 @@ CONTAINS
          IF (.NOT. DISC%DynRup%DynRup_out_atPickpoint%DR_pick_output ) THEN
              RETURN
          ENDIF
+         ! Time based output is handled by the fault receiver writer
+         IF (DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval_sec.GT.0.0d0) THEN
+             RETURN
+         ENDIF
          !
          ! Check if output for this time step is desired
          ! (note that fault computation is always one behind due to MPI communication = -1!)
@@ -167,6 +163,9 @@ CONTAINS
          ! check time for fault receiver output
          IF (.NOT. DISC%DynRup%DynRup_out_atPickpoint%DR_pick_output ) THEN
              CONTINUE
+         ! time based output is handled by the fault receiver writer
+         ELSEIF (DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval_sec.GT.0.0d0) THEN
+             CONTINUE
          ELSEIF ( MOD(DISC%iterationstep-1,DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval).EQ.0 &
          .OR. (min(DISC%EndTime,dt*DISC%MaxIteration)-time).LE.(dt*1.005d0) ) THEN
             isOnPickpoint = .TRUE.
@@ -188,7 +187,8 @@ CONTAINS
 
          ! print always first timestep
          IF(DISC%iterationstep .EQ. 1) THEN
-           isOnPickpoint = .TRUE.
+           isOnPickpoint = DISC%DynRup%DynRup_out_atPickpoint%DR_pick_output .AND. &
+                           DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval_sec.LE.0.0d0
            isOnElementwise=.TRUE.
          ENDIF
          !
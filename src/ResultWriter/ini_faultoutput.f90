@@ -60,6 +60,7 @@ MODULE ini_faultoutput_mod
   PUBLIC  :: ini_fault_subsampled
   PUBLIC  :: ini_fault_receiver
   PUBLIC  :: ini_fault_xdmfwriter
+  PUBLIC  :: ini_fault_receiver_writer
   !---------------------------------------------------------------------------!
   INTERFACE ini_fault_receiver
      MODULE PROCEDURE ini_fault_receiver
@@ -74,6 +75,10 @@ MODULE ini_faultoutput_mod
   INTERFACE ini_fault_xdmfwriter
     MODULE PROCEDURE ini_fault_xdmfwriter
   END INTERFACE
+
+  INTERFACE ini_fault_receiver_writer
+    MODULE PROCEDURE ini_fault_receiver_writer
+  END INTERFACE
 CONTAINS
 
 
@@ -979,6 +984,32 @@ CONTAINS
         IO%xdmfWriterBackend)
 
   END SUBROUTINE
+
+  !> Time based output of the fault receivers (has to be called on all ranks)
+  SUBROUTINE ini_fault_receiver_writer(DISC,IO)
+   use FaultWriter
+  !-------------------------------------------------------------------------!
+  ! Argument list declaration
+  TYPE(tDiscretization)   :: DISC
+  TYPE(tInputOutput)      :: IO
+  !-------------------------------------------------------------------------!
+  INTEGER                 :: nPoints
+  !-------------------------------------------------------------------------!
+
+  nPoints = 0
+  IF (DISC%DynRup%DynRup_out_atPickpoint%DR_pick_output) THEN
+    nPoints = DISC%DynRup%DynRup_out_atPickpoint%nDR_pick
+  ENDIF
+  IF( .NOT.associated(DISC%DynRup%DynRup_out_atPickpoint%RecPoint) ) THEN
+    ALLOCATE(DISC%DynRup%DynRup_out_atPickpoint%RecPoint(0))
+  ENDIF
+   call initFaultReceiverOutput(DISC%DynRup%DynRup_out_atPickpoint%RecPoint, &
+        nPoints, &
+        DISC%DynRup%DynRup_out_atPickpoint%OutVal, &
+        IO%OutputFile, &
+        DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval_sec)
+
+  END SUBROUTINE
 !
 !> Subroutine initializing the fault output
 !<
@@ -107,6 +107,7 @@ CONTAINS
     CHARACTER(LEN=5)               :: cmyrank
     integer                     :: timestepWavefield
     integer                     :: mkdirRet
+    integer                     :: magnitudeMask
     !--------------------------------------------------------------------------
     INTENT(IN)                     :: programTitle                             !
     INTENT(INOUT)                  :: EQN,DISC,IO, OptionalFields, MESH        ! Some values are set in the TypesDef
@@ -143,6 +144,26 @@ CONTAINS
         call c_interoperability_enableFreeSurfaceOutput( maxRefinementDepth = io%SurfaceOutputRefinement )
     endif
 
+    if (io%SurfaceGroundMotion > 0) then
+        call c_interoperability_enableGroundMotionOutput( maxRefinementDepth = io%SurfaceOutputRefinement,          &
+                                                          periods            = pack(io%SurfaceGroundMotionPeriods,  &
+                                                                                    io%SurfaceGroundMotionPeriods > 0.0), &
+                                                          numberOfPeriods    = count(io%SurfaceGroundMotionPeriods > 0.0), &
+                                                          damping            = io%SurfaceGroundMotionDamping )
+    endif
+
+    ! The magnitude and the energy rate output of the fault are part of the energy output
+    magnitudeMask = 0
+    if (EQN%DR.EQ.1) then
+      if (DISC%DynRup%magnitude_output_on.EQ.1) magnitudeMask = 1
+      if (DISC%DynRup%magnitude_output_on.EQ.1 .OR. DISC%DynRup%energy_rate_output_on.EQ.1) io%energy_output_on = 1
+    endif
+
+    if (io%energy_output_on > 0) then
+        call c_interoperability_enableEnergyOutput( interval      = io%pickdt_energy, &
+                                                    magnitudeMask = magnitudeMask     )
+    endif
+
     do i = 1, EQN%nVar
         if ( io%OutputMask(3+i) ) then
             outputMaskInt(i) = 1
@@ -178,6 +199,13 @@ CONTAINS
      CALL ini_fault_xdmfwriter(DISC,IO)
     ENDIF
 
+    ! Initialize the time based fault receiver writer
+    IF(DISC%DynRup%OutputPointType.EQ.3.OR.DISC%DynRup%OutputPointType.EQ.5) THEN
+      IF(DISC%DynRup%DynRup_out_atPickpoint%printtimeinterval_sec.GT.0.0d0) THEN
+        CALL ini_fault_receiver_writer(DISC,IO)
+      ENDIF
+    ENDIF
+
     ! end epik/scorep function
     EPIK_FUNC_END()
     SCOREP_USER_FUNC_END()
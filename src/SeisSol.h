@@ -53,10 +53,13 @@
 #include "SourceTerm/Manager.h"
 #include "ResultWriter/PostProcessor.h"
 #include "ResultWriter/FreeSurfaceWriter.h"
+#include "ResultWriter/GroundMotionWriter.h"
+#include "ResultWriter/EnergyOutput.h"
 
 #include "ResultWriter/AsyncIO.h"
 #include "ResultWriter/WaveFieldWriter.h"
 #include "ResultWriter/FaultWriter.h"
+#include "ResultWriter/FaultReceiverWriter.h"
 
 #include "ResultWriter/AnalysisWriter.h"
 
@@ -108,6 +111,12 @@ private:
   /** Free surface writer module **/
   writer::FreeSurfaceWriter m_freeSurfaceWriter;
 
+  /** Ground motion writer module **/
+  writer::GroundMotionWriter m_groundMotionWriter;
+
+  /** Energy output module **/
+  writer::EnergyOutput m_energyOutput;
+
   /** Analysis writer module **/
   writer::AnalysisWriter m_analysisWriter;
 
@@ -117,6 +126,9 @@ private:
 
 	/** Fault output module */
 	writer::FaultWriter m_faultWriter;
+
+	/** Time based fault receiver output module */
+	writer::FaultReceiverWriter m_faultReceiverWriter;
     
   //! Receiver writer module
   writer::ReceiverWriter m_receiverWriter;
@@ -187,6 +199,16 @@ public:
 		return m_freeSurfaceWriter;
 	}
 
+	writer::GroundMotionWriter& groundMotionWriter()
+	{
+		return m_groundMotionWriter;
+	}
+
+	writer::EnergyOutput& energyOutput()
+	{
+		return m_energyOutput;
+	}
+
 	writer::AnalysisWriter& analysisWriter()
 	{
 		return m_analysisWriter;
@@ -220,6 +242,14 @@ public:
 		return m_faultWriter;
 	}
 
+	/**
+	 * Get the fault receiver writer module
+	 */
+	writer::FaultReceiverWriter& faultReceiverWriter()
+	{
+		return m_faultReceiverWriter;
+	}
+
 	/**
 	 * Get the receiver writer module
 	 */
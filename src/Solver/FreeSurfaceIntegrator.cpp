@@ -53,10 +53,10 @@
 void seissol::solver::FreeSurfaceIntegrator::SurfaceLTS::addTo(seissol::initializers::LTSTree& surfaceLtsTree)
 {
   seissol::initializers::LayerMask ghostMask(Ghost);
-  surfaceLtsTree.addVar(             dofs, ghostMask,                 1,      seissol::memory::Standard );
-  surfaceLtsTree.addVar( displacementDofs, ghostMask,                 1,      seissol::memory::Standard );
-  surfaceLtsTree.addVar(             side, ghostMask,                 1,      seissol::memory::Standard );
-  surfaceLtsTree.addVar(           meshId, ghostMask,                 1,      seissol::memory::Standard );
+  surfaceLtsTree.addVar(             dofs, ghostMask,                 1,      seissol::memory::Standard, "dofs" );
+  surfaceLtsTree.addVar( displacementDofs, ghostMask,                 1,      seissol::memory::Standard, "displacementDofs" );
+  surfaceLtsTree.addVar(             side, ghostMask,                 1,      seissol::memory::Standard, "side" );
+  surfaceLtsTree.addVar(           meshId, ghostMask,                 1,      seissol::memory::Standard, "meshId" );
 }
 
 seissol::solver::FreeSurfaceIntegrator::FreeSurfaceIntegrator()
@@ -119,40 +119,55 @@ void seissol::solver::FreeSurfaceIntegrator::calculateOutput()
     #pragma omp parallel for schedule(static)
 #endif // _OPENMP
     for (unsigned face = 0; face < surfaceLayer->getNumberOfCells(); ++face) {
-      real subTriangleDofs[tensor::subTriangleDofs::size(FREESURFACE_MAX_REFINEMENT)] __attribute__((aligned(ALIGNMENT)));
-
-      kernel::subTriangleVelocity vkrnl;
-      vkrnl.Q = dofs[face];
-      vkrnl.selectVelocity = init::selectVelocity::Values;
-      vkrnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[ side[face] ];
-      vkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
-      vkrnl.execute(triRefiner.maxDepth);
-
-      auto addOutput = [&] (double* output[FREESURFACE_NUMBER_OF_COMPONENTS]) {
-        for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
-          double* target = output[component] + offset + face * numberOfSubTriangles;
-          /// @yateto_todo fix for multiple simulations
-          real* source = subTriangleDofs + component * numberOfAlignedSubTriangles; 
-          for (unsigned subtri = 0; subtri < numberOfSubTriangles; ++subtri) {
-            target[subtri] = source[subtri];
-          }
-        }
-      };
-
-      addOutput(velocities);
-
-      kernel::subTriangleDisplacement dkrnl;
-      dkrnl.displacement = displacementDofs[face];
-      dkrnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[ side[face] ];
-      dkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
-      dkrnl.execute(triRefiner.maxDepth);
+      double* faceVelocities[FREESURFACE_NUMBER_OF_COMPONENTS];
+      double* faceDisplacements[FREESURFACE_NUMBER_OF_COMPONENTS];
+      for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
+        faceVelocities[component] = velocities[component] + offset + face * numberOfSubTriangles;
+        faceDisplacements[component] = displacements[component] + offset + face * numberOfSubTriangles;
+      }
 
-      addOutput(displacements);
+      calculateOutput(dofs[face], displacementDofs[face], side[face], faceVelocities, faceDisplacements);
     }
     offset += surfaceLayer->getNumberOfCells() * numberOfSubTriangles;
   }
 }
 
+void seissol::solver::FreeSurfaceIntegrator::calculateOutput( real*         dofs,
+                                                              real*         displacementDofs,
+                                                              unsigned      side,
+                                                              double* const velocities[FREESURFACE_NUMBER_OF_COMPONENTS],
+                                                              double* const displacements[FREESURFACE_NUMBER_OF_COMPONENTS] )
+{
+  real subTriangleDofs[tensor::subTriangleDofs::size(FREESURFACE_MAX_REFINEMENT)] __attribute__((aligned(ALIGNMENT)));
+
+  kernel::subTriangleVelocity vkrnl;
+  vkrnl.Q = dofs;
+  vkrnl.selectVelocity = init::selectVelocity::Values;
+  vkrnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[side];
+  vkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
+  vkrnl.execute(triRefiner.maxDepth);
+
+  auto addOutput = [&] (double* const output[FREESURFACE_NUMBER_OF_COMPONENTS]) {
+    for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
+      double* target = output[component];
+      /// @yateto_todo fix for multiple simulations
+      real* source = subTriangleDofs + component * numberOfAlignedSubTriangles;
+      for (unsigned subtri = 0; subtri < numberOfSubTriangles; ++subtri) {
+        target[subtri] = source[subtri];
+      }
+    }
+  };
+
+  addOutput(velocities);
+
+  kernel::subTriangleDisplacement dkrnl;
+  dkrnl.displacement = displacementDofs;
+  dkrnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[side];
+  dkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
+  dkrnl.execute(triRefiner.maxDepth);
+
+  addOutput(displacements);
+}
 
 void seissol::solver::FreeSurfaceIntegrator::initializeProjectionMatrices(unsigned maxRefinementDepth)
 {
@@ -50,6 +50,7 @@
 
 #define FREESURFACE_MAX_REFINEMENT 3
 #define FREESURFACE_NUMBER_OF_COMPONENTS 3
+#define FREESURFACE_MAX_NUMBER_OF_SUBTRIANGLES (1u << (2u*FREESURFACE_MAX_REFINEMENT))
 
 namespace seissol
 {
@@ -105,6 +106,20 @@ public:
                     seissol::initializers::Lut* ltsLut );
 
   void calculateOutput();
+
+  /**
+   * Computes the sub triangle averages of the velocity and the displacement of one surface face.
+   *
+   * @param velocities component c of sub triangle t is stored in velocities[c][t].
+   * @param displacements component c of sub triangle t is stored in displacements[c][t].
+   **/
+  void calculateOutput( real*                 dofs,
+                        real*                 displacementDofs,
+                        unsigned              side,
+                        double* const         velocities[FREESURFACE_NUMBER_OF_COMPONENTS],
+                        double* const         displacements[FREESURFACE_NUMBER_OF_COMPONENTS] );
+
+  unsigned getNumberOfSubTriangles() const { return numberOfSubTriangles; }
   
   bool enabled() const { return m_enabled; }
 };
@@ -0,0 +1,172 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * In-situ ground motion summary of the free surface
+ **/
+
+#include "GroundMotion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+seissol::solver::GroundMotion::GroundMotion()
+  : m_damping(0.05)
+{
+  for (unsigned r = 0; r < GROUNDMOTION_NUMBER_OF_ROTATIONS; ++r) {
+    double const angle = M_PI * r / GROUNDMOTION_NUMBER_OF_ROTATIONS;
+    m_cos[r] = std::cos(angle);
+    m_sin[r] = std::sin(angle);
+  }
+}
+
+void seissol::solver::GroundMotion::configure(std::vector<double> const& periods, double damping)
+{
+  m_periods = periods;
+  m_damping = damping;
+}
+
+std::vector<std::string> seissol::solver::GroundMotion::variableNames() const
+{
+  std::vector<std::string> names;
+  char const* quantities[] = {"PGV", "PGA", "PGD"};
+  for (unsigned q = 0; q < 3; ++q) {
+    names.push_back(quantities[q]);
+    names.push_back(std::string(quantities[q]) + "_Z");
+    names.push_back(std::string(quantities[q]) + "_RotD50");
+    names.push_back(std::string(quantities[q]) + "_RotD100");
+  }
+  for (unsigned p = 0; p < m_periods.size(); ++p) {
+    std::ostringstream period;
+    period << m_periods[p];
+    names.push_back("PSA" + period.str() + "s_RotD50");
+    names.push_back("PSA" + period.str() + "s_RotD100");
+  }
+  return names;
+}
+
+void seissol::solver::GroundMotion::computeCoefficients(double timeStepWidth, double* coefficients) const
+{
+  for (unsigned p = 0; p < m_periods.size(); ++p) {
+    double const omega = 2.0 * M_PI / m_periods[p];
+    double const omegaD = omega * std::sqrt(1.0 - m_damping * m_damping);
+    double const decay = std::exp(-m_damping * omega * timeStepWidth);
+    double const c = std::cos(omegaD * timeStepWidth);
+    double const s = std::sin(omegaD * timeStepWidth);
+
+    // Transition matrix of the free vibration
+    double* coeff = coefficients + p * NumberOfCoefficients;
+    coeff[0] = decay * (c + m_damping * omega / omegaD * s);
+    coeff[1] = decay * s / omegaD;
+    coeff[2] = -decay * omega * omega / omegaD * s;
+    coeff[3] = decay * (c - m_damping * omega / omegaD * s);
+    coeff[4] = 1.0 / (omega * omega);
+  }
+}
+
+void seissol::solver::GroundMotion::update( double timeStepWidth,
+                                            double const* coefficients,
+                                            bool first,
+                                            double const velocity[3],
+                                            double const displacement[3],
+                                            double* state ) const
+{
+  double acceleration[3];
+  for (unsigned c = 0; c < 3; ++c) {
+    acceleration[c] = first ? 0.0 : (velocity[c] - state[Velocity + c]) / timeStepWidth;
+    state[Velocity + c] = velocity[c];
+  }
+
+  double const* quantities[] = {velocity, acceleration, displacement};
+  for (unsigned q = 0; q < 3; ++q) {
+    double const* x = quantities[q];
+    state[PeakHorizontal + q] = std::max(state[PeakHorizontal + q], std::sqrt(x[0]*x[0] + x[1]*x[1]));
+    state[PeakVertical + q] = std::max(state[PeakVertical + q], std::abs(x[2]));
+    updateRotated(x[0], x[1], state + PeakRotated + q * GROUNDMOTION_NUMBER_OF_ROTATIONS);
+  }
+
+  for (unsigned p = 0; p < m_periods.size(); ++p) {
+    double const* coeff = coefficients + p * NumberOfCoefficients;
+    double* oscillator = state + Oscillators + p * OscillatorSize;
+    for (unsigned c = 0; c < 2; ++c) {
+      // u'' + 2 zeta omega u' + omega^2 u = -a, shifted by the static solution -a/omega^2
+      double const shift = acceleration[c] * coeff[4];
+      double const u = oscillator[2*c] + shift;
+      double const v = oscillator[2*c + 1];
+      oscillator[2*c]     = coeff[0] * u + coeff[1] * v - shift;
+      oscillator[2*c + 1] = coeff[2] * u + coeff[3] * v;
+    }
+    updateRotated(oscillator[0], oscillator[2], oscillator + 4);
+  }
+}
+
+void seissol::solver::GroundMotion::updateRotated(double x, double y, double* peaks) const
+{
+  for (unsigned r = 0; r < GROUNDMOTION_NUMBER_OF_ROTATIONS; ++r) {
+    peaks[r] = std::max(peaks[r], std::abs(m_cos[r] * x + m_sin[r] * y));
+  }
+}
+
+void seissol::solver::GroundMotion::rotD(double const* peaks, double& rotD50, double& rotD100)
+{
+  double sorted[GROUNDMOTION_NUMBER_OF_ROTATIONS];
+  std::copy(peaks, peaks + GROUNDMOTION_NUMBER_OF_ROTATIONS, sorted);
+  std::sort(sorted, sorted + GROUNDMOTION_NUMBER_OF_ROTATIONS);
+
+  unsigned const half = GROUNDMOTION_NUMBER_OF_ROTATIONS / 2;
+#if GROUNDMOTION_NUMBER_OF_ROTATIONS % 2 == 0
+  rotD50 = 0.5 * (sorted[half - 1] + sorted[half]);
+#else
+  rotD50 = sorted[half];
+#endif
+  rotD100 = sorted[GROUNDMOTION_NUMBER_OF_ROTATIONS - 1];
+}
+
+void seissol::solver::GroundMotion::output(double const* state, double* values) const
+{
+  for (unsigned q = 0; q < 3; ++q) {
+    values[4*q]     = state[PeakHorizontal + q];
+    values[4*q + 1] = state[PeakVertical + q];
+    rotD(state + PeakRotated + q * GROUNDMOTION_NUMBER_OF_ROTATIONS, values[4*q + 2], values[4*q + 3]);
+  }
+
+  for (unsigned p = 0; p < m_periods.size(); ++p) {
+    double const omega = 2.0 * M_PI / m_periods[p];
+    double* psa = values + 12 + 2*p;
+    rotD(state + Oscillators + p * OscillatorSize + 4, psa[0], psa[1]);
+    psa[0] *= omega * omega;
+    psa[1] *= omega * omega;
+  }
+}
@@ -0,0 +1,163 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * In-situ ground motion summary of the free surface
+ **/
+
+#ifndef GROUND_MOTION_H
+#define GROUND_MOTION_H
+
+#include <string>
+#include <vector>
+
+/** Number of horizontal directions for the rotated (RotD) peak values */
+#define GROUNDMOTION_NUMBER_OF_ROTATIONS 18
+
+namespace seissol
+{
+  namespace solver
+  {
+    class GroundMotion;
+  }
+}
+
+/**
+ * In-situ ground motion summary of one point (sub triangle) on the free surface.
+ *
+ * The state of a point holds the running maxima of the velocity, acceleration
+ * and displacement and the state of a damped single degree of freedom oscillator
+ * for each period of the response spectrum. The acceleration is the finite
+ * difference of two consecutive velocities, the oscillators are integrated
+ * exactly for an acceleration that is constant during a time step.
+ *
+ * The z-axis is the vertical axis. Rotated peak values are computed for
+ * GROUNDMOTION_NUMBER_OF_ROTATIONS equally spaced horizontal directions in [0, 180).
+ */
+class seissol::solver::GroundMotion {
+public:
+  /** Number of coefficients of one oscillator for a fixed time step width */
+  static const unsigned NumberOfCoefficients = 5;
+
+private:
+  /** Oscillator periods of the response spectrum */
+  std::vector<double> m_periods;
+
+  /** Damping ratio of the oscillators */
+  double m_damping;
+
+  double m_cos[GROUNDMOTION_NUMBER_OF_ROTATIONS];
+  double m_sin[GROUNDMOTION_NUMBER_OF_ROTATIONS];
+
+  //
+  // Layout of the state
+  //
+  /** Velocity of the last time step */
+  static const unsigned Velocity = 0;
+  /** Peak of the horizontal vector magnitude (velocity, acceleration, displacement) */
+  static const unsigned PeakHorizontal = 3;
+  /** Peak of the vertical component (velocity, acceleration, displacement) */
+  static const unsigned PeakVertical = 6;
+  /** Peaks of the rotated horizontal components [quantity][rotation] */
+  static const unsigned PeakRotated = 9;
+  /** Oscillators [period][ux, vx, uy, vy, peaks of the rotated displacement] */
+  static const unsigned Oscillators = PeakRotated + 3*GROUNDMOTION_NUMBER_OF_ROTATIONS;
+  static const unsigned OscillatorSize = 4 + GROUNDMOTION_NUMBER_OF_ROTATIONS;
+
+public:
+  GroundMotion();
+
+  /**
+   * @param periods Periods of the response spectrum (may be empty)
+   * @param damping Damping ratio of the oscillators
+   */
+  void configure(std::vector<double> const& periods, double damping);
+
+  unsigned numberOfPeriods() const {
+    return m_periods.size();
+  }
+
+  /**
+   * @return The number of doubles in the state of one point
+   */
+  unsigned stateSize() const {
+    return Oscillators + m_periods.size() * OscillatorSize;
+  }
+
+  /**
+   * @return The number of output variables
+   */
+  unsigned numberOfVariables() const {
+    return 12 + 2 * m_periods.size();
+  }
+
+  std::vector<std::string> variableNames() const;
+
+  /**
+   * Computes the oscillator coefficients for a time step width
+   *
+   * @param coefficients NumberOfCoefficients coefficients per period
+   */
+  void computeCoefficients(double timeStepWidth, double* coefficients) const;
+
+  /**
+   * Updates the state of a point at the end of a time step
+   *
+   * @param coefficients The oscillator coefficients of this time step width
+   * @param first True if this is the first update of the state
+   * @param velocity The velocity at the end of the time step
+   * @param displacement The displacement at the end of the time step
+   */
+  void update(double timeStepWidth, double const* coefficients, bool first,
+              double const velocity[3], double const displacement[3],
+              double* state) const;
+
+  /**
+   * Computes the output variables of a point
+   */
+  void output(double const* state, double* values) const;
+
+private:
+  /**
+   * Updates the peaks of the rotated horizontal components
+   */
+  void updateRotated(double x, double y, double* peaks) const;
+
+  /**
+   * Computes the median (RotD50) and the maximum (RotD100) of the rotated peaks
+   */
+  static void rotD(double const* peaks, double& rotD50, double& rotD100);
+};
+
+#endif // GROUND_MOTION_H
@@ -0,0 +1,131 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Ground motion summary of the free surface faces of one time cluster
+ **/
+
+#include "GroundMotionCluster.h"
+
+#include <cassert>
+
+seissol::solver::GroundMotionCluster::GroundMotionCluster(  GroundMotion const&     groundMotion,
+                                                            FreeSurfaceIntegrator&  freeSurfaceIntegrator,
+                                                            unsigned                cluster )
+  : m_groundMotion(groundMotion),
+    m_freeSurfaceIntegrator(freeSurfaceIntegrator),
+    m_numberOfSubTriangles(freeSurfaceIntegrator.getNumberOfSubTriangles()),
+    m_coefficients(groundMotion.numberOfPeriods() * GroundMotion::NumberOfCoefficients),
+    m_timeStepWidth(0.0),
+    m_first(true),
+    m_started(false)
+{
+  seissol::initializers::TimeCluster& surfaceCluster = freeSurfaceIntegrator.surfaceLtsTree.child(cluster);
+  m_layers[0] = &surfaceCluster.child<Copy>();
+  m_layers[1] = &surfaceCluster.child<Interior>();
+  m_numberOfFaces = m_layers[0]->getNumberOfCells() + m_layers[1]->getNumberOfCells();
+
+  // Peaks and oscillators start at zero
+  m_state.resize(static_cast<size_t>(numberOfTriangles()) * groundMotion.stateSize(), 0.0);
+}
+
+void seissol::solver::GroundMotionCluster::prepare(double timeStepWidth)
+{
+  m_first = !m_started;
+  m_started = true;
+
+  if (timeStepWidth != m_timeStepWidth) {
+    m_timeStepWidth = timeStepWidth;
+    m_groundMotion.computeCoefficients(timeStepWidth, m_coefficients.data());
+  }
+}
+
+void seissol::solver::GroundMotionCluster::update(unsigned faceBegin, unsigned faceEnd)
+{
+  assert(m_numberOfSubTriangles <= FREESURFACE_MAX_NUMBER_OF_SUBTRIANGLES);
+
+  unsigned const stateSize = m_groundMotion.stateSize();
+  unsigned const numberOfCopyFaces = m_layers[0]->getNumberOfCells();
+
+  double velocityBuffer[FREESURFACE_NUMBER_OF_COMPONENTS][FREESURFACE_MAX_NUMBER_OF_SUBTRIANGLES];
+  double displacementBuffer[FREESURFACE_NUMBER_OF_COMPONENTS][FREESURFACE_MAX_NUMBER_OF_SUBTRIANGLES];
+  double* velocities[FREESURFACE_NUMBER_OF_COMPONENTS];
+  double* displacements[FREESURFACE_NUMBER_OF_COMPONENTS];
+  for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
+    velocities[component] = velocityBuffer[component];
+    displacements[component] = displacementBuffer[component];
+  }
+
+  auto const& surfaceLts = m_freeSurfaceIntegrator.surfaceLts;
+  for (unsigned face = faceBegin; face < faceEnd; ++face) {
+    seissol::initializers::Layer& layer = (face < numberOfCopyFaces) ? *m_layers[0] : *m_layers[1];
+    unsigned const layerFace = (face < numberOfCopyFaces) ? face : face - numberOfCopyFaces;
+
+    m_freeSurfaceIntegrator.calculateOutput(  layer.var(surfaceLts.dofs)[layerFace],
+                                              layer.var(surfaceLts.displacementDofs)[layerFace],
+                                              layer.var(surfaceLts.side)[layerFace],
+                                              velocities,
+                                              displacements );
+
+    for (unsigned subTriangle = 0; subTriangle < m_numberOfSubTriangles; ++subTriangle) {
+      double const velocity[3] = {velocityBuffer[0][subTriangle], velocityBuffer[1][subTriangle], velocityBuffer[2][subTriangle]};
+      double const displacement[3] = {displacementBuffer[0][subTriangle], displacementBuffer[1][subTriangle], displacementBuffer[2][subTriangle]};
+      double* state = &m_state[(static_cast<size_t>(face) * m_numberOfSubTriangles + subTriangle) * stateSize];
+
+      m_groundMotion.update(m_timeStepWidth, m_coefficients.data(), m_first, velocity, displacement, state);
+    }
+  }
+}
+
+void seissol::solver::GroundMotionCluster::output(double* const* variables) const
+{
+  unsigned const stateSize = m_groundMotion.stateSize();
+  unsigned const numberOfVariables = m_groundMotion.numberOfVariables();
+
+#ifdef _OPENMP
+  #pragma omp parallel
+#endif // _OPENMP
+  {
+    std::vector<double> values(numberOfVariables);
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif // _OPENMP
+    for (unsigned triangle = 0; triangle < numberOfTriangles(); ++triangle) {
+      m_groundMotion.output(&m_state[static_cast<size_t>(triangle) * stateSize], values.data());
+      for (unsigned v = 0; v < numberOfVariables; ++v) {
+        variables[v][triangle] = values[v];
+      }
+    }
+  }
+}
@@ -0,0 +1,118 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Ground motion summary of the free surface faces of one time cluster
+ **/
+
+#ifndef GROUND_MOTION_CLUSTER_H
+#define GROUND_MOTION_CLUSTER_H
+
+#include <vector>
+
+#include <Solver/FreeSurfaceIntegrator.h>
+#include <Solver/GroundMotion.h>
+
+namespace seissol
+{
+  namespace solver
+  {
+    class GroundMotionCluster;
+  }
+}
+
+/**
+ * Ground motion summary of the free surface faces of one time cluster.
+ *
+ * The faces are the faces of the copy layer followed by the faces of the interior
+ * layer of the cluster in the free surface LTS tree. The state is updated by the
+ * time cluster after each time step.
+ */
+class seissol::solver::GroundMotionCluster {
+private:
+  GroundMotion const& m_groundMotion;
+
+  FreeSurfaceIntegrator& m_freeSurfaceIntegrator;
+
+  /** Copy and interior layer of the cluster */
+  seissol::initializers::Layer* m_layers[2];
+
+  unsigned m_numberOfFaces;
+
+  unsigned m_numberOfSubTriangles;
+
+  /** [face][sub triangle][state] */
+  std::vector<double> m_state;
+
+  /** Oscillator coefficients of the current time step width */
+  std::vector<double> m_coefficients;
+
+  double m_timeStepWidth;
+
+  /** Set before the first update */
+  bool m_first;
+
+  bool m_started;
+
+public:
+  GroundMotionCluster(  GroundMotion const&     groundMotion,
+                        FreeSurfaceIntegrator&  freeSurfaceIntegrator,
+                        unsigned                cluster );
+
+  unsigned numberOfFaces() const {
+    return m_numberOfFaces;
+  }
+
+  unsigned numberOfTriangles() const {
+    return m_numberOfFaces * m_numberOfSubTriangles;
+  }
+
+  /**
+   * Has to be called before each time step is updated
+   */
+  void prepare(double timeStepWidth);
+
+  /**
+   * Updates the faces [faceBegin, faceEnd) with the state at the end of the time step.
+   * Different face ranges may be updated in parallel.
+   */
+  void update(unsigned faceBegin, unsigned faceEnd);
+
+  /**
+   * @param variables variable v of triangle t of this cluster is stored in variables[v][t].
+   */
+  void output(double* const* variables) const;
+};
+
+#endif // GROUND_MOTION_CLUSTER_H
@@ -40,6 +40,8 @@
  * C++/Fortran-interoperability.
  **/
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstring>
 
@@ -48,6 +50,7 @@
 #include "SeisSol.h"
 #include <Initializer/CellLocalMatrices.h>
 #include <Initializer/InitialFieldProjection.h>
+#include <Initializer/LocalIntegrationBatches.h>
 #include <Initializer/ParameterDB.h>
 #include <Initializer/time_stepping/common.hpp>
 #include <Initializer/typedefs.hpp>
@@ -215,6 +218,14 @@ extern "C" {
 	e_interoperability.enableFreeSurfaceOutput(maxRefinementDepth);
   }
 
+  void c_interoperability_enableGroundMotionOutput(int maxRefinementDepth, double* periods, int numberOfPeriods, double damping) {
+	e_interoperability.enableGroundMotionOutput(maxRefinementDepth, periods, numberOfPeriods, damping);
+  }
+
+  void c_interoperability_enableEnergyOutput(double interval, int magnitudeMask) {
+	e_interoperability.enableEnergyOutput(interval, magnitudeMask);
+  }
+
   void c_interoperability_enableCheckPointing( double i_checkPointInterval,
 		  const char* i_checkPointFilename, const char* i_checkPointBackend ) {
     e_interoperability.enableCheckPointing( i_checkPointInterval,
@@ -276,6 +287,9 @@ extern "C" {
                                               double *i_fullUpdateTime,
                                               double *i_timeStepWidth );
 
+  extern void f_interoperability_calcFaultReceiverOutput( void   *i_domain,
+                                                          double *time );
+
   extern void f_interoperability_evaluateFrictionLaw( void*   i_domain,
                                                       int     i_face,
                                                       real*   i_QInterpolatedPlus,
@@ -295,6 +309,9 @@ extern "C" {
                                                       double  sWaveVelocityMinus,
                                                       real const* resampleMatrix );
 
+  extern void f_interoperability_getFrictionState( void* i_domain,
+                                                   seissol::physics::FrictionState* o_state );
+
   extern void f_interoperability_calcElementwiseFaultoutput( void *domain,
 	                                                     double time );
 
@@ -425,6 +442,8 @@ void seissol::Interoperability::initializeMemoryLayout(int clustering, bool enab
 
   // initialize face lts trees
   seissol::SeisSol::main.getMemoryManager().fixateBoundaryLtsTree();
+
+  seissol::SeisSol::main.getMemoryManager().printMemoryReport();
 }
 
 
@@ -700,8 +719,12 @@ void seissol::Interoperability::initializeCellLocalMatrices()
                                                     m_ltsTree,
                                                     m_lts,
                                                     &m_ltsLut);
- 
 
+#ifdef LOCAL_BATCH_SIZE
+  for (auto it = m_ltsTree->beginLeaf(seissol::initializers::LayerMask(Ghost)); it != m_ltsTree->endLeaf(); ++it) {
+    seissol::initializers::initializeLocalIntegrationBatches(*it, *m_lts);
+  }
+#endif
 }
 
 template<typename T>
@@ -753,6 +776,24 @@ void seissol::Interoperability::enableFreeSurfaceOutput(int maxRefinementDepth)
 								&m_ltsLut );
 }
 
+void seissol::Interoperability::enableGroundMotionOutput(int maxRefinementDepth, const double* periods, int numberOfPeriods, double damping)
+{
+	// The ground motion summary uses the sub triangles of the free surface output
+	if (!seissol::SeisSol::main.freeSurfaceIntegrator().enabled()) {
+		seissol::SeisSol::main.freeSurfaceIntegrator().initialize( maxRefinementDepth,
+									m_lts,
+									m_ltsTree,
+									&m_ltsLut );
+	}
+
+	seissol::SeisSol::main.groundMotionWriter().enable(std::vector<double>(periods, periods + numberOfPeriods), damping);
+}
+
+void seissol::Interoperability::enableEnergyOutput(double interval, int magnitudeMask)
+{
+	seissol::SeisSol::main.energyOutput().enable(interval, magnitudeMask != 0);
+}
+
 
 void seissol::Interoperability::enableCheckPointing( double i_checkPointInterval,
 		const char *i_checkPointFilename, const char *i_checkPointBackend ) {
@@ -787,14 +828,54 @@ void seissol::Interoperability::initializeIO(
 {
   auto type = writer::backendType(xdmfWriterBackend);
   
+	// Global mesh ids of the cells (duplicates are only stored once)
+	const MeshReader& meshReader = seissol::SeisSol::main.meshReader();
+	unsigned numberOfCells = m_ltsTree->getNumberOfCells(m_lts->dofs.mask);
+	unsigned* ltsToMesh = m_ltsLut.getLtsToMeshLut(m_lts->dofs.mask);
+	unsigned* meshToLts = m_ltsLut.getMeshToLtsLut(m_lts->dofs.mask)[0];
+	std::vector<unsigned long> cellIds(numberOfCells);
+	for (unsigned ltsId = 0; ltsId < numberOfCells; ++ltsId) {
+		unsigned meshId = ltsToMesh[ltsId];
+		if (meshId != std::numeric_limits<unsigned>::max() && meshToLts[meshId] == ltsId) {
+			cellIds[ltsId] = meshReader.getElements()[meshId].globalId;
+		} else {
+			cellIds[ltsId] = checkpoint::Wavefield::NO_CELL_ID;
+		}
+	}
+
+	// Identify fault faces by their barycenter, the plus side owns the face
+	const std::vector<Fault>& fault = meshReader.getFault();
+	std::vector<checkpoint::FaultFaceKey> faceKeys(numSides);
+	for (int i = 0; i < numSides; ++i) {
+		bool plus = fault[i].element >= 0;
+		const Element& element = meshReader.getElements()[plus ? fault[i].element : fault[i].neighborElement];
+		int side = plus ? fault[i].side : fault[i].neighborSide;
+
+		std::array<std::array<double, 3>, 3> faceVertices;
+		for (int j = 0; j < 3; ++j) {
+			const double* coords = meshReader.getVertices()[element.vertices[MeshTools::FACE2NODES[side][j]]].coords;
+			std::copy(coords, coords+3, faceVertices[j].begin());
+		}
+		std::sort(faceVertices.begin(), faceVertices.end());
+		for (int d = 0; d < 3; ++d) {
+			faceKeys[i].barycenter[d] = (faceVertices[0][d] + faceVertices[1][d] + faceVertices[2][d]) / 3.0;
+		}
+		faceKeys[i].owner = plus ? 1 : 0;
+	}
+
 	// Initialize checkpointing
 	int faultTimeStep;
 	bool hasCheckpoint = seissol::SeisSol::main.checkPointManager().init(reinterpret_cast<real*>(m_ltsTree->var(m_lts->dofs)),
-			m_ltsTree->getNumberOfCells(m_lts->dofs.mask) * tensor::Q::size(),
+			numberOfCells * tensor::Q::size(),
+			cellIds.data(), numberOfCells,
 			mu, slipRate1, slipRate2, slip, slip1, slip2,
 			state, strength, numSides, numBndGP,
+			faceKeys.data(),
 			faultTimeStep);
 	if (hasCheckpoint) {
+		// Checkpoints only contain one copy of duplicated cells
+		synchronize(m_lts->dofs);
+
 		seissol::SeisSol::main.simulator().setCurrentTime(
 			seissol::SeisSol::main.checkPointManager().header().time());
 		seissol::SeisSol::main.faultWriter().setTimestep(faultTimeStep);
@@ -828,6 +909,22 @@ void seissol::Interoperability::initializeIO(
 		&seissol::SeisSol::main.freeSurfaceIntegrator(),
 		freeSurfaceFilename, freeSurfaceInterval, type);
 
+	// Initialize ground motion output
+	seissol::SeisSol::main.groundMotionWriter().init(
+		seissol::SeisSol::main.meshReader(),
+		&seissol::SeisSol::main.freeSurfaceIntegrator(),
+		freeSurfaceFilename, type);
+	seissol::SeisSol::main.timeManager().setGroundMotionClusters(seissol::SeisSol::main.groundMotionWriter());
+
+	// Initialize energy output
+	physics::FrictionState faultState;
+	f_interoperability_getFrictionState( m_domain, &faultState );
+	seissol::SeisSol::main.energyOutput().init(
+		freeSurfaceFilename,
+		seissol::SeisSol::main.meshReader(),
+		m_lts, &m_ltsLut, m_globalData,
+		faultState);
+
   auto& receiverWriter = seissol::SeisSol::main.receiverWriter();
   // Initialize receiver output
   receiverWriter.init(
@@ -940,7 +1037,13 @@ std::string seissol::Interoperability::getInitialConditionType() {
 void seissol::Interoperability::simulate( double i_finalTime ) {
   seissol::SeisSol::main.simulator().setFinalTime( i_finalTime );
 
+  physics::FrictionState frictionState;
+  f_interoperability_getFrictionState( m_domain, &frictionState );
+  m_frictionSolver.init( physics::FrictionSolver::requestedMode(), frictionState );
+
  seissol::SeisSol::main.simulator().simulate();
+
+  m_frictionSolver.printCheck();
 }
 
 void seissol::Interoperability::finalizeIO()
@@ -948,15 +1051,25 @@ void seissol::Interoperability::finalizeIO()
 	seissol::SeisSol::main.waveFieldWriter().close();
 	seissol::SeisSol::main.checkPointManager().close();
 	seissol::SeisSol::main.faultWriter().close();
+	seissol::SeisSol::main.faultReceiverWriter().close();
 	seissol::SeisSol::main.freeSurfaceWriter().close();
+	seissol::SeisSol::main.groundMotionWriter().close();
+	seissol::SeisSol::main.energyOutput().close();
+	seissol::SeisSol::main.receiverWriter().close();
 }
 
 void seissol::Interoperability::faultOutput( double i_fullUpdateTime,
                                              double i_timeStepWidth )
 {
+  seissol::SeisSol::main.faultReceiverWriter().step( i_fullUpdateTime, i_timeStepWidth );
   f_interoperability_faultOutput( m_domain, &i_fullUpdateTime, &i_timeStepWidth );
 }
 
+void seissol::Interoperability::calcFaultReceiverOutput( double time )
+{
+  f_interoperability_calcFaultReceiverOutput( m_domain, &time );
+}
+
 void seissol::Interoperability::evaluateFrictionLaw(  int face,
                                                       real QInterpolatedPlus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
                                                       real QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
@@ -994,6 +1107,71 @@ void seissol::Interoperability::evaluateFrictionLaw(  int face,
                                           init::resample::Values );
 }
 
+void seissol::Interoperability::evaluateFrictionLaw(  seissol::initializers::Layer&                 layerData,
+                                                      seissol::initializers::DynamicRupture const&  dynRup,
+                                                      unsigned                                      faceBegin,
+                                                      unsigned                                      faceEnd,
+                                                      double                                        i_fullUpdateTime,
+                                                      double                                        timePoints[CONVERGENCE_ORDER],
+                                                      double                                        timeWeights[CONVERGENCE_ORDER] )
+{
+  if (m_frictionSolver.mode() == physics::FrictionSolver::Cpp) {
+    m_frictionSolver.evaluate( layerData, dynRup, faceBegin, faceEnd, i_fullUpdateTime, timePoints, timeWeights );
+    return;
+  }
+
+  DRFaceInformation*                    faceInformation    = layerData.var(dynRup.faceInformation);
+  real                                (*QInterpolatedPlus)[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()]  = layerData.var(dynRup.QInterpolatedPlus);
+  real                                (*QInterpolatedMinus)[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()] = layerData.var(dynRup.QInterpolatedMinus);
+  real                                (*imposedStatePlus)[seissol::tensor::QInterpolated::size()]                      = layerData.var(dynRup.imposedStatePlus);
+  real                                (*imposedStateMinus)[seissol::tensor::QInterpolated::size()]                     = layerData.var(dynRup.imposedStateMinus);
+  seissol::model::IsotropicWaveSpeeds*  waveSpeedsPlus     = layerData.var(dynRup.waveSpeedsPlus);
+  seissol::model::IsotropicWaveSpeeds*  waveSpeedsMinus    = layerData.var(dynRup.waveSpeedsMinus);
+
+  // check mode: evaluate the C++ solver first and restore the state for the Fortran solver
+  std::vector< std::vector<double> > cppState;
+  std::vector<real> cppImposedStatePlus;
+  std::vector<real> cppImposedStateMinus;
+  bool check = (m_frictionSolver.mode() == physics::FrictionSolver::Check);
+  if (check) {
+    std::vector< std::vector<double> > initialState(faceEnd - faceBegin);
+    for (unsigned face = faceBegin; face < faceEnd; ++face) {
+      m_frictionSolver.saveState( faceInformation[face].meshFace, initialState[face - faceBegin] );
+    }
+
+    m_frictionSolver.evaluate( layerData, dynRup, faceBegin, faceEnd, i_fullUpdateTime, timePoints, timeWeights );
+
+    cppImposedStatePlus.assign( imposedStatePlus[faceBegin], imposedStatePlus[faceBegin] + (faceEnd - faceBegin) * seissol::tensor::QInterpolated::size() );
+    cppImposedStateMinus.assign( imposedStateMinus[faceBegin], imposedStateMinus[faceBegin] + (faceEnd - faceBegin) * seissol::tensor::QInterpolated::size() );
+    cppState.resize(faceEnd - faceBegin);
+    for (unsigned face = faceBegin; face < faceEnd; ++face) {
+      m_frictionSolver.saveState( faceInformation[face].meshFace, cppState[face - faceBegin] );
+      m_frictionSolver.restoreState( faceInformation[face].meshFace, initialState[face - faceBegin] );
+    }
+  }
+
+  for (unsigned face = faceBegin; face < faceEnd; ++face) {
+    evaluateFrictionLaw( static_cast<int>(faceInformation[face].meshFace),
+                         QInterpolatedPlus[face],
+                         QInterpolatedMinus[face],
+                         imposedStatePlus[face],
+                         imposedStateMinus[face],
+                         i_fullUpdateTime,
+                         timePoints,
+                         timeWeights,
+                         waveSpeedsPlus[face],
+                         waveSpeedsMinus[face] );
+
+    if (check) {
+      std::vector<double> fortranState;
+      m_frictionSolver.saveState( faceInformation[face].meshFace, fortranState );
+      m_frictionSolver.compareState( fortranState, cppState[face - faceBegin] );
+      m_frictionSolver.compare( seissol::tensor::QInterpolated::size(), imposedStatePlus[face], &cppImposedStatePlus[(face - faceBegin) * seissol::tensor::QInterpolated::size()] );
+      m_frictionSolver.compare( seissol::tensor::QInterpolated::size(), imposedStateMinus[face], &cppImposedStateMinus[(face - faceBegin) * seissol::tensor::QInterpolated::size()] );
+    }
+  }
+}
+
 void seissol::Interoperability::calcElementwiseFaultoutput(double time)
 {
 	f_interoperability_calcElementwiseFaultoutput(m_domain, time);
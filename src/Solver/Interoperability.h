@@ -53,6 +53,7 @@
 #include <Initializer/tree/LTSTree.hpp>
 #include <Initializer/tree/Lut.hpp>
 #include <Physics/InitialField.h>
+#include <Physics/FrictionSolver.h>
 #include "Equations/datastructures.hpp"
 
 namespace seissol {
@@ -103,6 +104,9 @@ class seissol::Interoperability {
     //! Vector of initial conditions
     std::vector<std::unique_ptr<physics::InitialField>> m_iniConds;
 
+    //! C++ friction solver
+    physics::FrictionSolver m_frictionSolver;
+
     void initInitialConditions();
  public:
    /**
@@ -283,6 +287,24 @@ class seissol::Interoperability {
     */
    void enableFreeSurfaceOutput(int maxRefinementDepth);
 
+   /**
+    * Enable the in-situ ground motion summary of the free surface
+    *
+    * @param maxRefinementDepth refinement of the free surface (ignored if the free surface output is enabled)
+    * @param periods periods of the response spectrum
+    * @param numberOfPeriods number of periods
+    * @param damping damping ratio of the oscillators
+    */
+   void enableGroundMotionOutput(int maxRefinementDepth, const double* periods, int numberOfPeriods, double damping);
+
+   /**
+    * Enable the output of the energies and the seismic moment
+    *
+    * @param interval time between two outputs
+    * @param magnitudeMask restrict the seismic moment to the faces of the magnitude output (DISC%DynRup%magnitude_out)
+    */
+   void enableEnergyOutput(double interval, int magnitudeMask);
+
    /**
     * Enable checkpointing.
     *
@@ -371,6 +393,16 @@ class seissol::Interoperability {
     **/
    void faultOutput( double i_fullUpdateTime, double i_timeStepWidth );
 
+   /**
+    * Compute the output of the fault receivers without writing it.
+    *
+    * @param time time of the fault state.
+    **/
+   void calcFaultReceiverOutput( double time );
+
+   /**
+    * Evaluates the friction law on a single fault face with the Fortran solver.
+    **/
    void evaluateFrictionLaw(  int face,
                               real QInterpolatedPlus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
                               real QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
@@ -382,6 +414,21 @@ class seissol::Interoperability {
                               seissol::model::IsotropicWaveSpeeds const& waveSpeedsPlus,
                               seissol::model::IsotropicWaveSpeeds const& waveSpeedsMinus );
 
+   /**
+    * Evaluates the friction law on the faces [faceBegin, faceEnd) of a dynamic rupture layer.
+    *
+    * @param layerData dynamic rupture layer; QInterpolatedPlus and QInterpolatedMinus must be computed
+    *                  (only allocated if the C++ friction solver is requested).
+    * @param dynRup variables of the dynamic rupture tree.
+    **/
+   void evaluateFrictionLaw(  seissol::initializers::Layer&                 layerData,
+                              seissol::initializers::DynamicRupture const&  dynRup,
+                              unsigned                                      faceBegin,
+                              unsigned                                      faceEnd,
+                              double                                        i_fullUpdateTime,
+                              double                                        timePoints[CONVERGENCE_ORDER],
+                              double                                        timeWeights[CONVERGENCE_ORDER] );
+
 
    /**
     * Prepare element wise faultoutput
@@ -106,6 +106,13 @@ class seissol::Simulator {
      */
     bool checkPointingEnabled();
 
+    /**
+     * Returns the interval of the check points (infinity if check pointing is disabled).
+     */
+    double checkPointInterval() const {
+      return m_checkPointInterval;
+    }
+
     /**
      * Simulates until finished.
      **/
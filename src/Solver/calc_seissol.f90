@@ -64,10 +64,8 @@ CONTAINS
     USE receiver_hdf_mod
 #else
     USE receiver_mod
-    USE energies_output_mod
 #endif
     USE ini_SeisSol_mod
-    USE magnitude_output_mod
     USE output_rupturefront_mod
     USE COMMON_operators_mod
 #ifdef PARALLEL
@@ -211,8 +209,6 @@ CONTAINS
 #endif
     ENDIF
 
-    ! output magnitude for dynamic rupture simulations
-    IF (EQN%DR.EQ.1 .AND. DISC%DynRup%magnitude_output_on.EQ.1) CALL magnitude_output(OptionalFields%BackgroundValue,DISC,MESH,MPI,IO)
     ! output GP-wise RF in extra files
     IF (EQN%DR.EQ.1 .AND. DISC%DynRup%RF_output_on.EQ.1) CALL output_rupturefront(DISC,MESH,MPI,IO, BND)
 
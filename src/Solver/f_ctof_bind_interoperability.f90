@@ -42,16 +42,37 @@
 #include "Initializer/preProcessorMacros.fpp"
 
 module f_ctof_bind_interoperability
+  use iso_c_binding
   implicit none
 
   interface f_interoperability_faultOutput
     module procedure f_interoperability_faultOutput
   end interface
 
+  interface f_interoperability_calcFaultReceiverOutput
+    module procedure f_interoperability_calcFaultReceiverOutput
+  end interface
+
   interface f_interoperability_evaluateFrictionLaw
     module procedure f_interoperability_evaluateFrictionLaw
   end interface
 
+  interface realPtr
+    module procedure realPtr1, realPtr2, realPtr3
+  end interface
+
+  !> Fault state for the C++ friction solver, must match seissol::physics::FrictionState
+  type, bind(c) :: tFrictionState
+    integer(kind=c_int) :: frictionLaw, numberOfPoints, numberOfFaces, instantaneousHealing
+    real(kind=c_double) :: t0, rsF0, rsA, rsB, rsSl0, rsSr0
+    type(c_ptr)         :: mu, muS, muD, dC, cohesion, forcedRuptureTime, strength
+    type(c_ptr)         :: slip, slip1, slip2, slipRate1, slipRate2, stateVariable, peakSlipRate
+    type(c_ptr)         :: tractionXY, tractionXZ, ruptureTime, dynStressTime
+    type(c_ptr)         :: ruptureFront, dynStressFront, magnitudeOutput, averagedSlip, initialStress
+    type(c_ptr)         :: outputMu, outputStrength, outputSlip, outputSlip1, outputSlip2
+    type(c_ptr)         :: outputRuptureTime, outputPeakSlipRate, outputDynStressTime, outputStateVariable
+  end type
+
   contains
     subroutine copyDynamicRuptureState(domain, fromMeshId, toMeshId)
       use typesDef
@@ -88,6 +109,97 @@ module f_ctof_bind_interoperability
       call copyDynamicRuptureState(l_domain, 1, l_domain%mesh%Fault%nSide)
     end subroutine
 
+    !> Returns the address of (possibly unallocated) arrays of the fault state
+    function realPtr1( i_array ) result( o_ptr )
+      real, target, allocatable, intent(in) :: i_array(:)
+      type(c_ptr)                           :: o_ptr
+
+      o_ptr = c_null_ptr
+      if (allocated(i_array)) o_ptr = c_loc(i_array)
+    end function
+
+    function realPtr2( i_array ) result( o_ptr )
+      real, target, allocatable, intent(in) :: i_array(:,:)
+      type(c_ptr)                           :: o_ptr
+
+      o_ptr = c_null_ptr
+      if (allocated(i_array)) o_ptr = c_loc(i_array)
+    end function
+
+    function realPtr3( i_array ) result( o_ptr )
+      real, target, allocatable, intent(in) :: i_array(:,:,:)
+      type(c_ptr)                           :: o_ptr
+
+      o_ptr = c_null_ptr
+      if (allocated(i_array)) o_ptr = c_loc(i_array)
+    end function
+
+    subroutine f_interoperability_getFrictionState( i_domain, o_state ) bind (c, name='f_interoperability_getFrictionState')
+      use iso_c_binding
+      use typesDef
+      implicit none
+
+      type(c_ptr), value                     :: i_domain
+      type(tUnstructDomainDescript), pointer :: l_domain
+      type(tFrictionState), intent(out)      :: o_state
+
+      ! convert c to fortran pointers
+      call c_f_pointer( i_domain, l_domain)
+
+      associate( DynRup => l_domain%disc%DynRup )
+        o_state%frictionLaw          = l_domain%eqn%FL
+        o_state%numberOfPoints       = l_domain%disc%Galerkin%nBndGP
+        o_state%numberOfFaces        = l_domain%mesh%Fault%nSide
+        o_state%instantaneousHealing = DynRup%inst_healing
+
+        o_state%t0    = DynRup%t_0
+        o_state%rsF0  = DynRup%RS_f0
+        o_state%rsA   = DynRup%RS_a
+        o_state%rsB   = DynRup%RS_b
+        o_state%rsSl0 = DynRup%RS_sl0
+        o_state%rsSr0 = DynRup%RS_sr0
+
+        o_state%mu                = realPtr(DynRup%Mu)
+        o_state%muS               = realPtr(DynRup%Mu_S)
+        o_state%muD               = realPtr(DynRup%Mu_D)
+        o_state%dC                = realPtr(DynRup%D_C)
+        o_state%cohesion          = realPtr(DynRup%cohesion)
+        o_state%forcedRuptureTime = realPtr(DynRup%forced_rupture_time)
+        o_state%strength          = c_null_ptr
+        if (associated(DynRup%Strength)) o_state%strength = c_loc(DynRup%Strength)
+        o_state%slip              = realPtr(DynRup%Slip)
+        o_state%slip1             = realPtr(DynRup%Slip1)
+        o_state%slip2             = realPtr(DynRup%Slip2)
+        o_state%slipRate1         = realPtr(DynRup%SlipRate1)
+        o_state%slipRate2         = realPtr(DynRup%SlipRate2)
+        o_state%stateVariable     = realPtr(DynRup%StateVar)
+        o_state%peakSlipRate      = realPtr(DynRup%PeakSR)
+        o_state%tractionXY        = realPtr(DynRup%TracXY)
+        o_state%tractionXZ        = realPtr(DynRup%TracXZ)
+        o_state%ruptureTime       = realPtr(DynRup%rupture_time)
+        o_state%dynStressTime     = realPtr(DynRup%dynStress_time)
+        o_state%averagedSlip      = realPtr(DynRup%averaged_Slip)
+        o_state%initialStress     = realPtr(l_domain%eqn%InitialStressInFaultCS)
+
+        o_state%ruptureFront    = c_null_ptr
+        o_state%dynStressFront  = c_null_ptr
+        o_state%magnitudeOutput = c_null_ptr
+        if (allocated(DynRup%RF))            o_state%ruptureFront    = c_loc(DynRup%RF)
+        if (allocated(DynRup%DS))            o_state%dynStressFront  = c_loc(DynRup%DS)
+        if (allocated(DynRup%magnitude_out)) o_state%magnitudeOutput = c_loc(DynRup%magnitude_out)
+
+        o_state%outputMu            = realPtr(DynRup%output_Mu)
+        o_state%outputStrength      = realPtr(DynRup%output_Strength)
+        o_state%outputSlip          = realPtr(DynRup%output_Slip)
+        o_state%outputSlip1         = realPtr(DynRup%output_Slip1)
+        o_state%outputSlip2         = realPtr(DynRup%output_Slip2)
+        o_state%outputRuptureTime   = realPtr(DynRup%output_rupture_time)
+        o_state%outputPeakSlipRate  = realPtr(DynRup%output_PeakSR)
+        o_state%outputDynStressTime = realPtr(DynRup%output_dynStress_time)
+        o_state%outputStateVariable = realPtr(DynRup%output_StateVar)
+      end associate
+    end subroutine
+
     subroutine f_interoperability_faultOutput( i_domain, i_time, i_timeStepWidth ) bind (c, name='f_interoperability_faultOutput')
       use iso_c_binding
       use typesDef
@@ -120,6 +232,32 @@ module f_ctof_bind_interoperability
       l_domain%disc%iterationstep = l_domain%disc%iterationstep + 1
     end subroutine
 
+    subroutine f_interoperability_calcFaultReceiverOutput( i_domain, i_time ) bind (c, name='f_interoperability_calcFaultReceiverOutput')
+      use iso_c_binding
+      use typesDef
+      use faultoutput_mod
+      implicit none
+
+      type(c_ptr), value                     :: i_domain
+      type(tUnstructDomainDescript), pointer :: l_domain
+
+      type(c_ptr), value                     :: i_time
+      real*8, pointer                        :: l_time
+
+      ! convert c to fortran pointers
+      call c_f_pointer( i_domain, l_domain)
+      call c_f_pointer( i_time,   l_time  )
+
+      if (.not. l_domain%disc%DynRup%DynRup_out_atPickpoint%DR_pick_output) then
+        return
+      endif
+
+      ! Only OutVal is used, the samples are buffered by the fault receiver writer
+      l_domain%disc%DynRup%DynRup_out_atPickpoint%CurrentPick(:) = 0
+      call calc_FaultOutput(l_domain%disc%DynRup%DynRup_out_atPickpoint, l_domain%disc, l_domain%eqn, l_domain%mesh, &
+                            l_domain%optionalFields%BackgroundValue, l_domain%bnd, l_time)
+    end subroutine
+
     subroutine f_interoperability_evaluateFrictionLaw( i_domain, i_face, i_QInterpolatedPlus, i_QInterpolatedMinus, &
       i_imposedStatePlus, i_imposedStateMinus, i_numberOfPoints, i_godunovLd, i_time, timePoints, timeWeights, densityPlus, &
       pWaveVelocityPlus, sWaveVelocityPlus, densityMinus, pWaveVelocityMinus, sWaveVelocityMinus, c_resampleMatrix ) bind (c, name='f_interoperability_evaluateFrictionLaw')
@@ -259,6 +259,22 @@ module f_ftoc_bind_interoperability
       integer(kind=c_int), value :: maxRefinementDepth
     end subroutine
 
+    subroutine c_interoperability_enableGroundMotionOutput( maxRefinementDepth, periods, numberOfPeriods, damping ) bind( C, name='c_interoperability_enableGroundMotionOutput' )
+      use iso_c_binding
+      implicit none
+      integer(kind=c_int), value                     :: maxRefinementDepth
+      real(kind=c_double), dimension(*), intent(in)  :: periods
+      integer(kind=c_int), value                     :: numberOfPeriods
+      real(kind=c_double), value                     :: damping
+    end subroutine
+
+    subroutine c_interoperability_enableEnergyOutput( interval, magnitudeMask ) bind( C, name='c_interoperability_enableEnergyOutput' )
+      use iso_c_binding
+      implicit none
+      real(kind=c_double), value  :: interval
+      integer(kind=c_int), value  :: magnitudeMask
+    end subroutine
+
     subroutine c_interoperability_enableCheckPointing( i_checkPointInterval, i_checkPointFilename, i_checkPointBackend ) bind( C, name='c_interoperability_enableCheckPointing' )
       use iso_c_binding
       implicit none
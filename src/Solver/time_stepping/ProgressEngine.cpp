@@ -0,0 +1,279 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Progress engine for the communication of the ghost and copy layers.
+ **/
+
+#ifdef USE_MPI
+
+#include "Parallel/MPI.h"
+
+#include "ProgressEngine.h"
+#include "TimeCluster.h"
+
+#include <Numerical_aux/Statistics.h>
+#include <Parallel/Pin.h>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <ctime>
+#include <sched.h>
+
+seissol::time_stepping::ProgressEngine::ProgressEngine():
+  m_numberOfClusters(0),
+  m_executeThread(false),
+  m_threadRunning(false),
+  m_spinIterations(1000),
+  m_maxBackoff(64),
+  m_numberOfTests(0),
+  m_numberOfCompletions(0),
+  m_numberOfSleeps(0),
+  m_threadCpuTime(0.0)
+{
+  m_lock.clear();
+}
+
+void seissol::time_stepping::ProgressEngine::init( unsigned int i_numberOfClusters ) {
+  m_numberOfClusters = i_numberOfClusters;
+  m_rings.reset( new CommandRing[i_numberOfClusters] );
+  m_pendingRequests.assign( NUM_OPERATIONS * i_numberOfClusters, 0 );
+  m_channelClusters.assign( NUM_OPERATIONS * i_numberOfClusters, NULL );
+
+  m_spinIterations = utils::Env::get<unsigned int>("SEISSOL_COMM_THREAD_SPIN", 1000);
+  m_maxBackoff = utils::Env::get<unsigned int>("SEISSOL_COMM_THREAD_MAX_BACKOFF", 64);
+}
+
+void seissol::time_stepping::ProgressEngine::submit( TimeCluster* i_cluster,
+                                                     Operation    i_operation,
+                                                     bool         i_allRegions ) {
+  Command l_command;
+  l_command.cluster    = i_cluster;
+  l_command.operation  = i_operation;
+  l_command.allRegions = i_allRegions;
+
+  // the ring only overflows if the consumer lags behind; help out in that case
+  while( !m_rings[i_cluster->m_clusterId].push( l_command ) ) {
+    tryProgress();
+  }
+}
+
+bool seissol::time_stepping::ProgressEngine::tryProgress() {
+  if( m_lock.test_and_set( std::memory_order_acquire ) ) {
+    // somebody else drives the engine
+    return false;
+  }
+
+  bool l_progress = progress();
+
+  m_lock.clear( std::memory_order_release );
+
+  return l_progress;
+}
+
+bool seissol::time_stepping::ProgressEngine::progress() {
+  bool l_posted = postCommands();
+  bool l_completed = testRequests();
+  return l_posted || l_completed;
+}
+
+bool seissol::time_stepping::ProgressEngine::postCommands() {
+  bool l_posted = false;
+
+  for( unsigned int l_cluster = 0; l_cluster < m_numberOfClusters; l_cluster++ ) {
+    Command l_command;
+    while( m_rings[l_cluster].pop( l_command ) ) {
+      unsigned int l_channel = NUM_OPERATIONS * l_cluster + l_command.operation;
+      m_channelClusters[l_channel] = l_command.cluster;
+
+      std::size_t l_first = m_requests.size();
+      if( l_command.operation == ReceiveGhostLayer ) {
+        l_command.cluster->receiveGhostLayer( l_command.allRegions, m_requests );
+      } else {
+        l_command.cluster->sendCopyLayer( l_command.allRegions, m_requests );
+      }
+
+      unsigned int l_numberOfRequests = m_requests.size() - l_first;
+      m_requestChannels.resize( m_requests.size(), l_channel );
+      m_pendingRequests[l_channel] += l_numberOfRequests;
+
+      // no communication in this step
+      if( m_pendingRequests[l_channel] == 0 ) {
+        complete( l_channel );
+      }
+
+      l_posted = true;
+    }
+  }
+
+  return l_posted;
+}
+
+bool seissol::time_stepping::ProgressEngine::testRequests() {
+  if( m_requests.empty() ) {
+    return false;
+  }
+
+  int l_numberOfCompleted = 0;
+  m_indices.resize( m_requests.size() );
+  MPI_Testsome( m_requests.size(), m_requests.data(), &l_numberOfCompleted, m_indices.data(), MPI_STATUSES_IGNORE );
+  ++m_numberOfTests;
+
+  if( l_numberOfCompleted == 0 || l_numberOfCompleted == MPI_UNDEFINED ) {
+    return false;
+  }
+
+  retireRequests( l_numberOfCompleted );
+
+  return true;
+}
+
+void seissol::time_stepping::ProgressEngine::retireRequests( int i_numberOfCompleted ) {
+  m_completed.assign( m_requests.size(), 0 );
+  for( int l_index = 0; l_index < i_numberOfCompleted; l_index++ ) {
+    m_completed[ m_indices[l_index] ] = 1;
+
+    unsigned int l_channel = m_requestChannels[ m_indices[l_index] ];
+    if( --m_pendingRequests[l_channel] == 0 ) {
+      complete( l_channel );
+    }
+  }
+  m_numberOfCompletions += i_numberOfCompleted;
+
+  // compact the pending requests
+  // (persistent requests are not set to MPI_REQUEST_NULL, hence we rely on the indices)
+  std::size_t l_pending = 0;
+  for( std::size_t l_request = 0; l_request < m_requests.size(); l_request++ ) {
+    if( !m_completed[l_request] ) {
+      m_requests[l_pending]        = m_requests[l_request];
+      m_requestChannels[l_pending] = m_requestChannels[l_request];
+      l_pending++;
+    }
+  }
+  m_requests.resize( l_pending );
+  m_requestChannels.resize( l_pending );
+}
+
+void seissol::time_stepping::ProgressEngine::complete( unsigned int i_channel ) {
+  m_channelClusters[i_channel]->completeCommunication( static_cast<Operation>(i_channel % NUM_OPERATIONS) );
+}
+
+void seissol::time_stepping::ProgressEngine::run() {
+  parallel::pinToFreeCPUs();
+
+  unsigned int l_idleIterations = 0;
+  unsigned int l_backoff = 1;
+
+  while( true ) {
+    // only the communication thread drives the engine; compute threads fail in tryProgress
+    while( m_lock.test_and_set( std::memory_order_acquire ) );
+    bool l_progress = progress();
+    bool l_finished = !m_executeThread.load( std::memory_order_acquire ) && m_requests.empty();
+    m_lock.clear( std::memory_order_release );
+
+    if( l_finished ) {
+      break;
+    }
+
+    if( l_progress ) {
+      l_idleIterations = 0;
+      l_backoff = 1;
+    } else if( ++l_idleIterations > m_spinIterations ) {
+      // back off exponentially: first yield, then sleep up to m_maxBackoff microseconds
+      if( l_backoff <= 1 || m_maxBackoff == 0 ) {
+        sched_yield();
+      } else {
+        struct timespec l_sleep;
+        l_sleep.tv_sec  = 0;
+        l_sleep.tv_nsec = 1000L * std::min( l_backoff, m_maxBackoff );
+        nanosleep( &l_sleep, NULL );
+        ++m_numberOfSleeps;
+      }
+      l_backoff = std::min( 2*l_backoff, std::max( m_maxBackoff, 1u ) );
+    }
+  }
+
+  struct timespec l_cpuTime;
+  clock_gettime( CLOCK_THREAD_CPUTIME_ID, &l_cpuTime );
+  m_threadCpuTime = l_cpuTime.tv_sec + 1.0e-9 * l_cpuTime.tv_nsec;
+}
+
+void seissol::time_stepping::ProgressEngine::startThread() {
+  m_executeThread.store( true, std::memory_order_release );
+  m_threadRunning = true;
+  pthread_create( &m_thread, NULL, static_run, this );
+}
+
+void seissol::time_stepping::ProgressEngine::stopThread() {
+  if( m_threadRunning ) {
+    m_executeThread.store( false, std::memory_order_release );
+    pthread_join( m_thread, NULL );
+    m_threadRunning = false;
+  } else {
+    // without communication thread: block until the remaining requests are finished
+    while( m_lock.test_and_set( std::memory_order_acquire ) );
+    postCommands();
+    while( !m_requests.empty() ) {
+      int l_numberOfCompleted = 0;
+      m_indices.resize( m_requests.size() );
+      MPI_Waitsome( m_requests.size(), m_requests.data(), &l_numberOfCompleted, m_indices.data(), MPI_STATUSES_IGNORE );
+      if( l_numberOfCompleted == MPI_UNDEFINED ) {
+        break;
+      }
+      retireRequests( l_numberOfCompleted );
+    }
+    m_lock.clear( std::memory_order_release );
+  }
+}
+
+void seissol::time_stepping::ProgressEngine::printStatistics() {
+  const int rank = MPI::mpi.rank();
+
+  const auto tests = seissol::statistics::parallelSummary( static_cast<double>(m_numberOfTests) );
+  const auto completions = seissol::statistics::parallelSummary( static_cast<double>(m_numberOfCompletions) );
+  logInfo(rank) << "Progress engine: MPI_Testsome calls per rank: mean =" << tests.mean << "max =" << tests.max
+                << ", completed requests per rank: mean =" << completions.mean << "max =" << completions.max;
+
+#ifdef USE_COMM_THREAD
+  const auto cpuTime = seissol::statistics::parallelSummary( m_threadCpuTime );
+  const auto sleeps = seissol::statistics::parallelSummary( static_cast<double>(m_numberOfSleeps) );
+  logInfo(rank) << "Communication thread CPU time: mean =" << cpuTime.mean
+                << " min =" << cpuTime.min
+                << " max =" << cpuTime.max
+                << "(backoff sleeps per rank: mean =" << sleeps.mean << ")";
+#endif
+}
+
+#endif // USE_MPI
@@ -0,0 +1,264 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Progress engine for the communication of the ghost and copy layers.
+ **/
+
+#ifndef PROGRESSENGINE_H_
+#define PROGRESSENGINE_H_
+
+#ifdef USE_MPI
+
+#include <mpi.h>
+#include <pthread.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace seissol {
+  namespace time_stepping {
+    class TimeCluster;
+    class ProgressEngine;
+  }
+}
+
+/**
+ * Progress engine for the communication of the ghost and copy layers.
+ *
+ * Clusters submit their communication requests into a lock-free ring (one per cluster).
+ * The engine posts the MPI requests, tests all pending requests of all clusters with a single
+ * MPI_Testsome and notifies the cluster once all requests of a communication step are finished.
+ *
+ * The engine is either driven by a dedicated communication thread (USE_COMM_THREAD), which backs off
+ * when idle, or by the compute threads, which donate cycles with tryProgress().
+ **/
+class seissol::time_stepping::ProgressEngine {
+  public:
+    enum Operation {
+      ReceiveGhostLayer = 0,
+      SendCopyLayer     = 1,
+      NUM_OPERATIONS
+    };
+
+  private:
+    struct Command {
+      TimeCluster* cluster;
+      Operation    operation;
+      //! true if all regions communicate (LTS buffers are reset/sent), false if only regions of the same or larger clusters
+      bool         allRegions;
+    };
+
+    /**
+     * Lock-free ring with a single producer (the thread computing the copy layer of the cluster)
+     * and a single consumer (the thread holding the progress lock).
+     **/
+    class CommandRing {
+      private:
+        //! every cluster has at most one pending receive and one pending send
+        static const unsigned Capacity = 4;
+
+        Command m_commands[Capacity];
+
+        //! next command to be read by the consumer
+        std::atomic<unsigned> m_head;
+
+        //! next free slot of the producer
+        std::atomic<unsigned> m_tail;
+
+      public:
+        CommandRing() : m_head(0), m_tail(0) {}
+
+        bool push( Command const& i_command ) {
+          unsigned l_tail = m_tail.load( std::memory_order_relaxed );
+          if( l_tail - m_head.load( std::memory_order_acquire ) == Capacity ) {
+            return false;
+          }
+          m_commands[l_tail % Capacity] = i_command;
+          m_tail.store( l_tail+1, std::memory_order_release );
+          return true;
+        }
+
+        bool pop( Command& o_command ) {
+          unsigned l_head = m_head.load( std::memory_order_relaxed );
+          if( l_head == m_tail.load( std::memory_order_acquire ) ) {
+            return false;
+          }
+          o_command = m_commands[l_head % Capacity];
+          m_head.store( l_head+1, std::memory_order_release );
+          return true;
+        }
+    };
+
+    //! number of clusters on this rank
+    unsigned int m_numberOfClusters;
+
+    //! command rings of the clusters
+    std::unique_ptr<CommandRing[]> m_rings;
+
+    /*
+     * State of the pending requests; only accessed while holding m_lock.
+     */
+    //! requests of all clusters
+    std::vector<MPI_Request> m_requests;
+
+    //! channel (2*cluster + operation) of each request
+    std::vector<unsigned int> m_requestChannels;
+
+    //! number of pending requests of each channel
+    std::vector<unsigned int> m_pendingRequests;
+
+    //! cluster of each channel
+    std::vector<TimeCluster*> m_channelClusters;
+
+    //! output buffer of MPI_Testsome
+    std::vector<int> m_indices;
+
+    //! true for requests which completed in the current test
+    std::vector<char> m_completed;
+
+    //! lock of the thread currently driving the engine
+    std::atomic_flag m_lock;
+
+    /*
+     * Communication thread
+     */
+    std::atomic<bool> m_executeThread;
+
+    bool m_threadRunning;
+
+    pthread_t m_thread;
+
+    //! number of idle iterations before the thread yields
+    unsigned int m_spinIterations;
+
+    //! maximum sleep time of the thread in microseconds
+    unsigned int m_maxBackoff;
+
+    /*
+     * Statistics
+     */
+    unsigned long m_numberOfTests;
+    unsigned long m_numberOfCompletions;
+    unsigned long m_numberOfSleeps;
+    double        m_threadCpuTime;
+
+    /**
+     * Posts new requests and tests the pending ones.
+     * The caller must hold m_lock.
+     *
+     * @return true if requests were posted or completed.
+     **/
+    bool progress();
+
+    /**
+     * Posts the requests of all submitted commands.
+     **/
+    bool postCommands();
+
+    /**
+     * Tests all pending requests and notifies the clusters about finished communication.
+     **/
+    bool testRequests();
+
+    /**
+     * Removes the completed requests (given by m_indices) and notifies the clusters.
+     **/
+    void retireRequests( int i_numberOfCompleted );
+
+    /**
+     * Notifies the cluster about the finished operation of a channel.
+     **/
+    void complete( unsigned int i_channel );
+
+    /**
+     * Main loop of the communication thread.
+     **/
+    void run();
+
+    static void* static_run( void* p ) {
+      static_cast<ProgressEngine*>(p)->run();
+      return NULL;
+    }
+
+  public:
+    ProgressEngine();
+
+    /**
+     * Allocates the command rings.
+     *
+     * @param i_numberOfClusters number of time clusters on this rank.
+     **/
+    void init( unsigned int i_numberOfClusters );
+
+    /**
+     * Submits a communication step of a cluster.
+     * The cluster is notified by TimeCluster::completeCommunication once all requests are finished.
+     *
+     * @param i_cluster cluster.
+     * @param i_operation receive of the ghost layer or send of the copy layer.
+     * @param i_allRegions true if all regions communicate, false if only the regions of same or larger clusters.
+     **/
+    void submit( TimeCluster* i_cluster,
+                 Operation    i_operation,
+                 bool         i_allRegions );
+
+    /**
+     * Drives the engine if no other thread does.
+     * Called by compute threads to donate cycles to the communication.
+     *
+     * @return true if requests were posted or completed.
+     **/
+    bool tryProgress();
+
+    /**
+     * Starts the communication thread.
+     **/
+    void startThread();
+
+    /**
+     * Stops the communication thread after all pending requests finished.
+     **/
+    void stopThread();
+
+    /**
+     * Prints statistics of the engine (collective operation).
+     **/
+    void printStatistics();
+};
+
+#endif // USE_MPI
+
+#endif
@@ -78,23 +78,35 @@
 #include "SeisSol.h"
 #include "TimeCluster.h"
 #include <Solver/Interoperability.h>
+#include <Initializer/LocalIntegrationBatches.h>
 #include <SourceTerm/PointSource.h>
 #include <Kernels/TimeCommon.h>
 #include <Kernels/DynamicRupture.h>
+#include <Kernels/LocalBatch.h>
 #include <Kernels/Receiver.h>
+#include <Solver/GroundMotionCluster.h>
 #include <Monitoring/FlopCounter.hpp>
+#include <Numerical_aux/ReducedPrecision.h>
+#include <yateto.h>
 
 #include <cassert>
 #include <cstring>
-
-#if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
-extern volatile unsigned int* volatile g_handleRecvs;
-extern volatile unsigned int* volatile g_handleSends;
-#endif
+#include <ctime>
 
 //! fortran interoperability
 extern seissol::Interoperability e_interoperability;
 
+/**
+ * Adds flops to one of the global flop counters.
+ * Phases of different clusters may run concurrently when using the task scheduler.
+ **/
+static inline void accumulateFlops( long long& counter, long long flops ) {
+#ifdef _OPENMP
+  #pragma omp atomic
+#endif
+  counter += flops;
+}
+
 seissol::time_stepping::TimeCluster::TimeCluster( unsigned int                   i_clusterId,
                                                   unsigned int                   i_globalClusterId,
                                                   struct MeshStructure          *i_meshStructure,
@@ -120,8 +132,18 @@ seissol::time_stepping::TimeCluster::TimeCluster( unsigned int
  m_numberOfCellToPointSourcesMappings(0                ),
  m_pointSources(            NULL                       ),
 
+ m_useTasks(                false                      ),
+#ifdef USE_MPI
+ m_progressEngine(          NULL                       ),
+ m_ghostLayerReceived(      true                       ),
+ m_copyLayerSent(           true                       ),
+ m_ghostLayerReceiveTime(   0.0                        ),
+ m_persistentCommunication( false                      ),
+#endif
+ m_taskChunkSize(           1                          ),
  m_loopStatistics(          i_loopStatistics           ),
- m_receiverCluster(          nullptr                   )
+ m_receiverCluster(          nullptr                   ),
+ m_groundMotionCluster(      nullptr                   )
 {
     // assert all pointers are valid
     assert( m_meshStructure                            != NULL );
@@ -145,6 +167,9 @@ seissol::time_stepping::TimeCluster::TimeCluster( unsigned int
   m_numberOfFullUpdates           = 0;
   m_fullUpdateTime                = 0;
   m_predictionTime                = 0;
+  m_faultOutputPending.store( false, std::memory_order_relaxed );
+  m_faultOutputTime               = 0;
+  m_faultOutputTimeStepWidth      = 0;
 
   m_dynamicRuptureFaces = (i_dynRupClusterData->child<Ghost>().getNumberOfCells() > 0)
 	|| (i_dynRupClusterData->child<Copy>().getNumberOfCells() > 0)
@@ -161,6 +186,10 @@ seissol::time_stepping::TimeCluster::TimeCluster( unsigned int
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
+  m_regionComputeReceivers = m_loopStatistics->getRegion("computeReceivers");
+#ifdef USE_MPI
+  m_regionGhostLayerDelay = m_loopStatistics->getRegion("ghostLayerDelay");
+#endif
 }
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
@@ -178,12 +207,55 @@ void seissol::time_stepping::TimeCluster::setPointSources( sourceterm::CellToPoi
   m_pointSources = i_pointSources;
 }
 
-void seissol::time_stepping::TimeCluster::writeReceivers() {
+void seissol::time_stepping::TimeCluster::writeReceivers( bool i_storedDerivatives ) {
   SCOREP_USER_REGION( "writeReceivers", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-  if (m_receiverCluster != nullptr) {
-    m_receiverTime = m_receiverCluster->calcReceivers(m_receiverTime, m_fullUpdateTime, m_timeStepWidth);
+  if (m_receiverCluster == nullptr) {
+    return;
+  }
+
+  Stopwatch stopwatch;
+  stopwatch.start();
+
+  double receiverTime = m_receiverCluster->prepareSamples(m_receiverTime, m_fullUpdateTime, m_timeStepWidth);
+  unsigned numberOfReceivers = m_receiverCluster->numberOfReceivers(i_storedDerivatives);
+
+  if (m_receiverCluster->numberOfSamples() > 0 && numberOfReceivers > 0) {
+    forEachCell(numberOfReceivers, [&](unsigned receiverBegin, unsigned receiverEnd) {
+      m_receiverCluster->calcReceivers(i_storedDerivatives, receiverBegin, receiverEnd);
+    });
+
+    long long nonZeroFlops, hardwareFlops;
+    m_receiverCluster->flopsReceivers(i_storedDerivatives, nonZeroFlops, hardwareFlops);
+    accumulateFlops(g_SeisSolNonZeroFlopsOther, nonZeroFlops);
+    accumulateFlops(g_SeisSolHardwareFlopsOther, hardwareFlops);
+
+    m_loopStatistics->addSample(m_regionComputeReceivers, numberOfReceivers, stopwatch.stop());
+    m_loopStatistics->addFlops(m_regionComputeReceivers, nonZeroFlops, hardwareFlops);
+  }
+
+  // the receivers with stored derivatives are evaluated last in the time step
+  if (i_storedDerivatives) {
+    m_receiverTime = receiverTime;
+  }
+}
+
+void seissol::time_stepping::TimeCluster::writeFaultOutput() {
+  e_interoperability.faultOutput( m_faultOutputTime, m_faultOutputTimeStepWidth );
+  m_faultOutputPending.store( false, std::memory_order_relaxed );
+}
+
+void seissol::time_stepping::TimeCluster::updateGroundMotion() {
+  SCOREP_USER_REGION( "updateGroundMotion", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  if (m_groundMotionCluster == nullptr) {
+    return;
   }
+
+  m_groundMotionCluster->prepare(m_timeStepWidth);
+  forEachCell(m_groundMotionCluster->numberOfFaces(), [&](unsigned faceBegin, unsigned faceEnd) {
+    m_groundMotionCluster->update(faceBegin, faceEnd);
+  });
 }
 
 void seissol::time_stepping::TimeCluster::computeSources() {
@@ -192,10 +264,8 @@ void seissol::time_stepping::TimeCluster::computeSources() {
   // Return when point sources not initialised. This might happen if there
   // are no point sources on this rank.
   if (m_numberOfCellToPointSourcesMappings != 0) {
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
-#endif
-    for (unsigned mapping = 0; mapping < m_numberOfCellToPointSourcesMappings; ++mapping) {
+    forEachCell(m_numberOfCellToPointSourcesMappings, [&](unsigned mappingBegin, unsigned mappingEnd) {
+    for (unsigned mapping = mappingBegin; mapping < mappingEnd; ++mapping) {
       unsigned startSource = m_cellToPointSources[mapping].pointSourcesOffset;
       unsigned endSource = m_cellToPointSources[mapping].pointSourcesOffset + m_cellToPointSources[mapping].numberOfPointSources;
       if (m_pointSources->mode == sourceterm::PointSources::NRF) {
@@ -220,54 +290,81 @@ void seissol::time_stepping::TimeCluster::computeSources() {
         }
       }
     }
+    });
   }
 }
 
 void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initializers::Layer&  layerData ) {
   SCOREP_USER_REGION( "computeDynamicRupture", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-  m_loopStatistics->begin(m_regionComputeDynamicRupture);
+  Stopwatch stopwatch;
+  stopwatch.start();
 
   DRFaceInformation*                    faceInformation                                                   = layerData.var(m_dynRup->faceInformation);
   DRGodunovData*                        godunovData                                                       = layerData.var(m_dynRup->godunovData);
   real**                                timeDerivativePlus                                                = layerData.var(m_dynRup->timeDerivativePlus);
   real**                                timeDerivativeMinus                                               = layerData.var(m_dynRup->timeDerivativeMinus);
+  real                                (*QInterpolatedPlus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()]  = layerData.var(m_dynRup->QInterpolatedPlus);
+  real                                (*QInterpolatedMinus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()] = layerData.var(m_dynRup->QInterpolatedMinus);
   real                                (*imposedStatePlus)[tensor::QInterpolated::size()]                  = layerData.var(m_dynRup->imposedStatePlus);
   real                                (*imposedStateMinus)[tensor::QInterpolated::size()]                 = layerData.var(m_dynRup->imposedStateMinus);
   seissol::model::IsotropicWaveSpeeds*  waveSpeedsPlus                                                    = layerData.var(m_dynRup->waveSpeedsPlus);
   seissol::model::IsotropicWaveSpeeds*  waveSpeedsMinus                                                   = layerData.var(m_dynRup->waveSpeedsMinus);
 
-  alignas(ALIGNMENT) real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
-  alignas(ALIGNMENT) real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
-
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static) private(QInterpolatedPlus,QInterpolatedMinus)
-#endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
-    unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
+  // the layer stores the interpolated states only for the C++ friction solver
+  bool const batched = (QInterpolatedPlus != nullptr);
+
+  forEachCell(layerData.getNumberOfCells(), [&](unsigned faceBegin, unsigned faceEnd) {
+  // derivatives of ghost cells stored in reduced precision
+  alignas(ALIGNMENT) real derivatives[yateto::computeFamilySize<tensor::dQ>()];
+  alignas(ALIGNMENT) real faceQInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+  alignas(ALIGNMENT) real faceQInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+
+  for (unsigned face = faceBegin; face < faceEnd; ++face) {
+    real const* derivativesPlus = timeDerivativePlus[face];
+    real const* derivativesMinus = timeDerivativeMinus[face];
+    if (faceInformation[face].plusSideReduced) {
+      reducedPrecision::decompress(reinterpret_cast<reduced_real const*>(derivativesPlus), yateto::computeFamilySize<tensor::dQ>(), derivatives);
+      derivativesPlus = derivatives;
+    } else if (faceInformation[face].minusSideReduced) {
+      reducedPrecision::decompress(reinterpret_cast<reduced_real const*>(derivativesMinus), yateto::computeFamilySize<tensor::dQ>(), derivatives);
+      derivativesMinus = derivatives;
+    }
     m_dynamicRuptureKernel.spaceTimeInterpolation(  faceInformation[face],
                                                     m_globalData,
                                                    &godunovData[face],
-                                                    timeDerivativePlus[face],
-                                                    timeDerivativeMinus[face],
-                                                    QInterpolatedPlus,
-                                                    QInterpolatedMinus,
-                                                    timeDerivativePlus[prefetchFace],
-                                                    timeDerivativeMinus[prefetchFace] );
-
-    e_interoperability.evaluateFrictionLaw( static_cast<int>(faceInformation[face].meshFace),
-                                            QInterpolatedPlus,
-                                            QInterpolatedMinus,
-                                            imposedStatePlus[face],
-                                            imposedStateMinus[face],
+                                                    derivativesPlus,
+                                                    derivativesMinus,
+                                                    batched ? QInterpolatedPlus[face] : faceQInterpolatedPlus,
+                                                    batched ? QInterpolatedMinus[face] : faceQInterpolatedMinus );
+
+    if (!batched) {
+      e_interoperability.evaluateFrictionLaw( static_cast<int>(faceInformation[face].meshFace),
+                                              faceQInterpolatedPlus,
+                                              faceQInterpolatedMinus,
+                                              imposedStatePlus[face],
+                                              imposedStateMinus[face],
+                                              m_fullUpdateTime,
+                                              m_dynamicRuptureKernel.timePoints,
+                                              m_dynamicRuptureKernel.timeWeights,
+                                              waveSpeedsPlus[face],
+                                              waveSpeedsMinus[face] );
+    }
+  }
+
+  if (batched) {
+    // friction law on all faces of the chunk
+    e_interoperability.evaluateFrictionLaw( layerData,
+                                           *m_dynRup,
+                                            faceBegin,
+                                            faceEnd,
                                             m_fullUpdateTime,
                                             m_dynamicRuptureKernel.timePoints,
-                                            m_dynamicRuptureKernel.timeWeights,
-                                            waveSpeedsPlus[face],
-                                            waveSpeedsMinus[face] );
+                                            m_dynamicRuptureKernel.timeWeights );
   }
+  });
 
-  m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells());
+  m_loopStatistics->addSample(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), stopwatch.stop());
 }
 
 
@@ -290,143 +387,201 @@ void seissol::time_stepping::TimeCluster::computeDynamicRuptureFlops( seissol::i
 }
 
 #ifdef USE_MPI
+/**
+ * Returns the current time (CLOCK_MONOTONIC) in seconds.
+ **/
+static double monotonicTime() {
+  struct timespec l_time;
+  clock_gettime( CLOCK_MONOTONIC, &l_time );
+  return l_time.tv_sec + 1.0e-9 * l_time.tv_nsec;
+}
+
 /*
  * MPI-Communication during the simulation; exchange of DOFs.
  */
-void seissol::time_stepping::TimeCluster::receiveGhostLayer(){
+void seissol::time_stepping::TimeCluster::initPersistentCommunication() {
+  for( unsigned int l_region = 0; l_region < m_meshStructure->numberOfRegions; l_region++ ) {
+    bool l_reduced = m_meshStructure->reducedGhostRegions != NULL;
+
+    MPI_Recv_init( l_reduced ? static_cast<void*>(m_meshStructure->reducedGhostRegions[l_region])
+                             : static_cast<void*>(m_meshStructure->ghostRegions[l_region]), // initial address
+                   m_meshStructure->ghostRegionSizes[l_region],            // number of elements in the receive buffer
+                   l_reduced ? MPI_C_REDUCED_REAL : MPI_C_REAL,            // datatype of each receive buffer element
+                   m_meshStructure->neighboringClusters[l_region][0],      // rank of source
+                   timeData+m_meshStructure->receiveIdentifiers[l_region], // message tag
+                   seissol::MPI::mpi.comm(),                               // communicator
+                   m_meshStructure->receiveRequests + l_region             // communication request
+                 );
+
+    MPI_Send_init( l_reduced ? static_cast<void*>(m_meshStructure->reducedCopyRegions[l_region])
+                             : static_cast<void*>(m_meshStructure->copyRegions[l_region]), // initial address
+                   m_meshStructure->copyRegionSizes[l_region],          // number of elements in the send buffer
+                   l_reduced ? MPI_C_REDUCED_REAL : MPI_C_REAL,         // datatype of each send buffer element
+                   m_meshStructure->neighboringClusters[l_region][0],   // rank of destination
+                   timeData+m_meshStructure->sendIdentifiers[l_region], // message tag
+                   seissol::MPI::mpi.comm(),                            // communicator
+                   m_meshStructure->sendRequests + l_region             // communication request
+                 );
+
+    // the handles are shared by both sets of requests
+    if( m_meshStructure->neighboringClusters[l_region][1] <= static_cast<int>(m_globalClusterId) ) {
+      m_persistentReceiveRequests[0].push_back( m_meshStructure->receiveRequests[l_region] );
+      m_persistentSendRequests[0].push_back( m_meshStructure->sendRequests[l_region] );
+    }
+    m_persistentReceiveRequests[1].push_back( m_meshStructure->receiveRequests[l_region] );
+    m_persistentSendRequests[1].push_back( m_meshStructure->sendRequests[l_region] );
+  }
+
+  m_persistentCommunication = true;
+}
+
+void seissol::time_stepping::TimeCluster::freePersistentCommunication() {
+  if( !m_persistentCommunication ) {
+    return;
+  }
+
+  for( unsigned int l_region = 0; l_region < m_meshStructure->numberOfRegions; l_region++ ) {
+    MPI_Request_free( m_meshStructure->receiveRequests + l_region );
+    MPI_Request_free( m_meshStructure->sendRequests + l_region );
+  }
+
+  for( unsigned int l_set = 0; l_set < 2; l_set++ ) {
+    m_persistentReceiveRequests[l_set].clear();
+    m_persistentSendRequests[l_set].clear();
+  }
+
+  m_persistentCommunication = false;
+}
+
+void seissol::time_stepping::TimeCluster::receiveGhostLayer( bool                      i_allRegions,
+                                                             std::vector<MPI_Request>& io_requests ){
   SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
 
+  if( m_persistentCommunication ) {
+    std::vector<MPI_Request>& l_requests = m_persistentReceiveRequests[i_allRegions ? 1 : 0];
+    if( !l_requests.empty() ) {
+      MPI_Startall( l_requests.size(), l_requests.data() );
+      io_requests.insert( io_requests.end(), l_requests.begin(), l_requests.end() );
+    }
+    return;
+  }
+
   /*
    * Receive data of the ghost regions
    */
   for( unsigned int l_region = 0; l_region < m_meshStructure->numberOfRegions; l_region++ ) {
     // continue only if the cluster qualifies for communication
-    if( m_resetLtsBuffers || m_meshStructure->neighboringClusters[l_region][1] <= static_cast<int>(m_globalClusterId) ) {
+    if( i_allRegions || m_meshStructure->neighboringClusters[l_region][1] <= static_cast<int>(m_globalClusterId) ) {
       // post receive request
-      MPI_Irecv(   m_meshStructure->ghostRegions[l_region],                // initial address
+      bool l_reduced = m_meshStructure->reducedGhostRegions != NULL;
+      MPI_Irecv(   l_reduced ? static_cast<void*>(m_meshStructure->reducedGhostRegions[l_region])
+                             : static_cast<void*>(m_meshStructure->ghostRegions[l_region]), // initial address
                    m_meshStructure->ghostRegionSizes[l_region],            // number of elements in the receive buffer
-                   MPI_C_REAL,                                               // datatype of each receive buffer element
+                   l_reduced ? MPI_C_REDUCED_REAL : MPI_C_REAL,            // datatype of each receive buffer element
                    m_meshStructure->neighboringClusters[l_region][0],      // rank of source
                    timeData+m_meshStructure->receiveIdentifiers[l_region], // message tag
                    seissol::MPI::mpi.comm(),                               // communicator
                    m_meshStructure->receiveRequests + l_region             // communication request
                );
 
-      // add receive request to list of receives
-      m_receiveQueue.push_back( m_meshStructure->receiveRequests + l_region );
+      // hand the request to the progress engine
+      io_requests.push_back( m_meshStructure->receiveRequests[l_region] );
     }
   }
 }
 
-void seissol::time_stepping::TimeCluster::sendCopyLayer(){
+void seissol::time_stepping::TimeCluster::sendCopyLayer( bool                      i_allRegions,
+                                                         std::vector<MPI_Request>& io_requests ){
   SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
 
+  if( m_persistentCommunication ) {
+    std::vector<MPI_Request>& l_requests = m_persistentSendRequests[i_allRegions ? 1 : 0];
+    if( !l_requests.empty() ) {
+      MPI_Startall( l_requests.size(), l_requests.data() );
+      io_requests.insert( io_requests.end(), l_requests.begin(), l_requests.end() );
+    }
+    return;
+  }
+
   /*
    * Send data of the copy regions
    */
   for( unsigned int l_region = 0; l_region < m_meshStructure->numberOfRegions; l_region++ ) {
-    if( m_sendLtsBuffers || m_meshStructure->neighboringClusters[l_region][1] <= static_cast<int>(m_globalClusterId) ) {
+    if( i_allRegions || m_meshStructure->neighboringClusters[l_region][1] <= static_cast<int>(m_globalClusterId) ) {
       // post send request
-      MPI_Isend(   m_meshStructure->copyRegions[l_region],              // initial address
+      bool l_reduced = m_meshStructure->reducedCopyRegions != NULL;
+      MPI_Isend(   l_reduced ? static_cast<void*>(m_meshStructure->reducedCopyRegions[l_region])
+                             : static_cast<void*>(m_meshStructure->copyRegions[l_region]), // initial address
                    m_meshStructure->copyRegionSizes[l_region],          // number of elements in the send buffer
-                   MPI_C_REAL,                                            // datatype of each send buffer element
+                   l_reduced ? MPI_C_REDUCED_REAL : MPI_C_REAL,         // datatype of each send buffer element
                    m_meshStructure->neighboringClusters[l_region][0],   // rank of destination
                    timeData+m_meshStructure->sendIdentifiers[l_region], // message tag
                    seissol::MPI::mpi.comm(),                            // communicator
                    m_meshStructure->sendRequests + l_region             // communication request
                );
 
-      // add send request to list of sends
-      m_sendQueue.push_back(m_meshStructure->sendRequests + l_region );
+      // hand the request to the progress engine
+      io_requests.push_back( m_meshStructure->sendRequests[l_region] );
     }
   }
 }
 
-bool seissol::time_stepping::TimeCluster::testForGhostLayerReceives(){
-  SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
+void seissol::time_stepping::TimeCluster::packCopyLayer( bool i_allRegions ) {
+  SCOREP_USER_REGION( "packCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-#if defined(_OPENMP) && defined(USE_COMM_THREAD)
-  bool l_return;
-  if (g_handleRecvs[m_clusterId] == 0) {
-    l_return = true;
-  } else {
-    l_return = false;
+  if( m_meshStructure->reducedCopyRegions == NULL ) {
+    return;
   }
-  return l_return;
-#else
-  // iterate over all pending receives
-  for( std::list<MPI_Request*>::iterator l_receive = m_receiveQueue.begin(); l_receive != m_receiveQueue.end(); ) {
-    int l_mpiStatus = 0;
-
-    // check if the receive is complete
-    MPI_Test( *l_receive, &l_mpiStatus, MPI_STATUS_IGNORE );
 
-    // remove from list of pending receives if completed
-    if( l_mpiStatus == 1 )   l_receive = m_receiveQueue.erase( l_receive );
-    // continue otherwise
-    else                   ++l_receive;
+  for( unsigned int l_region = 0; l_region < m_meshStructure->numberOfRegions; l_region++ ) {
+    // same regions as in sendCopyLayer
+    if( i_allRegions || m_meshStructure->neighboringClusters[l_region][1] <= static_cast<int>(m_globalClusterId) ) {
+      real const* l_copyRegion = m_meshStructure->copyRegions[l_region];
+      reduced_real* l_reducedRegion = m_meshStructure->reducedCopyRegions[l_region];
+      forEachCell( m_meshStructure->copyRegionSizes[l_region], [&](unsigned l_begin, unsigned l_end) {
+        reducedPrecision::compress( l_copyRegion + l_begin, l_end - l_begin, l_reducedRegion + l_begin );
+      });
+    }
   }
-
-  // return true if the communication is finished
-  return m_receiveQueue.empty();
-#endif
 }
 
-bool seissol::time_stepping::TimeCluster::testForCopyLayerSends(){
-  SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
-
-#if defined(_OPENMP) && defined(USE_COMM_THREAD)
-  bool l_return;
-  if (g_handleSends[m_clusterId] == 0) {
-    l_return = true;
+void seissol::time_stepping::TimeCluster::completeCommunication( ProgressEngine::Operation i_operation ) {
+  if( i_operation == ProgressEngine::ReceiveGhostLayer ) {
+    m_ghostLayerReceiveTime = monotonicTime();
+    m_ghostLayerReceived.store( true, std::memory_order_release );
   } else {
-    l_return = false;
+    m_copyLayerSent.store( true, std::memory_order_release );
   }
-  return l_return;
-#else
-  for( std::list<MPI_Request*>::iterator l_send = m_sendQueue.begin(); l_send != m_sendQueue.end(); ) {
-    int l_mpiStatus = 0;
+}
 
-    // check if the send is complete
-    MPI_Test( *l_send, &l_mpiStatus, MPI_STATUS_IGNORE );
+bool seissol::time_stepping::TimeCluster::testForGhostLayerReceives(){
+  SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-    // remove from list of pending sends if completed
-    if( l_mpiStatus == 1 )   l_send = m_sendQueue.erase( l_send );
-    // continue otherwise
-    else                   ++l_send;
+  // donate cycles to the communication if no communication thread is running
+  if( !m_ghostLayerReceived.load( std::memory_order_acquire ) ) {
+    m_progressEngine->tryProgress();
   }
 
-  // return true if the communication is finished
-  return m_sendQueue.empty();
-#endif
+  return m_ghostLayerReceived.load( std::memory_order_acquire );
 }
 
-#if defined(_OPENMP) && defined(USE_COMM_THREAD)
-void seissol::time_stepping::TimeCluster::initReceiveGhostLayer(){
-  g_handleRecvs[m_clusterId] = 1;
-}
+bool seissol::time_stepping::TimeCluster::testForCopyLayerSends(){
+  SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-void seissol::time_stepping::TimeCluster::initSendCopyLayer(){
-  g_handleSends[m_clusterId] = 1;
-}
+  // donate cycles to the communication if no communication thread is running
+  if( !m_copyLayerSent.load( std::memory_order_acquire ) ) {
+    m_progressEngine->tryProgress();
+  }
 
-void seissol::time_stepping::TimeCluster::waitForInits() {
-  while( g_handleRecvs[m_clusterId] == 1 || g_handleSends[m_clusterId] == 1 );
+  return m_copyLayerSent.load( std::memory_order_acquire );
 }
 #endif
 
-#endif
-
 void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::initializers::Layer&  i_layerData ) {
   SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-  m_loopStatistics->begin(m_regionComputeLocalIntegration);
-
-  // local integration buffer
-  real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
-
-  // pointer for the call of the ADER-function
-  real* l_bufferPointer;
+  Stopwatch stopwatch;
+  stopwatch.start();
 
   real** buffers = i_layerData.var(m_lts->buffers);
   real** derivatives = i_layerData.var(m_lts->derivatives);
@@ -435,12 +590,79 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::init
 
   kernels::LocalData::Loader loader;
   loader.load(*m_lts, i_layerData);
+
+#ifdef LOCAL_BATCH_SIZE
+  CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
+  real (*dofs)[tensor::Q::size()] = i_layerData.var(m_lts->dofs);
+  unsigned numberOfBatches = i_layerData.getBucketSize(m_lts->localIntegrationBatches) / sizeof(LocalIntegrationBatch);
+  LocalIntegrationBatch* batches = (numberOfBatches > 0) ? static_cast<LocalIntegrationBatch*>(i_layerData.bucket(m_lts->localIntegrationBatches)) : nullptr;
+
+  forEachCell(numberOfBatches, [&](unsigned batchBegin, unsigned batchEnd) {
+  alignas(ALIGNMENT) real l_batchedDofs[tensor::batchedQ::size()];
+  alignas(ALIGNMENT) real l_batchedTimeIntegrated[tensor::batchedI::size()];
+  alignas(ALIGNMENT) real l_integrationBuffer[tensor::I::size()];
+
+  for (unsigned l_batch = batchBegin; l_batch < batchEnd; ++l_batch) {
+    LocalIntegrationBatch const& batch = batches[l_batch];
+
+    // idle lanes compute on zeros
+    if (batch.numberOfCells < LOCAL_BATCH_SIZE) {
+      std::fill_n(l_batchedDofs, tensor::batchedQ::size(), static_cast<real>(0.0));
+    }
+    for (unsigned l_lane = 0; l_lane < batch.numberOfCells; ++l_lane) {
+      kernels::gatherToBatch(dofs[batch.cells[l_lane]], l_lane, l_batchedDofs);
+    }
+
+    m_timeKernel.computeBatchedAder(m_timeStepWidth, batch, l_batchedDofs, l_batchedTimeIntegrated);
+    m_localKernel.computeBatchedIntegral(l_batchedTimeIntegrated, batch, l_batchedDofs);
+
+    for (unsigned l_lane = 0; l_lane < batch.numberOfCells; ++l_lane) {
+      unsigned l_cell = batch.cells[l_lane];
+      kernels::scatterFromBatch(l_batchedDofs, l_lane, dofs[l_cell]);
+
+      bool l_buffersProvided = (cellInformation[l_cell].ltsSetup >> 8)%2 == 1;
+      bool l_resetBuffers = l_buffersProvided && ( (cellInformation[l_cell].ltsSetup >> 10) %2 == 0 || m_resetLtsBuffers );
+
+      // I has the same layout as Q
+      real* l_bufferPointer = l_resetBuffers ? buffers[l_cell] : l_integrationBuffer;
+      kernels::scatterFromBatch(l_batchedTimeIntegrated, l_lane, l_bufferPointer);
+
+      if (displacements[l_cell] != nullptr) {
+        kernel::addVelocity krnl;
+        krnl.I = l_bufferPointer;
+        krnl.selectVelocity = init::selectVelocity::Values;
+        krnl.displacement = displacements[l_cell];
+        krnl.execute();
+      }
+
+      if (!l_resetBuffers && l_buffersProvided) {
+        assert (buffers[l_cell] != nullptr);
+
+        for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
+          buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
+        }
+      }
+    }
+  }
+  });
+#endif
+
+  forEachCell(i_layerData.getNumberOfCells(), [&](unsigned cellBegin, unsigned cellEnd) {
+  // local integration buffer
+  real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
+
+  // pointer for the call of the ADER-function
+  real* l_bufferPointer;
+
   kernels::LocalTmp tmp;
 
-#ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer, tmp) schedule(static)
+  for( unsigned int l_cell = cellBegin; l_cell < cellEnd; l_cell++ ) {
+#ifdef LOCAL_BATCH_SIZE
+    // computed in a batch
+    if (numberOfBatches > 0 && seissol::initializers::isLocalBatchCell(cellInformation[l_cell])) {
+      continue;
+    }
 #endif
-  for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
     auto data = loader.entry(l_cell);
     // overwrite cell buffer
     // TODO: Integrate this step into the kernel
@@ -494,14 +716,16 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::init
       }
     }
   }
+  });
 
-  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells());
+  m_loopStatistics->addSample(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), stopwatch.stop());
 }
 
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData ) {
   SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-  m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
+  Stopwatch stopwatch;
+  stopwatch.start();
 
   real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
   CellDRMapping (*drMapping)[4] = i_layerData.var(m_lts->drMapping);
@@ -515,17 +739,14 @@ void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol
   kernels::NeighborData::Loader loader;
   loader.load(*m_lts, i_layerData);
 
+  forEachCell(i_layerData.getNumberOfCells(), [&](unsigned cellBegin, unsigned cellEnd) {
   real *l_timeIntegrated[4];
   real *l_faceNeighbors_prefetch[4];
-
-#ifdef _OPENMP
 #ifdef USE_PLASTICITY
-  #pragma omp parallel for schedule(static) private(l_timeIntegrated, l_faceNeighbors_prefetch) reduction(+:numberOTetsWithPlasticYielding)
-#else
-  #pragma omp parallel for schedule(static) private(l_timeIntegrated, l_faceNeighbors_prefetch)
+  unsigned chunkTetsWithPlasticYielding = 0;
 #endif
-#endif
-  for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
+
+  for( unsigned int l_cell = cellBegin; l_cell < cellEnd; l_cell++ ) {
     auto data = loader.entry(l_cell);
     seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
                                                    data.cellInformation.ltsSetup,
@@ -572,7 +793,7 @@ void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol
                                                );
 
 #ifdef USE_PLASTICITY
-  numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_relaxTime,
+  chunkTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_relaxTime,
                                                                                      m_timeStepWidth,
                                                                                      m_globalData,
                                                                                      &plasticity[l_cell],
@@ -587,12 +808,20 @@ void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol
 #endif // INTEGRATE_QUANTITIES
   }
 
+#ifdef USE_PLASTICITY
+#ifdef _OPENMP
+  #pragma omp atomic
+#endif
+  numberOTetsWithPlasticYielding += chunkTetsWithPlasticYielding;
+#endif
+  });
+
   #ifdef USE_PLASTICITY
-  g_SeisSolNonZeroFlopsPlasticity += i_layerData.getNumberOfCells() * m_flops_nonZero[PlasticityCheck] + numberOTetsWithPlasticYielding * m_flops_nonZero[PlasticityYield];
-  g_SeisSolHardwareFlopsPlasticity += i_layerData.getNumberOfCells() * m_flops_hardware[PlasticityCheck] + numberOTetsWithPlasticYielding * m_flops_hardware[PlasticityYield];
+  accumulateFlops(g_SeisSolNonZeroFlopsPlasticity, i_layerData.getNumberOfCells() * m_flops_nonZero[PlasticityCheck] + numberOTetsWithPlasticYielding * m_flops_nonZero[PlasticityYield]);
+  accumulateFlops(g_SeisSolHardwareFlopsPlasticity, i_layerData.getNumberOfCells() * m_flops_hardware[PlasticityCheck] + numberOTetsWithPlasticYielding * m_flops_hardware[PlasticityYield]);
   #endif
 
-  m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells());
+  m_loopStatistics->addSample(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), stopwatch.stop());
 }
 
 #ifdef USE_MPI
@@ -610,36 +839,35 @@ bool seissol::time_stepping::TimeCluster::computeLocalCopy(){
   if( !testForCopyLayerSends() ) return false;
 
   // post receive requests
-#if defined(_OPENMP) && defined(USE_COMM_THREAD)
-  initReceiveGhostLayer();
-#else
-  receiveGhostLayer();
-#endif
+  m_ghostLayerReceived.store( false, std::memory_order_relaxed );
+  m_progressEngine->submit( this, ProgressEngine::ReceiveGhostLayer, m_resetLtsBuffers );
+  // post the receives before the computation if no communication thread does
+  m_progressEngine->tryProgress();
 
   // MPI checks for receiver writes receivers either in the copy layer or interior
   if( m_updatable.localInterior ) {
-    writeReceivers();
+    writeReceivers( false );
   }
 
   // integrate copy layer locally
   computeLocalIntegration( m_clusterData->child<Copy>() );
 
-  g_SeisSolNonZeroFlopsLocal += m_flops_nonZero[LocalCopy];
-  g_SeisSolHardwareFlopsLocal += m_flops_hardware[LocalCopy];
+  accumulateFlops(g_SeisSolNonZeroFlopsLocal, m_flops_nonZero[LocalCopy]);
+  accumulateFlops(g_SeisSolHardwareFlopsLocal, m_flops_hardware[LocalCopy]);
 
-#if defined(_OPENMP) && defined(USE_COMM_THREAD)
-  initSendCopyLayer();
-#else
-  sendCopyLayer();
-#endif
+  // convert the copy layer to reduced precision if required
+  packCopyLayer( m_sendLtsBuffers );
+
+  // post send requests
+  m_copyLayerSent.store( false, std::memory_order_relaxed );
+  m_progressEngine->submit( this, ProgressEngine::SendCopyLayer, m_sendLtsBuffers );
 
-#ifndef USE_COMM_THREAD
   // continue with communication
   testForGhostLayerReceives();
-#endif
 
   // compute sources, update simulation time
   if( !m_updatable.localInterior ) {
+    writeReceivers( true );
     computeSources();
     m_predictionTime += m_timeStepWidth;
   }
@@ -647,11 +875,6 @@ bool seissol::time_stepping::TimeCluster::computeLocalCopy(){
   // update finished
   m_updatable.localCopy  = false;
 
-  // wait until communication thread finished initializing the receives
-#if defined(_OPENMP) && defined(USE_COMM_THREAD)
-  waitForInits();
-#endif
-
   return true;
 }
 #endif
@@ -669,29 +892,31 @@ void seissol::time_stepping::TimeCluster::computeLocalInterior(){
   // MPI checks for receiver writes receivers either in the copy layer or interior
 #ifdef USE_MPI
   if( m_updatable.localCopy ) {
-    writeReceivers();
+    writeReceivers( false );
   }
 #else
   // non-MPI checks for write in the interior
-  writeReceivers();
+  writeReceivers( false );
 #endif
 
   // integrate interior cells locally
   computeLocalIntegration( m_clusterData->child<Interior>() );
 
-  g_SeisSolNonZeroFlopsLocal += m_flops_nonZero[LocalInterior];
-  g_SeisSolHardwareFlopsLocal += m_flops_hardware[LocalInterior];
+  accumulateFlops(g_SeisSolNonZeroFlopsLocal, m_flops_nonZero[LocalInterior]);
+  accumulateFlops(g_SeisSolHardwareFlopsLocal, m_flops_hardware[LocalInterior]);
 
 #ifdef USE_MPI
-#ifndef USE_COMM_THREAD
   // continue with communication
-  testForGhostLayerReceives();
-  testForCopyLayerSends();
-#endif
+  // (the task scheduler executes interiors on worker threads and progresses MPI on the master thread)
+  if( !m_useTasks ) {
+    testForGhostLayerReceives();
+    testForCopyLayerSends();
+  }
 #endif
 
   // compute sources, update simulation time
   if( !m_updatable.localCopy ) {
+    writeReceivers( true );
     computeSources();
     m_predictionTime += m_timeStepWidth;
   }
@@ -714,43 +939,50 @@ bool seissol::time_stepping::TimeCluster::computeNeighboringCopy() {
   // continue only of ghost layer receives are complete
   if( !testForGhostLayerReceives() ) return false;
 
-#ifndef USE_COMM_THREAD
+  // delay between the completion of the receives and the start of the dependent update
+  m_loopStatistics->addSample( m_regionGhostLayerDelay, 1, monotonicTime() - m_ghostLayerReceiveTime );
+
   // continue with communication
   testForCopyLayerSends();
-#endif
 
   if (m_dynamicRuptureFaces == true) {
     if (m_updatable.neighboringInterior) {
       computeDynamicRupture(m_dynRupClusterData->child<Interior>());
-      g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRFrictionLawInterior];
-      g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRFrictionLawInterior];
+      accumulateFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[DRFrictionLawInterior]);
+      accumulateFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[DRFrictionLawInterior]);
     }
 
     computeDynamicRupture(m_dynRupClusterData->child<Copy>());
-    g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRFrictionLawCopy];
-    g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRFrictionLawCopy];
+    accumulateFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[DRFrictionLawCopy]);
+    accumulateFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[DRFrictionLawCopy]);
   }
 
   computeNeighboringIntegration( m_clusterData->child<Copy>() );
 
-  g_SeisSolNonZeroFlopsNeighbor += m_flops_nonZero[NeighborCopy];
-  g_SeisSolHardwareFlopsNeighbor += m_flops_hardware[NeighborCopy];
-  g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRNeighborCopy];
-  g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRNeighborCopy];
+  accumulateFlops(g_SeisSolNonZeroFlopsNeighbor, m_flops_nonZero[NeighborCopy]);
+  accumulateFlops(g_SeisSolHardwareFlopsNeighbor, m_flops_hardware[NeighborCopy]);
+  accumulateFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[DRNeighborCopy]);
+  accumulateFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[DRNeighborCopy]);
 
-#ifndef USE_COMM_THREAD
   // continue with communication
   testForCopyLayerSends();
-#endif
 
   // compute dynamic rupture, update simulation time and statistics
   if( !m_updatable.neighboringInterior ) {
     // First cluster calls fault receiver output
-    // TODO: Change from iteration based to time based
+    // (time based output is sampled independently of the iterations)
     if (m_clusterId == 0) {
-      e_interoperability.faultOutput( m_fullUpdateTime, m_timeStepWidth );
+      m_faultOutputTime          = m_fullUpdateTime;
+      m_faultOutputTimeStepWidth = m_timeStepWidth;
+      // publishes the output time to the master thread
+      m_faultOutputPending.store( true, std::memory_order_release );
+      if (!m_useTasks) {
+        writeFaultOutput();
+      }
     }
 
+    updateGroundMotion();
+
     m_fullUpdateTime      += m_timeStepWidth;
     m_subTimeStart        += m_timeStepWidth;
     m_numberOfFullUpdates += 1;
@@ -775,26 +1007,34 @@ void seissol::time_stepping::TimeCluster::computeNeighboringInterior() {
 
   if (m_dynamicRuptureFaces == true && m_updatable.neighboringCopy == true) {
     computeDynamicRupture(m_dynRupClusterData->child<Interior>());
-    g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRFrictionLawInterior];
-    g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRFrictionLawInterior];
+    accumulateFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[DRFrictionLawInterior]);
+    accumulateFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[DRFrictionLawInterior]);
   }
 
   // Update all cells in the interior with the neighboring boundary contribution.
   computeNeighboringIntegration( m_clusterData->child<Interior>() );
 
-  g_SeisSolNonZeroFlopsNeighbor += m_flops_nonZero[NeighborInterior];
-  g_SeisSolHardwareFlopsNeighbor += m_flops_hardware[NeighborInterior];
-  g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRNeighborInterior];
-  g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRNeighborInterior];
+  accumulateFlops(g_SeisSolNonZeroFlopsNeighbor, m_flops_nonZero[NeighborInterior]);
+  accumulateFlops(g_SeisSolHardwareFlopsNeighbor, m_flops_hardware[NeighborInterior]);
+  accumulateFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[DRNeighborInterior]);
+  accumulateFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[DRNeighborInterior]);
 
   // compute dynamic rupture, update simulation time and statistics
   if( !m_updatable.neighboringCopy ) {
     // First cluster calls fault receiver output
-    // TODO: Change from iteration based to time based
+    // (time based output is sampled independently of the iterations)
     if (m_clusterId == 0) {
-      e_interoperability.faultOutput( m_fullUpdateTime, m_timeStepWidth );
+      m_faultOutputTime          = m_fullUpdateTime;
+      m_faultOutputTimeStepWidth = m_timeStepWidth;
+      // publishes the output time to the master thread
+      m_faultOutputPending.store( true, std::memory_order_release );
+      if (!m_useTasks) {
+        writeFaultOutput();
+      }
     }
 
+    updateGroundMotion();
+
     m_fullUpdateTime      += m_timeStepWidth;
     m_subTimeStart        += m_timeStepWidth;
     m_numberOfFullUpdates += 1;
@@ -899,50 +1139,3 @@ void seissol::time_stepping::TimeCluster::computeFlops()
                                                   m_flops_hardware[PlasticityYield] );
 }
 
-#if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
-void seissol::time_stepping::TimeCluster::pollForCopyLayerSends(){
-  for( std::list<MPI_Request*>::iterator l_send = m_sendQueue.begin(); l_send != m_sendQueue.end(); ) {
-    int l_mpiStatus = 0;
-
-    // check if the send is complete
-    MPI_Test( *l_send, &l_mpiStatus, MPI_STATUS_IGNORE );
-
-    // remove from list of pending sends if completed
-    if( l_mpiStatus == 1 )   l_send = m_sendQueue.erase( l_send );
-    // continue otherwise
-    else                   ++l_send;
-  }
-
-  if (m_sendQueue.empty()) {
-    g_handleSends[m_clusterId] = 0;
-  }
-}
-
-void seissol::time_stepping::TimeCluster::pollForGhostLayerReceives(){
-  // iterate over all pending receives
-  for( std::list<MPI_Request*>::iterator l_receive = m_receiveQueue.begin(); l_receive != m_receiveQueue.end(); ) {
-    int l_mpiStatus = 0;
-
-    // check if the receive is complete
-    MPI_Test( *l_receive, &l_mpiStatus, MPI_STATUS_IGNORE );
-
-    // remove from list of pending receives if completed
-    if( l_mpiStatus == 1 )   l_receive = m_receiveQueue.erase( l_receive );
-    // continue otherwise
-    else                   ++l_receive;
-  }
-
-  if (m_receiveQueue.empty()) {
-    g_handleRecvs[m_clusterId] = 0;
-  }
-}
-
-void seissol::time_stepping::TimeCluster::startReceiveGhostLayer() {
-  receiveGhostLayer();
-}
-
-void seissol::time_stepping::TimeCluster::startSendCopyLayer() {
-  sendCopyLayer();
-}
-#endif
-
@@ -73,7 +73,8 @@
 
 #ifdef USE_MPI
 #include <mpi.h>
-#include <list>
+#include <atomic>
+#include <vector>
 #endif
 
 #include <Initializer/typedefs.hpp>
@@ -89,6 +90,10 @@
 #include <Kernels/Plasticity.h>
 #include <Solver/FreeSurfaceIntegrator.h>
 #include <Monitoring/LoopStatistics.h>
+#include <Parallel/LoopSchedule.h>
+#include <Solver/time_stepping/ProgressEngine.h>
+
+#include <algorithm>
 
 namespace seissol {
   namespace time_stepping {
@@ -98,6 +103,10 @@ namespace seissol {
   namespace kernels {
     class ReceiverCluster;
   }
+
+  namespace solver {
+    class GroundMotionCluster;
+  }
 }
 
 /**
@@ -145,12 +154,29 @@ private:
      * element data and mpi queues
      */     
 #ifdef USE_MPI
-    //! pending copy region sends
-    std::list< MPI_Request* > m_sendQueue;
+    //! progress engine of the ghost and copy layer communication
+    ProgressEngine* m_progressEngine;
+
+    //! true if the ghost layer receives of the last communication step are finished
+    std::atomic<bool> m_ghostLayerReceived;
+
+    //! true if the copy layer sends of the last communication step are finished
+    std::atomic<bool> m_copyLayerSent;
+
+    //! time (CLOCK_MONOTONIC, in seconds) at which the ghost layer receives finished
+    double m_ghostLayerReceiveTime;
+
+    //! true if the communication uses persistent requests
+    bool m_persistentCommunication;
+
+    /*
+     * Persistent requests of the ghost and copy layer communication.
+     * [0]: regions of the same or larger clusters, [1]: all regions.
+     */
+    std::vector<MPI_Request> m_persistentReceiveRequests[2];
+    std::vector<MPI_Request> m_persistentSendRequests[2];
+#endif
 
-    //! pending ghost region receives
-    std::list< MPI_Request* > m_receiveQueue;
-#endif    
     seissol::initializers::TimeCluster* m_clusterData;
     seissol::initializers::TimeCluster* m_dynRupClusterData;
     seissol::initializers::LTS*         m_lts;
@@ -195,58 +221,61 @@ private:
     
     //! Relax time for plasticity
     double m_relaxTime;
+
+    //! true if the phases of this cluster are executed as tasks by the task scheduler of the time manager
+    bool m_useTasks;
+
+    //! maximum number of cells per task if m_useTasks is set
+    unsigned m_taskChunkSize;
     
     //! Stopwatch of TimeManager
     LoopStatistics* m_loopStatistics;
     unsigned        m_regionComputeLocalIntegration;
     unsigned        m_regionComputeNeighboringIntegration;
     unsigned        m_regionComputeDynamicRupture;
+    unsigned        m_regionComputeReceivers;
+#ifdef USE_MPI
+    unsigned        m_regionGhostLayerDelay;
+#endif
 
     kernels::ReceiverCluster* m_receiverCluster;
 
-#ifdef USE_MPI
-    /**
-     * Receives the copy layer data from relevant neighboring MPI clusters.
-     **/
-    void receiveGhostLayer();
-
-    /**
-     * Sends the associated regions of the copy layer to relevant neighboring MPI clusters
-     **/
-    void sendCopyLayer();
+    //! ground motion summary of the free surface faces of this cluster
+    solver::GroundMotionCluster* m_groundMotionCluster;
 
-#if defined(_OPENMP) && defined(USE_COMM_THREAD)
+#ifdef USE_MPI
     /**
-     * Inits Receives the copy layer data from relevant neighboring MPI clusters, active when using communication thread
+     * Tests for pending ghost layer communication.
      **/
-    void initReceiveGhostLayer();
+    bool testForGhostLayerReceives();
 
     /**
-     * Inits Sends the associated regions of the copy layer to relevant neighboring MPI clusters, active when using communication thread
+     * Tests for pending copy layer communication.
      **/
-    void initSendCopyLayer();
+    bool testForCopyLayerSends();
 
     /**
-     * Waits until the initialization of the communication is finished.
+     * Converts the copy regions to be sent to reduced precision (if the ghost layer is stored in reduced precision).
+     *
+     * @param i_allRegions true if all regions communicate (LTS buffers are sent).
      **/
-    void waitForInits();
+    void packCopyLayer( bool i_allRegions );
 #endif
 
     /**
-     * Tests for pending ghost layer communication.
-     **/
-    bool testForGhostLayerReceives();
-
-    /**
-     * Tests for pending copy layer communication.
+     * Writes the receiver output if applicable (receivers present, receivers have to be written).
+     * The receivers in cells without stored time derivatives are evaluated before the local integration,
+     * the others after the local integration of the copy layer and the interior.
+     *
+     * @param i_storedDerivatives true if the receivers with time derivatives of the local integration are evaluated.
      **/
-    bool testForCopyLayerSends();
-#endif
+    void writeReceivers( bool i_storedDerivatives );
 
     /**
-     * Writes the receiver output if applicable (receivers present, receivers have to be written).
+     * Updates the ground motion summary of the free surface faces with the state at the end of the time step.
+     * Has to be called after the copy layer and the interior have been updated.
      **/
-    void writeReceivers();
+    void updateGroundMotion();
 
     /**
      * Computes the source terms if applicable.
@@ -311,6 +340,20 @@ private:
                                           
     void computeFlops();
     
+    /**
+     * Calls body(begin, end) for all cells (or faces) [0, numberOfCells) of a layer.
+     * Uses the static OpenMP schedule or, if the cluster is executed by the task scheduler,
+     * tasks of at most m_taskChunkSize cells, which are picked up by idle threads.
+     **/
+    template<typename Body>
+    void forEachCell( unsigned numberOfCells, Body body ) {
+      if (m_useTasks) {
+        parallel::forChunks(numberOfCells, m_taskChunkSize, body);
+      } else {
+        parallel::forStatic(numberOfCells, body);
+      }
+    }
+
     //! Update relax time for plasticity
     void updateRelaxTime() {
       m_relaxTime = (m_tv > 0.0) ? 1.0 - exp(-m_timeStepWidth / m_tv) : 1.0;
@@ -366,6 +409,18 @@ private:
     //! time of the next receiver output
     double m_receiverTime;
 
+    /**
+     * True if the fault output of the last full update of this cluster has not been written yet.
+     * In task mode, the fault output is deferred to the master thread of the time manager,
+     * which writes it once no other task modifies the dynamic rupture state.
+     * Set by the task with release semantics, such that the master thread sees the output time.
+     **/
+    std::atomic<bool> m_faultOutputPending;
+
+    //! time and time step width of the pending fault output
+    double m_faultOutputTime;
+    double m_faultOutputTimeStepWidth;
+
     /**
      * Constructs a new LTS cluster.
      *
@@ -401,6 +456,11 @@ private:
     double timeStepWidth() const {
       return m_timeStepWidth;
     }
+
+    /**
+     * Writes the pending fault output.
+     **/
+    void writeFaultOutput();
     
     void setTimeStepWidth(double timestep) {
       m_timeStepWidth = timestep;
@@ -426,10 +486,26 @@ private:
                           unsigned i_numberOfCellToPointSourcesMappings,
                           sourceterm::PointSources const* i_pointSources );
 
+    /**
+     * Enables the execution of the cell loops as tasks.
+     * Required if the cluster phases are called from within an OpenMP parallel region.
+     *
+     * @param useTasks true if the phases are executed by the task scheduler.
+     * @param chunkSize maximum number of cells per task.
+     **/
+    void setTaskMode( bool useTasks, unsigned chunkSize ) {
+      m_useTasks = useTasks;
+      m_taskChunkSize = std::max(chunkSize, 1u);
+    }
+
     void setReceiverCluster( kernels::ReceiverCluster* receiverCluster) {
       m_receiverCluster = receiverCluster;
     }
 
+    void setGroundMotionCluster( solver::GroundMotionCluster* groundMotionCluster ) {
+      m_groundMotionCluster = groundMotionCluster;
+    }
+
     /**
      * Set Tv constant for plasticity.
      */
@@ -478,26 +554,52 @@ private:
      **/
     void computeNeighboringInterior();
 
-#if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
+#ifdef USE_MPI
     /**
-     * Tests for pending ghost layer communication, active when using communication thread 
+     * Sets the progress engine, which handles the ghost and copy layer communication.
      **/
-    void pollForGhostLayerReceives();
+    void setProgressEngine( ProgressEngine* i_progressEngine ) {
+      m_progressEngine = i_progressEngine;
+    }
 
     /**
-     * Polls for pending copy layer communication, active when using communication thread 
+     * Creates persistent requests for the communication of all regions.
+     * The buffers, sizes, neighbors and tags of the regions do not change during the simulation,
+     * thus every communication step only starts the requests.
      **/
-    void pollForCopyLayerSends();
+    void initPersistentCommunication();
 
     /**
-     * Start Receives the copy layer data from relevant neighboring MPI clusters, active when using communication thread
+     * Frees the persistent requests.
+     * Requires that no communication is pending.
+     **/
+    void freePersistentCommunication();
+
+    /**
+     * Receives the copy layer data from relevant neighboring MPI clusters.
+     * Called by the progress engine.
+     *
+     * @param i_allRegions true if all regions communicate (LTS buffers are reset).
+     * @param io_requests the posted requests are appended.
+     **/
+    void receiveGhostLayer( bool                      i_allRegions,
+                            std::vector<MPI_Request>& io_requests );
+
+    /**
+     * Sends the associated regions of the copy layer to relevant neighboring MPI clusters.
+     * Called by the progress engine.
+     *
+     * @param i_allRegions true if all regions communicate (LTS buffers are sent).
+     * @param io_requests the posted requests are appended.
      **/
-    void startReceiveGhostLayer();
+    void sendCopyLayer( bool                      i_allRegions,
+                        std::vector<MPI_Request>& io_requests );
 
     /**
-     * start Sends the associated regions of the copy layer to relevant neighboring MPI clusters, active when using communication thread
+     * Marks a communication step as finished.
+     * Called by the progress engine once all requests of the operation are finished.
      **/
-    void startSendCopyLayer();
+    void completeCommunication( ProgressEngine::Operation i_operation );
 #endif
 };
 
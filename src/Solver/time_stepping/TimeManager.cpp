@@ -44,14 +44,7 @@
 #include "TimeManager.h"
 #include <Initializer/preProcessorMacros.fpp>
 #include <Initializer/time_stepping/common.hpp>
-
-#if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
-#include <Parallel/Pin.h>
-volatile bool g_executeCommThread;
-volatile unsigned int* volatile g_handleRecvs;
-volatile unsigned int* volatile g_handleSends;
-pthread_t g_commThread;
-#endif
+#include <utils/env.h>
 
 seissol::time_stepping::TimeManager::TimeManager():
   m_logUpdates(std::numeric_limits<unsigned int>::max())
@@ -59,6 +52,26 @@ seissol::time_stepping::TimeManager::TimeManager():
   m_loopStatistics.addRegion("computeLocalIntegration");
   m_loopStatistics.addRegion("computeNeighboringIntegration");
   m_loopStatistics.addRegion("computeDynamicRupture");
+  m_loopStatistics.addRegion("computeReceivers");
+#ifdef USE_MPI
+  m_loopStatistics.addRegion("ghostLayerDelay", false);
+
+  m_persistentCommunication = utils::Env::get<bool>("SEISSOL_PERSISTENT_COMMUNICATION", false);
+#endif
+
+#ifdef _OPENMP
+  m_useTasks = utils::Env::get<bool>("SEISSOL_TASK_SCHEDULER", false);
+#else
+  m_useTasks = false;
+#endif
+  m_taskChunkSize = utils::Env::get<unsigned>("SEISSOL_TASK_CHUNK_SIZE", 256);
+
+  if (m_useTasks) {
+    m_loopStatistics.addRegion("taskDelay", false);
+    m_loopStatistics.addRegion("schedulerIdle", false);
+    m_regionTaskDelay = m_loopStatistics.getRegion("taskDelay");
+    m_regionSchedulerIdle = m_loopStatistics.getRegion("schedulerIdle");
+  }
 }
 
 seissol::time_stepping::TimeManager::~TimeManager() {
@@ -79,6 +92,15 @@ void seissol::time_stepping::TimeManager::addClusters( struct TimeStepping&
   // store the time stepping
   m_timeStepping = i_timeStepping;
 
+  if( m_useTasks ) {
+    logInfo(MPI::mpi.rank()) << "Using the task scheduler with at most" << m_taskChunkSize << "cells per task.";
+  }
+#ifdef USE_MPI
+  if( m_persistentCommunication ) {
+    logInfo(MPI::mpi.rank()) << "Using persistent MPI requests for the ghost and copy layer communication.";
+  }
+#endif
+
   // iterate over local time clusters
   for( unsigned int l_cluster = 0; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
     struct MeshStructure          *l_meshStructure           = NULL;
@@ -101,28 +123,36 @@ void seissol::time_stepping::TimeManager::addClusters( struct TimeStepping&
                                            i_memoryManager.getDynamicRupture(),
                                            &m_loopStatistics )
                         );
+    m_clusters.back()->setTaskMode( m_useTasks, m_taskChunkSize );
+#ifdef USE_MPI
+    m_clusters.back()->setProgressEngine( &m_progressEngine );
+    if( m_persistentCommunication ) {
+      m_clusters.back()->initPersistentCommunication();
+    }
+#endif
   }
+
+#ifdef USE_MPI
+  m_progressEngine.init( m_timeStepping.numberOfLocalClusters );
+#endif
+
+  m_clusterTaskStates.reset( new ClusterTaskState[m_timeStepping.numberOfLocalClusters] );
 }
 
 void seissol::time_stepping::TimeManager::startCommunicationThread() {
 #if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
-  g_executeCommThread = true;
-  g_handleRecvs = (volatile unsigned int* volatile) malloc(sizeof(unsigned int) * m_timeStepping.numberOfLocalClusters);
-  g_handleSends = (volatile unsigned int* volatile) malloc(sizeof(unsigned int) * m_timeStepping.numberOfLocalClusters);
-  for ( unsigned int l_cluster = 0; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
-    g_handleRecvs[l_cluster] = 0;
-    g_handleSends[l_cluster] = 0;
-  }
-  pthread_create(&g_commThread, NULL, seissol::time_stepping::TimeManager::static_pollForCommunication, this);
+  m_progressEngine.startThread();
 #endif
 }
 
 void seissol::time_stepping::TimeManager::stopCommunicationThread() {
-#if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
-  g_executeCommThread = false;
-  pthread_join(g_commThread, NULL);
-  free((void*)g_handleRecvs);
-  free((void*)g_handleSends);
+#ifdef USE_MPI
+  // finishes the outstanding requests without communication thread
+  m_progressEngine.stopThread();
+
+  for( unsigned int l_cluster = 0; l_cluster < m_clusters.size(); l_cluster++ ) {
+    m_clusters[l_cluster]->freePersistentCommunication();
+  }
 #endif
 }
 
@@ -302,6 +332,11 @@ void seissol::time_stepping::TimeManager::advanceInTime( const double &i_synchro
     updateClusterDependencies(l_cluster);
   }
 
+  if( m_useTasks ) {
+    advanceInTimeWithTasks();
+    return;
+  }
+
   // iterate until all queues are empty and the next synchronization point in time is reached
   while( !( m_localCopyQueue.empty()       && m_localInteriorQueue.empty() &&
             m_neighboringCopyQueue.empty() && m_neighboringInteriorQueue.empty() ) ) {
@@ -356,10 +391,197 @@ void seissol::time_stepping::TimeManager::advanceInTime( const double &i_synchro
   }
 }
 
+bool seissol::time_stepping::TimeManager::isNeighborhoodIdle( unsigned int i_localClusterId ) const {
+  // updateClusterDependencies reads the times of the neighbors of the neighboring clusters
+  unsigned int l_lowerCluster = (i_localClusterId > 1) ? i_localClusterId-2 : 0;
+  unsigned int l_upperCluster = std::min( i_localClusterId+2, m_timeStepping.numberOfLocalClusters-1 );
+
+  for( unsigned int l_cluster = l_lowerCluster; l_cluster <= l_upperCluster; l_cluster++ ) {
+    if( m_clusterTaskStates[l_cluster].busy ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool seissol::time_stepping::TimeManager::isIdle() const {
+  for( unsigned int l_cluster = 0; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
+    if( m_clusterTaskStates[l_cluster].busy ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+double seissol::time_stepping::TimeManager::yieldMasterThread() {
+  // nothing to do for the master thread: progress the communication and help with other tasks
+  Stopwatch l_idle;
+  l_idle.start();
+#ifdef USE_MPI
+  m_progressEngine.tryProgress();
+#endif
+#ifdef _OPENMP
+  #pragma omp taskyield
+#endif
+  return l_idle.stop();
+}
+
+bool seissol::time_stepping::TimeManager::spawnInteriorTasks( std::priority_queue< TimeCluster*, std::vector<TimeCluster*>, clusterCompare >& io_queue,
+                                                              void (TimeCluster::*i_phase)() ) {
+  bool l_spawned = false;
+  std::vector<TimeCluster*> l_postponed;
+
+  while( !io_queue.empty() ) {
+    TimeCluster* l_timeCluster = io_queue.top();
+    io_queue.pop();
+
+    ClusterTaskState* l_state = &m_clusterTaskStates[l_timeCluster->m_clusterId];
+    if( l_state->busy ) {
+      // the cluster is still executing another phase
+      l_postponed.push_back( l_timeCluster );
+      continue;
+    }
+
+    l_state->busy = true;
+    l_spawned = true;
+
+    Stopwatch l_delay;
+    l_delay.start();
+    LoopStatistics* l_loopStatistics = &m_loopStatistics;
+    unsigned l_regionTaskDelay = m_regionTaskDelay;
+
+#ifdef _OPENMP
+    #pragma omp task firstprivate(l_timeCluster, l_state, l_delay, l_loopStatistics, l_regionTaskDelay, i_phase)
+#endif
+    {
+      l_loopStatistics->addSample( l_regionTaskDelay, 1, l_delay.split() );
+      (l_timeCluster->*i_phase)();
+      l_state->done.store( true, std::memory_order_release );
+    }
+  }
+
+  for( std::vector<TimeCluster*>::const_iterator l_cluster = l_postponed.begin(); l_cluster != l_postponed.end(); ++l_cluster ) {
+    io_queue.push( *l_cluster );
+  }
+
+  return l_spawned;
+}
+
+void seissol::time_stepping::TimeManager::advanceInTimeWithTasks() {
+  SCOREP_USER_REGION( "advanceInTimeWithTasks", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  for( unsigned int l_cluster = 0; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
+    m_clusterTaskStates[l_cluster].busy = false;
+    m_clusterTaskStates[l_cluster].done.store( false );
+  }
+
+  // clusters which changed their status; the dependencies are updated once their neighborhood is idle
+  std::list<unsigned int> l_pendingUpdates;
+
+  double l_idleTime = 0.0;
+
+#ifdef _OPENMP
+  #pragma omp parallel
+  {
+  #pragma omp master
+  {
+#endif
+  while( true ) {
+    bool l_progress = false;
+
+    // retire finished tasks
+    for( unsigned int l_cluster = 0; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
+      ClusterTaskState& l_state = m_clusterTaskStates[l_cluster];
+      if( l_state.busy && l_state.done.load( std::memory_order_acquire ) ) {
+        l_state.busy = false;
+        l_state.done.store( false, std::memory_order_relaxed );
+        l_pendingUpdates.push_back( l_cluster );
+        l_progress = true;
+      }
+    }
+
+    // the fault output reads the dynamic rupture state of all clusters:
+    // no new work is started until the running tasks are finished and the output is written
+    if( m_clusters[0]->m_faultOutputPending.load( std::memory_order_acquire ) ) {
+      if( !isIdle() ) {
+        l_idleTime += yieldMasterThread();
+        continue;
+      }
+      m_clusters[0]->writeFaultOutput();
+      l_progress = true;
+    }
+
+    // update the dependencies
+    for( std::list<unsigned int>::iterator l_cluster = l_pendingUpdates.begin(); l_cluster != l_pendingUpdates.end(); ) {
+      if( isNeighborhoodIdle( *l_cluster ) ) {
+        unsigned int l_clusterId = *l_cluster;
+        l_cluster = l_pendingUpdates.erase( l_cluster );
+        updateClusterDependencies( l_clusterId );
+        l_progress = true;
+      }
+      else l_cluster++;
+    }
+
+#ifdef USE_MPI
+    // copy layers are computed by the master thread; the cell chunks are shared with the other threads
+    for( std::list<TimeCluster*>::iterator l_cluster = m_localCopyQueue.begin(); l_cluster != m_localCopyQueue.end(); ) {
+      if( !m_clusterTaskStates[(*l_cluster)->m_clusterId].busy && (*l_cluster)->computeLocalCopy() ) {
+        l_pendingUpdates.push_back( (*l_cluster)->m_clusterId );
+        l_cluster = m_localCopyQueue.erase( l_cluster );
+        l_progress = true;
+      }
+      else l_cluster++;
+    }
+
+    for( std::list<TimeCluster*>::iterator l_cluster = m_neighboringCopyQueue.begin(); l_cluster != m_neighboringCopyQueue.end(); ) {
+      if( !m_clusterTaskStates[(*l_cluster)->m_clusterId].busy && (*l_cluster)->computeNeighboringCopy() ) {
+        l_pendingUpdates.push_back( (*l_cluster)->m_clusterId );
+        l_cluster = m_neighboringCopyQueue.erase( l_cluster );
+        l_progress = true;
+      }
+      else l_cluster++;
+    }
+#endif
+
+    // interiors are executed as tasks
+    l_progress = spawnInteriorTasks( m_localInteriorQueue, &TimeCluster::computeLocalInterior ) || l_progress;
+    l_progress = spawnInteriorTasks( m_neighboringInteriorQueue, &TimeCluster::computeNeighboringInterior ) || l_progress;
+
+    // print progress of largest time cluster
+    if( m_clusters[m_timeStepping.numberOfLocalClusters-1]->m_numberOfFullUpdates != m_logUpdates &&
+        m_clusters[m_timeStepping.numberOfLocalClusters-1]->m_numberOfFullUpdates % 100 == 0 &&
+        !m_clusterTaskStates[m_timeStepping.numberOfLocalClusters-1].busy ) {
+      m_logUpdates = m_clusters[m_timeStepping.numberOfLocalClusters-1]->m_numberOfFullUpdates;
+
+      const int rank = MPI::mpi.rank();
+
+      logInfo(rank) << "#max-updates since sync: " << m_logUpdates
+                         << " @ "                  << m_clusters[m_timeStepping.numberOfLocalClusters-1]->m_fullUpdateTime;
+    }
+
+    if( !l_progress ) {
+      if( isIdle() && l_pendingUpdates.empty() &&
+          m_localCopyQueue.empty()       && m_localInteriorQueue.empty() &&
+          m_neighboringCopyQueue.empty() && m_neighboringInteriorQueue.empty() ) {
+        break;
+      }
+
+      l_idleTime += yieldMasterThread();
+    }
+  }
+#ifdef _OPENMP
+  }
+  }
+#endif
+
+  m_loopStatistics.addSample( m_regionSchedulerIdle, 1, l_idleTime );
+}
+
 void seissol::time_stepping::TimeManager::printComputationTime()
 {
 #ifdef USE_MPI
   m_loopStatistics.printSummary(MPI::mpi.comm());
+  m_progressEngine.printStatistics();
 #endif
   m_loopStatistics.writeSamples();
 }
@@ -384,6 +606,13 @@ void seissol::time_stepping::TimeManager::setReceiverClusters(writer::ReceiverWr
   }
 }
 
+void seissol::time_stepping::TimeManager::setGroundMotionClusters(writer::GroundMotionWriter& groundMotionWriter)
+{
+  for (unsigned cluster = 0; cluster < m_clusters.size(); ++cluster) {
+    m_clusters[cluster]->setGroundMotionCluster(groundMotionWriter.groundMotionCluster(cluster));
+  }
+}
+
 void seissol::time_stepping::TimeManager::setInitialTimes( double i_time ) {
   assert( i_time >= 0 );
 
@@ -400,39 +629,3 @@ void seissol::time_stepping::TimeManager::setTv(double tv) {
   }
 }
 
-#if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
-void seissol::time_stepping::TimeManager::pollForCommunication() {
-  // pin this thread to the last core
-  volatile unsigned int l_signalSum = 0;
-
-  parallel::pinToFreeCPUs();
-
-  //logInfo(0) << "Launching communication thread on OS core id:" << l_numberOfHWThreads;
-
-  // now let's enter the polling loop
-  while (g_executeCommThread == true || l_signalSum > 0) {
-    for( unsigned int l_cluster = 0; l_cluster < m_clusters.size(); l_cluster++ ) {
-      if (g_handleRecvs[l_cluster] == 1) {
-        m_clusters[l_cluster]->startReceiveGhostLayer();
-        g_handleRecvs[l_cluster] = 2;
-      }
-      if (g_handleSends[l_cluster] == 1) {
-        m_clusters[l_cluster]->startSendCopyLayer();
-        g_handleSends[l_cluster] = 2;
-      }
-      if (g_handleRecvs[l_cluster] == 2) {
-        m_clusters[l_cluster]->pollForGhostLayerReceives();
-      }
-      if (g_handleSends[l_cluster] == 2) {
-        m_clusters[l_cluster]->pollForCopyLayerSends();
-      }
-    }
-    l_signalSum = 0;
-    for( unsigned int l_cluster = 0; l_cluster < m_clusters.size(); l_cluster++ ) {
-      l_signalSum += g_handleRecvs[l_cluster];
-      l_signalSum += g_handleSends[l_cluster];
-    }
-  }
-}
-#endif
-
@@ -45,6 +45,8 @@
 #include <queue>
 #include <list>
 #include <cassert>
+#include <atomic>
+#include <memory>
 
 #include <Initializer/typedefs.hpp>
 #include <SourceTerm/typedefs.hpp>
@@ -53,6 +55,7 @@
 #include <Initializer/time_stepping/LtsLayout.h>
 #include <Solver/FreeSurfaceIntegrator.h>
 #include <ResultWriter/ReceiverWriter.h>
+#include <ResultWriter/GroundMotionWriter.h>
 #include "TimeCluster.h"
 #include "Monitoring/Stopwatch.h"
 
@@ -99,6 +102,77 @@ class seissol::time_stepping::TimeManager {
     
     //! Stopwatch
     LoopStatistics m_loopStatistics;
+
+    //! true if the cluster phases are executed by the task scheduler (SEISSOL_TASK_SCHEDULER)
+    bool m_useTasks;
+
+    //! maximum number of cells per task (SEISSOL_TASK_CHUNK_SIZE)
+    unsigned m_taskChunkSize;
+
+    //! loop statistics regions of the task scheduler
+    unsigned m_regionTaskDelay;
+    unsigned m_regionSchedulerIdle;
+
+    /**
+     * State of a cluster in the task scheduler.
+     * busy is only accessed by the master thread, done is set by the task executing the cluster phase.
+     **/
+    struct ClusterTaskState {
+      bool busy;
+      std::atomic<bool> done;
+    };
+
+    //! task state of all clusters
+    std::unique_ptr<ClusterTaskState[]> m_clusterTaskStates;
+
+#ifdef USE_MPI
+    //! progress engine for the communication of all clusters
+    ProgressEngine m_progressEngine;
+
+    //! true if the clusters communicate with persistent requests (SEISSOL_PERSISTENT_COMMUNICATION)
+    bool m_persistentCommunication;
+#endif
+
+    /**
+     * Returns true if no cluster within a distance of two clusters executes a task.
+     * Only then it is safe to evaluate the time stepping state of the cluster and its
+     * neighbors, which depends on the times of their neighbors (see updateClusterDependencies).
+     **/
+    bool isNeighborhoodIdle( unsigned int i_localClusterId ) const;
+
+    /**
+     * Returns true if no cluster executes a task.
+     **/
+    bool isIdle() const;
+
+    /**
+     * Progresses the communication and executes other tasks while the master thread waits.
+     *
+     * @return idle time of the master thread in seconds.
+     **/
+    double yieldMasterThread();
+
+    /**
+     * Spawns a task for every cluster in the queue, which is not busy.
+     *
+     * @return true if at least one task was spawned.
+     **/
+    bool spawnInteriorTasks( std::priority_queue< TimeCluster*, std::vector<TimeCluster*>, clusterCompare >& io_queue,
+                             void (TimeCluster::*i_phase)() );
+
+    /**
+     * Task-based alternative to the polling loop in advanceInTime.
+     *
+     * Every (cluster, layer, phase) triple is a node of a task graph:
+     *  * A node becomes ready once updateClusterDependencies enqueued it, i.e. when the previous cluster
+     *    provided its prediction and the next cluster finished the full update which required the old buffers.
+     *  * Copy layer nodes additionally depend on the ghost layer receives (and the previous copy layer sends);
+     *    they are executed by the master thread, which owns MPI.
+     *  * Interior nodes are executed as OpenMP tasks by the other threads.
+     *  * Nodes of the same cluster are executed one after another, nodes of different clusters may overlap.
+     * The cell loops of all nodes are split into chunks, which are executed by any idle thread.
+     **/
+    void advanceInTimeWithTasks();
     
     /**
      * Checks if the time stepping restrictions for this cluster and its neighbors changed.
@@ -146,14 +220,14 @@ class seissol::time_stepping::TimeManager {
                       initializers::MemoryManager&       i_memoryManager );
 
     /**
-     * Starts the communication thread.
+     * Starts the communication thread, which drives the progress engine.
      * Remark: This method has no effect when not compiled for communication thread support.
      **/
     void startCommunicationThread();
 
     /**
-     * Stops the communication thread.
-     * Remark: This method has no effect when not compiled for communication thread support.
+     * Stops the communication thread or, without communication thread, waits for the outstanding requests.
+     * Frees the persistent requests afterwards.
      **/
     void stopCommunicationThread();
 
@@ -180,6 +254,11 @@ class seissol::time_stepping::TimeManager {
      */
     void setReceiverClusters(writer::ReceiverWriter& receiverWriter); 
 
+    /**
+     * Distributes the ground motion summaries of the free surface to the clusters
+     */
+    void setGroundMotionClusters(writer::GroundMotionWriter& groundMotionWriter);
+
     /**
      * Set Tv constant for plasticity.
      */
@@ -193,16 +272,14 @@ class seissol::time_stepping::TimeManager {
      **/
     void setInitialTimes( double i_time = 0 );
 
-#if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
-    void pollForCommunication();
+    void printComputationTime();
 
-    static void* static_pollForCommunication(void* p) {
-      static_cast<seissol::time_stepping::TimeManager*>(p)->pollForCommunication();
-      return NULL;
+    /**
+     * Sets the load imbalance predicted by the partitioning, which is reported together with the measured imbalance.
+     **/
+    void setPredictedImbalance( double i_imbalance ) {
+      m_loopStatistics.setPredictedImbalance( i_imbalance );
     }
-#endif
-
-    void printComputationTime();
 };
 
 #endif
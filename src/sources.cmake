@@ -5,6 +5,7 @@ src/Initializer/GlobalData.cpp
 src/Initializer/InternalState.cpp
 src/Initializer/MemoryAllocator.cpp
 src/Initializer/CellLocalMatrices.cpp
+src/Initializer/LocalIntegrationBatches.cpp
 
 src/Initializer/time_stepping/LtsLayout.cpp
 src/Initializer/tree/Lut.cpp
@@ -28,10 +29,13 @@ src/generated_code/kernel.cpp
 
 src/Solver/Simulator.cpp
 src/Solver/FreeSurfaceIntegrator.cpp
+src/Solver/GroundMotion.cpp
+src/Solver/GroundMotionCluster.cpp
 src/Solver/Interoperability.cpp
 src/Solver/time_stepping/MiniSeisSol.cpp
 src/Solver/time_stepping/TimeCluster.cpp
 src/Solver/time_stepping/TimeManager.cpp
+src/Solver/time_stepping/ProgressEngine.cpp
 src/Kernels/DynamicRupture.cpp
 src/Kernels/Plasticity.cpp
 src/Kernels/TimeCommon.cpp
@@ -44,13 +48,16 @@ src/Parallel/Pin.cpp
 src/Parallel/MPI.cpp
 src/Parallel/mpiC.cpp
 src/Parallel/FaultMPI.cpp
+src/Geometry/BoundingVolumeHierarchy.cpp
 src/Geometry/GambitReader.cpp
 
 src/Geometry/MeshReaderFBinding.cpp
 src/Geometry/MeshTools.cpp
 src/Monitoring/FlopCounter.cpp
 src/Monitoring/LoopStatistics.cpp
+src/Monitoring/MemoryReport.cpp
 src/Reader/readparC.cpp
+src/Reader/ParallelInputFile.cpp
 #Reader/StressReaderC.cpp
 src/Checkpoint/Manager.cpp
 
@@ -64,6 +71,7 @@ src/Checkpoint/mpio/WavefieldAsync.cpp
 # Checkpoint/sionlib/Fault.cpp
 
 src/Checkpoint/Backend.cpp
+src/Checkpoint/Compression.cpp
 src/Checkpoint/Fault.cpp
 src/Checkpoint/posix/Wavefield.cpp
 src/Checkpoint/posix/Fault.cpp
@@ -72,10 +80,16 @@ src/ResultWriter/FreeSurfaceWriterExecutor.cpp
 src/ResultWriter/PostProcessor.cpp
 src/ResultWriter/FaultWriterC.cpp
 src/ResultWriter/ReceiverWriter.cpp
+src/ResultWriter/ReceiverWriterExecutor.cpp
 src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FaultWriter.cpp
+src/ResultWriter/FaultReceiverWriter.cpp
+src/ResultWriter/FaultReceiverWriterExecutor.cpp
 src/ResultWriter/WaveFieldWriter.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
+src/ResultWriter/GroundMotionWriter.cpp
+src/ResultWriter/GroundMotionWriterExecutor.cpp
+src/ResultWriter/EnergyOutput.cpp
 
 # Fortran:
 src/Monitoring/bindMonitoring.f90
@@ -105,15 +119,15 @@ src/Physics/ini_model.f90
 src/Physics/Evaluate_friction_law.f90
 src/Physics/ini_model_DR.f90
 src/Physics/InitialField.cpp
+src/Physics/FrictionSolver.cpp
 src/Physics/NucleationFunctions.f90
 src/Physics/thermalpressure.f90
+src/Reader/ParallelInputFileF.f90
 src/Reader/readpar.f90
 src/Reader/read_backgroundstress.f90
 src/ResultWriter/inioutput_seissol.f90
-src/ResultWriter/magnitude_output.f90
 src/ResultWriter/output_rupturefront.f90
 src/ResultWriter/ini_faultoutput.f90
-src/ResultWriter/energies.f90
 src/ResultWriter/FaultWriterF.f90
 src/ResultWriter/faultoutput.f90
 src/ResultWriter/common_fault_receiver.f90
@@ -134,6 +148,8 @@ endif()
 if (HDF5 AND METIS AND MPI)
   target_sources(SeisSol-lib PUBLIC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/PUMLReader.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/PartitionCache.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/PUMLFile.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/time_stepping/LtsWeights.cpp
     )
 endif()
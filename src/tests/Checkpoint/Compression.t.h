@@ -0,0 +1,144 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the lossless compression of checkpoint chunks.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <Checkpoint/Compression.h>
+
+#include <cmath>
+#include <vector>
+
+namespace seissol {
+  namespace unit_test {
+    class CompressionTestSuite;
+  }
+}
+
+class seissol::unit_test::CompressionTestSuite : public CxxTest::TestSuite
+{
+public:
+  void testShuffle()
+  {
+    using namespace seissol::checkpoint::compression;
+
+    const unsigned char in[6] = {1, 2, 3, 4, 5, 6};
+    unsigned char shuffled[6];
+    unsigned char result[6];
+
+    shuffle(in, 3, 2, shuffled);
+    TS_ASSERT_EQUALS(shuffled[0], 1);
+    TS_ASSERT_EQUALS(shuffled[1], 3);
+    TS_ASSERT_EQUALS(shuffled[2], 5);
+    TS_ASSERT_EQUALS(shuffled[3], 2);
+
+    unshuffle(shuffled, 3, 2, result);
+    for (unsigned i = 0; i < 6; ++i) {
+      TS_ASSERT_EQUALS(result[i], in[i]);
+    }
+  }
+
+  void testRoundTrip()
+  {
+    using namespace seissol::checkpoint::compression;
+
+    // Smooth values with some zeros, similar to a wave field
+    const unsigned n = 20000;
+    std::vector<double> values(n);
+    for (unsigned i = 0; i < n; ++i) {
+      values[i] = (i % 1000 < 300) ? 0.0 : std::sin(0.01 * i);
+    }
+    const size_t size = n * sizeof(double);
+
+    std::vector<unsigned char> shuffled(size);
+    std::vector<unsigned char> compressed(size);
+    std::vector<unsigned char> decompressed(size);
+    std::vector<double> result(n);
+
+    shuffle(values.data(), n, sizeof(double), shuffled.data());
+    const size_t compressedSize = compress(shuffled.data(), size, compressed.data(), size);
+    TS_ASSERT_LESS_THAN(0u, compressedSize);
+    TS_ASSERT_LESS_THAN(compressedSize, size);
+
+    TS_ASSERT(decompress(compressed.data(), compressedSize, decompressed.data(), size));
+    unshuffle(decompressed.data(), n, sizeof(double), result.data());
+    for (unsigned i = 0; i < n; ++i) {
+      TS_ASSERT_EQUALS(result[i], values[i]);
+    }
+
+    TS_ASSERT_EQUALS(hash(result.data(), size), hash(values.data(), size));
+  }
+
+  void testIncompressible()
+  {
+    using namespace seissol::checkpoint::compression;
+
+    // Pseudo random bytes do not fit into a smaller buffer
+    const size_t size = 4096;
+    std::vector<unsigned char> in(size);
+    unsigned int state = 1;
+    for (size_t i = 0; i < size; ++i) {
+      state = state * 1103515245u + 12345u;
+      in[i] = static_cast<unsigned char>(state >> 16);
+    }
+
+    std::vector<unsigned char> out(size);
+    TS_ASSERT_EQUALS(compress(in.data(), size, out.data(), size-1), 0u);
+  }
+
+  void testCorrupt()
+  {
+    using namespace seissol::checkpoint::compression;
+
+    const size_t size = 1000;
+    std::vector<unsigned char> in(size, 7);
+    std::vector<unsigned char> compressed(size);
+    std::vector<unsigned char> out(size);
+
+    const size_t compressedSize = compress(in.data(), size, compressed.data(), size);
+    TS_ASSERT_LESS_THAN(0u, compressedSize);
+
+    // Truncated data and a wrong output size are detected
+    TS_ASSERT(!decompress(compressed.data(), compressedSize-1, out.data(), size));
+    TS_ASSERT(!decompress(compressed.data(), compressedSize, out.data(), size-1));
+
+    // Hash changes with the content
+    std::vector<unsigned char> other(in);
+    other[size/2] = 8;
+    TS_ASSERT_DIFFERS(hash(in.data(), size), hash(other.data(), size));
+  }
+};
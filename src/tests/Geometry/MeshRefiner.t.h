@@ -160,6 +160,40 @@ class seissol::unit_test::MeshRefinerTestSuite : public CxxTest::TestSuite
       }
     }
 
+    void testExtractedRegion() {
+      const MockReader mockReader(vertices);
+      // Extract the vertices in reverse order
+      const std::vector<const Element*> subElements = {&mockReader.getElements()[0]};
+      const std::vector<const Vertex*> subVertices = {
+        &mockReader.getVertices()[3], &mockReader.getVertices()[2],
+        &mockReader.getVertices()[1], &mockReader.getVertices()[0]
+      };
+      const std::vector<unsigned int> oldToNewVertexMap = {3, 2, 1, 0};
+
+      const std::array<Eigen::Vector3d, 5> exptectedVerticesDivideBy4 = {
+        vertices[3], vertices[2], vertices[1], vertices[0],
+        0.25*(vertices[0] + vertices[1] + vertices[2] + vertices[3])
+      };
+
+      const std::array<Eigen::Vector4i, 4> exptectedCellsDivideBy4 {
+        Eigen::Vector4i(3, 2, 1, 4),
+        Eigen::Vector4i(3, 2, 0, 4),
+        Eigen::Vector4i(3, 1, 0, 4),
+        Eigen::Vector4i(2, 1, 0, 4)
+      };
+
+      seissol::refinement::DivideTetrahedronBy4<double> refineBy4;
+      seissol::refinement::MeshRefiner<double>meshRefiner(subElements, subVertices, oldToNewVertexMap, refineBy4);
+      TS_ASSERT_EQUALS(meshRefiner.getNumCells(), 4);
+      TS_ASSERT_EQUALS(meshRefiner.getNumVertices(), 5);
+      for (unsigned i = 0; i < meshRefiner.getNumVertices(); i++) {
+        assertPoint(&meshRefiner.getVertexData()[3*i], exptectedVerticesDivideBy4[i]);
+      }
+      for (unsigned i = 0; i < meshRefiner.getNumCells(); i++) {
+        assertCell(&meshRefiner.getCellData()[4*i], exptectedCellsDivideBy4[i]);
+      }
+    }
+
     void assertPoint(const double* a, const Eigen::Vector3d& b) {
       for (int i = 0; i < 3; i++) {
         TS_ASSERT_DELTA(a[i], b[i], epsilon);
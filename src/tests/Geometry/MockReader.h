@@ -26,4 +26,53 @@ namespace seissol
 
       }
   };
+
+  /**
+   * Unit cube, divided into n^3 cubes with 6 tetrahedrons each
+   */
+  class MockCubeReader : public MeshReader
+  {
+    public:
+      MockCubeReader(unsigned n) : MeshReader(0) {
+        auto vertexId = [n](unsigned x, unsigned y, unsigned z) {
+          return x + (n+1) * (y + (n+1) * z);
+        };
+
+        m_vertices.resize((n+1) * (n+1) * (n+1));
+        for (unsigned z = 0; z <= n; ++z) {
+          for (unsigned y = 0; y <= n; ++y) {
+            for (unsigned x = 0; x <= n; ++x) {
+              Vertex& vertex = m_vertices[vertexId(x, y, z)];
+              vertex.coords[0] = static_cast<double>(x) / n;
+              vertex.coords[1] = static_cast<double>(y) / n;
+              vertex.coords[2] = static_cast<double>(z) / n;
+            }
+          }
+        }
+
+        // Kuhn triangulation: all tetrahedrons share the diagonal (0,0,0)-(1,1,1)
+        const unsigned paths[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+        for (unsigned z = 0; z < n; ++z) {
+          for (unsigned y = 0; y < n; ++y) {
+            for (unsigned x = 0; x < n; ++x) {
+              for (unsigned t = 0; t < 6; ++t) {
+                unsigned corner[3] = {x, y, z};
+                Element element;
+                element.vertices[0] = vertexId(corner[0], corner[1], corner[2]);
+                for (unsigned v = 0; v < 3; ++v) {
+                  ++corner[paths[t][v]];
+                  element.vertices[v+1] = vertexId(corner[0], corner[1], corner[2]);
+                }
+                // Positive orientation such that the normals point outwards
+                if (t == 1 || t == 2 || t == 5) {
+                  std::swap(element.vertices[2], element.vertices[3]);
+                }
+                element.localId = m_elements.size();
+                m_elements.push_back(element);
+              }
+            }
+          }
+        }
+      }
+  };
 }
@@ -0,0 +1,176 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Test of the parallel PUML file reader
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <cstdio>
+#include <vector>
+
+#include <hdf5.h>
+
+#include <Geometry/PUMLFile.h>
+#include <Parallel/MPI.h>
+
+namespace seissol {
+  namespace unit_test {
+    class PUMLFileTestSuite;
+  }
+}
+
+class seissol::unit_test::PUMLFileTestSuite : public CxxTest::TestSuite
+{
+private:
+  static const unsigned int NUM_CELLS = 7;
+  static const unsigned int NUM_VERTICES = 12;
+
+  const char* m_fileName;
+
+  static unsigned long vertex(unsigned int cell, unsigned int v)
+  {
+    return (3 * cell + 2 * v) % NUM_VERTICES;
+  }
+
+  static void write(hid_t file, const char* name, hid_t type, int rank, const hsize_t* dims, const void* data)
+  {
+    hid_t space = H5Screate_simple(rank, dims, 0L);
+    hid_t dataset = H5Dcreate(file, name, type, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    H5Dclose(dataset);
+    H5Sclose(space);
+  }
+
+public:
+  void setUp()
+  {
+    m_fileName = "puml_file_test.h5";
+
+    if (seissol::MPI::mpi.rank() == 0) {
+      std::vector<unsigned long> connect;
+      std::vector<int> group;
+      std::vector<int> boundary;
+      for (unsigned int i = 0; i < NUM_CELLS; i++) {
+        for (unsigned int v = 0; v < 4; v++)
+          connect.push_back(vertex(i, v));
+        group.push_back(i % 3);
+        boundary.push_back(100 + i);
+      }
+      std::vector<double> geometry;
+      for (unsigned int i = 0; i < NUM_VERTICES; i++) {
+        geometry.push_back(i);
+        geometry.push_back(10. * i);
+        geometry.push_back(100. * i);
+      }
+
+      hid_t file = H5Fcreate(m_fileName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+      hsize_t dims[2] = {NUM_CELLS, 4};
+      write(file, "connect", H5T_NATIVE_ULONG, 2, dims, connect.data());
+      write(file, "group", H5T_NATIVE_INT, 1, dims, group.data());
+      write(file, "boundary", H5T_NATIVE_INT, 1, dims, boundary.data());
+      dims[0] = NUM_VERTICES; dims[1] = 3;
+      write(file, "geometry", H5T_NATIVE_DOUBLE, 2, dims, geometry.data());
+      H5Fclose(file);
+    }
+
+#ifdef USE_MPI
+    MPI_Barrier(seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  }
+
+  void tearDown()
+  {
+#ifdef USE_MPI
+    MPI_Barrier(seissol::MPI::mpi.comm());
+#endif // USE_MPI
+    if (seissol::MPI::mpi.rank() == 0)
+      std::remove(m_fileName);
+  }
+
+  void testCells()
+  {
+    PUMLFile file(m_fileName);
+    TS_ASSERT_EQUALS(file.numTotalCells(), NUM_CELLS);
+    TS_ASSERT_EQUALS(file.numTotalVertices(), NUM_VERTICES);
+
+    // Contiguous ranges, the first ranks get one additional cell
+    const unsigned long ranks = seissol::MPI::mpi.size();
+    const unsigned long rank = seissol::MPI::mpi.rank();
+    TS_ASSERT_EQUALS(file.numCells(), NUM_CELLS / ranks + (rank < NUM_CELLS % ranks ? 1 : 0));
+    unsigned long offset = 0;
+    for (unsigned long r = 0; r < rank; r++)
+      offset += NUM_CELLS / ranks + (r < NUM_CELLS % ranks ? 1 : 0);
+    TS_ASSERT_EQUALS(file.cellOffset(), offset);
+
+    std::vector<unsigned long> cells(4 * file.numCells());
+    file.readCells(reinterpret_cast<unsigned long (*)[4]>(cells.data()));
+    std::vector<int> group(file.numCells());
+    file.readCellData("group", group.data());
+    std::vector<int> boundary(file.numCells());
+    file.readCellData("boundary", boundary.data());
+
+    for (unsigned int i = 0; i < file.numCells(); i++) {
+      const unsigned int cell = file.cellOffset() + i;
+      for (unsigned int v = 0; v < 4; v++)
+        TS_ASSERT_EQUALS(cells[4*i + v], vertex(cell, v));
+      TS_ASSERT_EQUALS(group[i], static_cast<int>(cell % 3));
+      TS_ASSERT_EQUALS(boundary[i], static_cast<int>(100 + cell));
+    }
+
+    TS_ASSERT_EQUALS(file.bytesRead(), file.numCells() * (4*sizeof(unsigned long) + 2*sizeof(int)));
+  }
+
+  void testVertices()
+  {
+    PUMLFile file(m_fileName);
+
+    // Three runs of consecutive vertices
+    std::vector<unsigned long> vertexIds = {0, 1, 2, 5, 8, 9, 10, 11};
+    std::vector<double> coordinates(3 * vertexIds.size());
+    file.readVertices(vertexIds, reinterpret_cast<double (*)[3]>(coordinates.data()));
+
+    for (unsigned int i = 0; i < vertexIds.size(); i++) {
+      TS_ASSERT_EQUALS(coordinates[3*i], vertexIds[i]);
+      TS_ASSERT_EQUALS(coordinates[3*i + 1], 10. * vertexIds[i]);
+      TS_ASSERT_EQUALS(coordinates[3*i + 2], 100. * vertexIds[i]);
+    }
+    TS_ASSERT_EQUALS(file.bytesRead(), vertexIds.size() * 3 * sizeof(double));
+
+    // Ranks without vertices still take part in the collective read
+    file.readVertices(std::vector<unsigned long>(), 0L);
+    TS_ASSERT_EQUALS(file.bytesRead(), vertexIds.size() * 3 * sizeof(double));
+  }
+};
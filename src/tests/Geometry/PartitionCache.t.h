@@ -0,0 +1,235 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Test of the partition cache
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <Geometry/PartitionCache.h>
+
+namespace seissol {
+  namespace unit_test {
+    class PartitionCacheTestSuite;
+  }
+}
+
+class seissol::unit_test::PartitionCacheTestSuite : public CxxTest::TestSuite
+{
+private:
+  /** Number of cubes in each direction (each cube consists of 6 tetrahedra) */
+  static const unsigned int N = 8;
+
+  std::vector<unsigned long> m_cells;
+  std::vector<double> m_barycenters;
+
+  /** Cells that share a face */
+  std::vector<std::vector<unsigned int>> m_neighbors;
+
+public:
+  void setUp()
+  {
+    m_cells.clear();
+    m_barycenters.clear();
+
+    const unsigned int axes[6][3] = {{0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0}};
+    for (unsigned int z = 0; z < N; z++) {
+      for (unsigned int y = 0; y < N; y++) {
+        for (unsigned int x = 0; x < N; x++) {
+          for (unsigned int t = 0; t < 6; t++) {
+            unsigned int corner[3] = {x, y, z};
+            double barycenter[3] = {0.0, 0.0, 0.0};
+            for (unsigned int v = 0; v < 4; v++) {
+              if (v > 0)
+                corner[axes[t][v-1]]++;
+              m_cells.push_back(corner[0] + (N+1) * (corner[1] + (N+1) * corner[2]));
+              for (unsigned int d = 0; d < 3; d++)
+                barycenter[d] += 0.25 * corner[d] / N;
+            }
+
+            // Avoid cells with identical coordinates
+            const unsigned int cell = m_barycenters.size() / 3;
+            for (unsigned int d = 0; d < 3; d++)
+              m_barycenters.push_back(barycenter[d] + 1e-6 * ((cell * 7919 + d * 104729) % 1000) / 1000.0);
+          }
+        }
+      }
+    }
+
+    const unsigned int numCells = m_cells.size() / 4;
+    std::map<std::array<unsigned long, 3>, std::vector<unsigned int>> faces;
+    for (unsigned int i = 0; i < numCells; i++) {
+      for (unsigned int f = 0; f < 4; f++) {
+        std::array<unsigned long, 3> face;
+        unsigned int k = 0;
+        for (unsigned int v = 0; v < 4; v++) {
+          if (v != f)
+            face[k++] = m_cells[4*i + v];
+        }
+        std::sort(face.begin(), face.end());
+        faces[face].push_back(i);
+      }
+    }
+    m_neighbors.assign(numCells, std::vector<unsigned int>());
+    for (auto it = faces.begin(); it != faces.end(); ++it) {
+      if (it->second.size() == 2) {
+        m_neighbors[it->second[0]].push_back(it->second[1]);
+        m_neighbors[it->second[1]].push_back(it->second[0]);
+      }
+    }
+  }
+
+  void testMerge()
+  {
+    std::vector<int> weights = vertexWeights(false);
+    PartitionCache cache("partition_cache_test.h5", numCells(), cells(), barycenters(), weights.data(), 2);
+
+    // Slabs along the x-axis, neighboring slabs do not have consecutive ids
+    const int slabIds[8] = {0, 4, 1, 5, 2, 6, 3, 7};
+    for (unsigned int factor = 2; factor <= 8; factor *= 2) {
+      std::vector<int> partition(numCells());
+      for (unsigned int i = 0; i < numCells(); i++)
+        partition[i] = slabIds[std::min(static_cast<int>(m_barycenters[3*i] * 8), 7)];
+
+      TS_ASSERT(cache.merge(partition.data(), 8, factor));
+      assertPartition(partition, 8 / factor, weights, 2);
+    }
+  }
+
+  void testSplit()
+  {
+    std::vector<int> weights = vertexWeights(false);
+    PartitionCache cache("partition_cache_test.h5", numCells(), cells(), barycenters(), weights.data(), 2);
+
+    for (unsigned int factor = 2; factor <= 6; factor++) {
+      std::vector<int> partition(numCells());
+      for (unsigned int i = 0; i < numCells(); i++)
+        partition[i] = (m_barycenters[3*i] < 0.5) ? 0 : 1;
+
+      TS_ASSERT(cache.split(partition.data(), 2, factor));
+      assertPartition(partition, 2 * factor, weights, 2);
+    }
+  }
+
+  void testSplitConflictingConstraints()
+  {
+    // The second constraint is concentrated in one corner
+    std::vector<int> weights = vertexWeights(true);
+    PartitionCache cache("partition_cache_test.h5", numCells(), cells(), barycenters(), weights.data(), 2);
+
+    std::vector<int> partition(numCells(), 0);
+    TS_ASSERT(!cache.split(partition.data(), 1, 4));
+    TS_ASSERT_LESS_THAN(PartitionCache::MAX_IMBALANCE, cache.imbalance(partition.data(), 4));
+  }
+
+private:
+  unsigned int numCells() const
+  {
+    return m_cells.size() / 4;
+  }
+
+  const unsigned long (*cells() const)[4]
+  {
+    return reinterpret_cast<const unsigned long (*)[4]>(m_cells.data());
+  }
+
+  const double (*barycenters() const)[3]
+  {
+    return reinterpret_cast<const double (*)[3]>(m_barycenters.data());
+  }
+
+  std::vector<int> vertexWeights(bool conflicting) const
+  {
+    std::vector<int> weights(2 * numCells());
+    for (unsigned int i = 0; i < numCells(); i++) {
+      weights[2*i] = 1;
+      if (conflicting)
+        weights[2*i+1] = (m_barycenters[3*i] < 0.25 && m_barycenters[3*i+1] < 0.25) ? 100 : 1;
+      else
+        weights[2*i+1] = 1 + 3 * (i % 2);
+    }
+    return weights;
+  }
+
+  /**
+   * Checks that each part is connected and that all constraints are balanced
+   */
+  void assertPartition(const std::vector<int> &partition, int nparts, const std::vector<int> &weights, int ncon)
+  {
+    std::vector<double> partWeights(nparts * ncon, 0.0);
+    std::vector<double> total(ncon, 0.0);
+    for (unsigned int i = 0; i < numCells(); i++) {
+      TS_ASSERT_LESS_THAN_EQUALS(0, partition[i]);
+      TS_ASSERT_LESS_THAN(partition[i], nparts);
+      for (int j = 0; j < ncon; j++) {
+        partWeights[partition[i]*ncon + j] += weights[i*ncon + j];
+        total[j] += weights[i*ncon + j];
+      }
+    }
+    for (int p = 0; p < nparts; p++) {
+      for (int j = 0; j < ncon; j++)
+        TS_ASSERT_LESS_THAN_EQUALS(partWeights[p*ncon + j] * nparts / total[j], PartitionCache::MAX_IMBALANCE);
+    }
+
+    // Flood fill each part from its first cell
+    std::vector<bool> visited(numCells(), false);
+    for (int p = 0; p < nparts; p++) {
+      unsigned int first = std::find(partition.begin(), partition.end(), p) - partition.begin();
+      TS_ASSERT_LESS_THAN(first, numCells());
+      if (first >= numCells())
+        continue;
+
+      std::vector<unsigned int> stack(1, first);
+      visited[first] = true;
+      while (!stack.empty()) {
+        const unsigned int cell = stack.back();
+        stack.pop_back();
+        for (unsigned int neighbor : m_neighbors[cell]) {
+          if (!visited[neighbor] && partition[neighbor] == p) {
+            visited[neighbor] = true;
+            stack.push_back(neighbor);
+          }
+        }
+      }
+    }
+    TS_ASSERT_EQUALS(std::count(visited.begin(), visited.end(), true), static_cast<long>(numCells()));
+  }
+};
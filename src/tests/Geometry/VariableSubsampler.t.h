@@ -84,4 +84,36 @@ class seissol::unit_test::VariableSubsamplerTestSuite : public CxxTest::TestSuit
         TS_ASSERT_DELTA(outDofs[i], expectedDOFs[i], epsilon);
       }
     };
+
+    void testGetAll() {
+      std::srand(4321);
+      seissol::refinement::DivideTetrahedronBy8<double> refineBy8;
+      // 3 cells, order 4 (20 basis functions, 24 aligned DOFs), 9 quantities
+      seissol::refinement::VariableSubsampler<double> subsampler(3, refineBy8, 4, 9, 24);
+
+      std::vector<double> dofs(3*9*24);
+      for (unsigned i = 0; i < dofs.size(); i++) {
+        dofs[i] = (double)std::rand()/RAND_MAX;
+      }
+      unsigned int cellMap[3] = {2, 0, 1};
+
+      std::vector<double> expected(9*3*8);
+      for (unsigned var = 0; var < 9; var++) {
+        subsampler.get(dofs.data(), cellMap, var, &expected[var*3*8]);
+      }
+
+      // Skip every other variable
+      std::vector<double> outDofs(9*3*8, 0);
+      std::vector<double*> outData(9, 0L);
+      for (unsigned var = 0; var < 9; var += 2) {
+        outData[var] = &outDofs[var*3*8];
+      }
+      subsampler.getAll(dofs.data(), cellMap, outData.data());
+
+      for (unsigned var = 0; var < 9; var++) {
+        for (unsigned i = 0; i < 3*8; i++) {
+          TS_ASSERT_DELTA(outDofs[var*3*8 + i], (var % 2 == 0) ? expected[var*3*8 + i] : 0, 100*epsilon);
+        }
+      }
+    }
 }; 
@@ -3,6 +3,7 @@
 
 #include "tests/Geometry/MockReader.h"
 #include "Initializer/PointMapper.h"
+#include "Geometry/MeshTools.h"
 
 namespace unit_tests {
   class PointMapperTestSuite;
@@ -51,4 +52,58 @@ class unit_tests::PointMapperTestSuite: public CxxTest::TestSuite {
         TS_ASSERT_EQUALS(meshId[i], expectedMeshId[i]);
       }
   };
+
+    void testFindMeshIdsCube() {
+      const seissol::MockCubeReader mockReader(5);
+      auto const& elements = mockReader.getElements();
+      auto const& meshVertices = mockReader.getVertices();
+
+      // random points and points on vertices and faces of the grid
+      const unsigned numPoints = 1200;
+      std::vector<Eigen::Vector3d> points(numPoints);
+      for (unsigned i = 0; i < 1000; ++i) {
+        points[i] = Eigen::Vector3d((double)std::rand()/RAND_MAX, (double)std::rand()/RAND_MAX, (double)std::rand()/RAND_MAX);
+      }
+      for (unsigned i = 1000; i < numPoints; ++i) {
+        points[i] = Eigen::Vector3d((std::rand() % 6) / 5.0, (std::rand() % 6) / 5.0, (double)std::rand()/RAND_MAX);
+      }
+      points[numPoints-1] = Eigen::Vector3d(1.5, 0.5, 0.5);
+
+      std::vector<short> contained(numPoints);
+      std::vector<unsigned> meshIds(numPoints, std::numeric_limits<unsigned>::max());
+      seissol::initializers::findMeshIds(points.data(), mockReader, numPoints, contained.data(), meshIds.data());
+
+      // brute-force reference
+      for (unsigned point = 0; point < numPoints; ++point) {
+        short expectedContained = 0;
+        unsigned expectedMeshId = std::numeric_limits<unsigned>::max();
+        for (unsigned elem = 0; elem < elements.size() && expectedContained == 0; ++elem) {
+          int notInside = 0;
+          for (int face = 0; face < 4; ++face) {
+            VrtxCoords n, p;
+            MeshTools::pointOnPlane(elements[elem], face, meshVertices, p);
+            MeshTools::normal(elements[elem], face, meshVertices, n);
+            double plane[4] = { n[0], n[1], n[2], -MeshTools::dot(n, p) };
+            double x[4] = { points[point](0), points[point](1), points[point](2), 1.0 };
+            double result = 0.0;
+            for (unsigned dim = 0; dim < 4; ++dim) {
+              result += plane[dim] * x[dim];
+            }
+            notInside += (result > 0.0) ? 1 : 0;
+          }
+          if (notInside == 0) {
+            expectedContained = 1;
+            expectedMeshId = elem;
+          }
+        }
+
+        TS_ASSERT_EQUALS(contained[point], expectedContained);
+        TS_ASSERT_EQUALS(meshIds[point], expectedMeshId);
+      }
+
+      TS_ASSERT_EQUALS(contained[numPoints-1], 0);
+      for (unsigned point = 0; point < 1000; ++point) {
+        TS_ASSERT_EQUALS(contained[point], 1);
+      }
+    }
 };
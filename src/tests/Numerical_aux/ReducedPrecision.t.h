@@ -0,0 +1,129 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the conversion to reduced precision.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <Numerical_aux/ReducedPrecision.h>
+
+#include <cmath>
+#include <limits>
+
+namespace seissol {
+  namespace unit_test {
+    class ReducedPrecisionTestSuite;
+  }
+}
+
+class seissol::unit_test::ReducedPrecisionTestSuite : public CxxTest::TestSuite
+{
+public:
+  void testBFloat16()
+  {
+    using namespace seissol::reducedPrecision;
+
+    // exactly representable values
+    TS_ASSERT_EQUALS(toBFloat16(1.0f), 0x3f80);
+    TS_ASSERT_EQUALS(toBFloat16(-2.0f), 0xc000);
+    TS_ASSERT_EQUALS(toBFloat16(0.0f), 0x0000);
+    TS_ASSERT_EQUALS(fromBFloat16(0x3f80), 1.0f);
+    TS_ASSERT_EQUALS(fromBFloat16(0xc000), -2.0f);
+
+    // round to nearest even: 1 + 2^-8 lies halfway between 1 and 1 + 2^-7
+    TS_ASSERT_EQUALS(toBFloat16(1.0f + 1.0f / 256.0f), 0x3f80);
+    TS_ASSERT_EQUALS(toBFloat16(1.0f + 3.0f / 256.0f), 0x3f82);
+    TS_ASSERT_EQUALS(toBFloat16(1.0f + 1.0f / 256.0f + 1.0f / 65536.0f), 0x3f81);
+
+    // special values
+    TS_ASSERT(std::isnan(fromBFloat16(toBFloat16(std::numeric_limits<float>::quiet_NaN()))));
+    TS_ASSERT(std::isinf(fromBFloat16(toBFloat16(std::numeric_limits<float>::infinity()))));
+  }
+
+  void testRoundTrip()
+  {
+    using namespace seissol::reducedPrecision;
+
+    const unsigned n = 1000;
+    real values[n];
+    reduced_real reduced[n];
+    real result[n];
+    for (unsigned i = 0; i < n; ++i) {
+      values[i] = std::sin(0.1 * i) * std::pow(10.0, static_cast<int>(i % 13) - 6);
+    }
+
+    compress(values, n, reduced);
+    decompress(reduced, n, result);
+
+    for (unsigned i = 0; i < n; ++i) {
+      TS_ASSERT_LESS_THAN_EQUALS(std::fabs(result[i] - values[i]), unitRoundoff() * std::fabs(values[i]));
+    }
+  }
+
+  /**
+   * Accuracy of the time integral of a plane wave sin(k x - omega t) computed from
+   * time derivatives stored in reduced precision, as done for the ghost layer.
+   **/
+  void testTimeIntegralAccuracy()
+  {
+    using namespace seissol::reducedPrecision;
+
+    const unsigned order = 6;
+    const double omega = 2.0 * M_PI;
+    const double phase = 0.3;
+    const double dt = 0.01;
+
+    real derivatives[order];
+    reduced_real reduced[order];
+    real expanded[order];
+    for (unsigned d = 0; d < order; ++d) {
+      // d-th time derivative of sin(phase - omega t) at t = 0
+      derivatives[d] = std::pow(omega, d) * std::sin(phase - d * M_PI / 2.0);
+    }
+    compress(derivatives, order, reduced);
+    decompress(reduced, order, expanded);
+
+    double exact = 0.0, approximation = 0.0, factorial = 1.0;
+    for (unsigned d = 0; d < order; ++d) {
+      factorial *= (d + 1);
+      exact += derivatives[d] * std::pow(dt, d + 1) / factorial;
+      approximation += expanded[d] * std::pow(dt, d + 1) / factorial;
+    }
+
+    // the rounding error of the reduced storage dominates
+    TS_ASSERT_LESS_THAN_EQUALS(std::fabs(approximation - exact), 2.0 * unitRoundoff() * std::fabs(exact));
+  }
+};
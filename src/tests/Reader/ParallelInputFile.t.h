@@ -0,0 +1,119 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Test of the parallel input files
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Reader/ParallelIStream.h>
+
+namespace seissol {
+  namespace unit_test {
+    class ParallelInputFileTestSuite;
+  }
+}
+
+class seissol::unit_test::ParallelInputFileTestSuite : public CxxTest::TestSuite
+{
+private:
+  const char* m_fileName;
+
+public:
+  void setUp()
+  {
+    m_fileName = "parallel_input_file.txt";
+
+    std::ofstream file(m_fileName, std::ios::binary);
+    file << "&Equations\n  Order = 4\r\n/\n\n1.0 2.0 3.0";
+  }
+
+  void tearDown()
+  {
+    std::remove(m_fileName);
+  }
+
+  void testRead()
+  {
+    seissol::reader::ParallelInputFile file;
+    TS_ASSERT(!file.open("does_not_exist.txt"));
+    TS_ASSERT(file.open(m_fileName));
+
+    TS_ASSERT_EQUALS(file.size(), 38u);
+    TS_ASSERT_EQUALS(std::string(file.data(), 10), "&Equations");
+  }
+
+  void testLines()
+  {
+    seissol::reader::ParallelInputFile file(m_fileName);
+
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> lengths;
+    file.lines(offsets, lengths);
+
+    // No line terminators and an unterminated last line
+    const char* lines[] = {"&Equations", "  Order = 4", "/", "", "1.0 2.0 3.0"};
+    TS_ASSERT_EQUALS(offsets.size(), 5u);
+    TS_ASSERT_EQUALS(lengths.size(), 5u);
+    for (unsigned i = 0; i < offsets.size() && i < 5; i++) {
+      TS_ASSERT_EQUALS(std::string(file.data() + offsets[i], lengths[i]), lines[i]);
+    }
+  }
+
+  void testStream()
+  {
+    ParallelIStream stream(m_fileName);
+
+    std::string line;
+    std::getline(stream, line);
+    TS_ASSERT_EQUALS(line, "&Equations");
+
+    std::getline(stream, line);
+    std::getline(stream, line);
+    std::getline(stream, line);
+
+    double x, y, z;
+    stream >> x >> y >> z;
+    TS_ASSERT(stream);
+    TS_ASSERT_EQUALS(x, 1.0);
+    TS_ASSERT_EQUALS(y, 2.0);
+    TS_ASSERT_EQUALS(z, 3.0);
+  }
+};
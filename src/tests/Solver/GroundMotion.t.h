@@ -0,0 +1,175 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the peak ground motions and response spectra of the free surface.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <Solver/GroundMotion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace seissol {
+  namespace unit_test {
+    class GroundMotionTestSuite;
+  }
+}
+
+class seissol::unit_test::GroundMotionTestSuite : public CxxTest::TestSuite
+{
+private:
+  static double medianOfRotations(double peak)
+  {
+    std::vector<double> rotated(GROUNDMOTION_NUMBER_OF_ROTATIONS);
+    for (unsigned r = 0; r < GROUNDMOTION_NUMBER_OF_ROTATIONS; ++r) {
+      rotated[r] = peak * std::abs(std::cos(M_PI * r / GROUNDMOTION_NUMBER_OF_ROTATIONS));
+    }
+    std::sort(rotated.begin(), rotated.end());
+    unsigned const half = GROUNDMOTION_NUMBER_OF_ROTATIONS / 2;
+    return (GROUNDMOTION_NUMBER_OF_ROTATIONS % 2 == 0) ? 0.5 * (rotated[half-1] + rotated[half]) : rotated[half];
+  }
+
+public:
+  void testPeaks()
+  {
+    seissol::solver::GroundMotion groundMotion;
+    groundMotion.configure(std::vector<double>(), 0.05);
+
+    TS_ASSERT_EQUALS(groundMotion.numberOfVariables(), 12u);
+    TS_ASSERT_EQUALS(groundMotion.variableNames().size(), 12u);
+
+    std::vector<double> state(groundMotion.stateSize(), 0.0);
+    std::vector<double> values(groundMotion.numberOfVariables());
+
+    // The rotated peaks miss the direction of the peak by at most half the angle between two rotations
+    double const rotationError = std::cos(0.5 * M_PI / GROUNDMOTION_NUMBER_OF_ROTATIONS);
+
+    double const dt = 0.5;
+    double const velocities[3][3] = {{0.0, 0.0, 0.0}, {3.0, -4.0, 1.0}, {1.0, 0.0, -2.0}};
+    double const displacements[3][3] = {{0.0, 0.0, 0.0}, {0.5, 0.0, 0.0}, {1.0, 1.0, 0.5}};
+    for (unsigned step = 0; step < 3; ++step) {
+      groundMotion.update(dt, 0, step == 0, velocities[step], displacements[step], state.data());
+    }
+    groundMotion.output(state.data(), values.data());
+
+    // PGV
+    TS_ASSERT_DELTA(values[0], 5.0, 1e-12);
+    TS_ASSERT_DELTA(values[1], 2.0, 1e-12);
+    TS_ASSERT_LESS_THAN_EQUALS(values[3], 5.0 + 1e-12);
+    TS_ASSERT_LESS_THAN_EQUALS(5.0 * rotationError, values[3]);
+    TS_ASSERT_LESS_THAN_EQUALS(values[2], values[3]);
+
+    // PGA (accelerations (6, -8, 2) and (-4, 8, -6))
+    TS_ASSERT_DELTA(values[4], 10.0, 1e-12);
+    TS_ASSERT_DELTA(values[5], 6.0, 1e-12);
+    TS_ASSERT_LESS_THAN_EQUALS(values[7], 10.0 + 1e-12);
+    TS_ASSERT_LESS_THAN_EQUALS(10.0 * rotationError, values[7]);
+
+    // PGD
+    TS_ASSERT_DELTA(values[8], std::sqrt(2.0), 1e-12);
+    TS_ASSERT_DELTA(values[9], 0.5, 1e-12);
+    TS_ASSERT_LESS_THAN_EQUALS(values[11], std::sqrt(2.0) + 1e-12);
+    TS_ASSERT_LESS_THAN_EQUALS(std::sqrt(2.0) * rotationError, values[11]);
+  }
+
+  void testRotD()
+  {
+    seissol::solver::GroundMotion groundMotion;
+    groundMotion.configure(std::vector<double>(), 0.05);
+
+    std::vector<double> state(groundMotion.stateSize(), 0.0);
+    std::vector<double> values(groundMotion.numberOfVariables());
+
+    // Motion along the x-axis only
+    double const velocity[3] = {2.0, 0.0, 0.0};
+    double const displacement[3] = {0.0, 0.0, 0.0};
+    groundMotion.update(1.0, 0, true, velocity, displacement, state.data());
+    groundMotion.output(state.data(), values.data());
+
+    TS_ASSERT_DELTA(values[3], 2.0, 1e-12);
+    TS_ASSERT_DELTA(values[2], medianOfRotations(2.0), 1e-12);
+  }
+
+  void testOscillator()
+  {
+    double const period = 0.5;
+    double const damping = 0.05;
+    double const omega = 2.0 * M_PI / period;
+    double const omegaD = omega * std::sqrt(1.0 - damping * damping);
+
+    seissol::solver::GroundMotion groundMotion;
+    groundMotion.configure(std::vector<double>(1, period), damping);
+
+    TS_ASSERT_EQUALS(groundMotion.numberOfVariables(), 14u);
+    TS_ASSERT_EQUALS(groundMotion.variableNames()[12], "PSA0.5s_RotD50");
+
+    std::vector<double> coefficients(seissol::solver::GroundMotion::NumberOfCoefficients);
+    std::vector<double> state(groundMotion.stateSize(), 0.0);
+    std::vector<double> values(groundMotion.numberOfVariables());
+
+    // Constant acceleration in x-direction, starting at rest
+    double const acceleration = 3.0;
+    double const dt = 0.01;
+    unsigned const steps = 200;
+    groundMotion.computeCoefficients(dt, coefficients.data());
+
+    double const zero[3] = {0.0, 0.0, 0.0};
+    groundMotion.update(dt, coefficients.data(), true, zero, zero, state.data());
+
+    double peak = 0.0;
+    for (unsigned step = 1; step <= steps; ++step) {
+      double const time = step * dt;
+      double const velocity[3] = {acceleration * time, 0.0, 0.0};
+      groundMotion.update(dt, coefficients.data(), false, velocity, zero, state.data());
+
+      // Step response of the damped oscillator
+      double const u = -acceleration / (omega * omega)
+        * (1.0 - std::exp(-damping * omega * time) * (std::cos(omegaD * time) + damping * omega / omegaD * std::sin(omegaD * time)));
+      peak = std::max(peak, std::abs(u));
+    }
+    groundMotion.output(state.data(), values.data());
+
+    // The peak of the step response is close to twice the static displacement
+    TS_ASSERT_LESS_THAN(1.8 * acceleration / (omega * omega), peak);
+
+    TS_ASSERT_DELTA(values[5], 0.0, 1e-12);
+    TS_ASSERT_DELTA(values[4], acceleration, 1e-9);
+    TS_ASSERT_DELTA(values[13], omega * omega * peak, 1e-9 * acceleration);
+    TS_ASSERT_DELTA(values[12], omega * omega * medianOfRotations(peak), 1e-9 * acceleration);
+  }
+};